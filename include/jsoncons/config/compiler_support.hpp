@@ -267,6 +267,14 @@
 #  endif // defined(JSONCONS_HAS_2017)
 #endif // !defined(JSONCONS_HAS_FILESYSTEM)
 
+#if !defined(JSONCONS_HAS_COROUTINES)
+#  if defined(__cpp_impl_coroutine) && defined(__has_include)
+#    if __cpp_impl_coroutine >= 201902L && __has_include(<coroutine>)
+#      define JSONCONS_HAS_COROUTINES 1
+#    endif
+#  endif 
+#endif // !defined(JSONCONS_HAS_COROUTINES)
+
 #if !defined(JSONCONS_HAS_STD_MAKE_UNIQUE)
    #if defined(__clang__) && defined(__cplusplus)
       #if defined(__APPLE__)
@@ -0,0 +1,356 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_FIXED_BUFFER_VISITOR_HPP
+#define JSONCONS_DETAIL_FIXED_BUFFER_VISITOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory> // std::addressof
+#include <system_error>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/semantic_tag.hpp>
+#include <jsoncons/ser_utils.hpp>
+#include <jsoncons/utility/byte_string.hpp>
+
+namespace jsoncons {
+namespace detail {
+
+    // Forwards events to an encoder writing to a fixed_bytes_sink. Once the encoded length
+    // exceeds the capacity of the buffer, sets overflow_ec and stops forwarding events.
+    template <typename CharT>
+    class fixed_buffer_visitor : public basic_json_visitor<CharT>
+    {
+    public:
+        using typename basic_json_visitor<CharT>::char_type;
+        using typename basic_json_visitor<CharT>::string_view_type;
+    private:
+        basic_json_visitor<char_type>* destination_;
+        const std::size_t* length_ptr_;
+        std::size_t capacity_;
+        std::error_code overflow_ec_;
+
+    public:
+        fixed_buffer_visitor(basic_json_visitor<char_type>& destination, const std::size_t& length,
+            std::size_t capacity, std::error_code overflow_ec)
+            : destination_(std::addressof(destination)), length_ptr_(std::addressof(length)),
+              capacity_(capacity), overflow_ec_(overflow_ec)
+        {
+        }
+
+    private:
+        bool overflowed(std::error_code& ec) const
+        {
+            if (JSONCONS_UNLIKELY(*length_ptr_ > capacity_))
+            {
+                ec = overflow_ec_;
+                return true;
+            }
+            return false;
+        }
+
+        void visit_flush() override
+        {
+            destination_->flush();
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_object(semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->begin_object(tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_object(std::size_t length, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->begin_object(length, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_end_object(const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->end_object(context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_array(semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->begin_array(tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_array(std::size_t length, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->begin_array(length, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_end_array(const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->end_array(context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_key(const string_view_type& name, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->key(name, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_string(const string_view_type& value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->string_value(value, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view& b, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->byte_string_value(b, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view& b, uint64_t ext_tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->byte_string_value(b, ext_tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_uint64(uint64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->uint64_value(value, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_int64(int64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->int64_value(value, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_half(uint16_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->half_value(value, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_double(double value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->double_value(value, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_bool(bool value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->bool_value(value, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_null(semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->null_value(tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const uint8_t>& s, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->typed_array(s, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const uint16_t>& s, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->typed_array(s, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const uint32_t>& s, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->typed_array(s, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const uint64_t>& s, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->typed_array(s, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int8_t>& s, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->typed_array(s, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int16_t>& s, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->typed_array(s, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int32_t>& s, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->typed_array(s, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int64_t>& s, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->typed_array(s, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(half_arg_t, const jsoncons::span<const uint16_t>& s, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->typed_array(half_arg, s, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const float>& s, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->typed_array(s, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const double>& s, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->typed_array(s, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_multi_dim(const jsoncons::span<const size_t>& shape, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->begin_multi_dim(shape, tag, context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_end_multi_dim(const ser_context& context, std::error_code& ec) override
+        {
+            if (!overflowed(ec))
+            {
+                destination_->end_multi_dim(context, ec);
+                overflowed(ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+    };
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif // JSONCONS_DETAIL_FIXED_BUFFER_VISITOR_HPP
@@ -0,0 +1,192 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_PARALLEL_DECODE_HPP
+#define JSONCONS_DETAIL_PARALLEL_DECODE_HPP
+
+#include <cstddef>
+#include <exception> // std::exception_ptr
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/ser_utils.hpp>
+
+namespace jsoncons {
+namespace detail {
+
+    inline std::size_t default_thread_count()
+    {
+        std::size_t n = std::thread::hardware_concurrency();
+        return n == 0 ? 1 : n;
+    }
+
+    // Calls f(i) for each i in [0,count) on up to num_threads threads, each thread
+    // taking a contiguous range of indices. All threads are joined before returning;
+    // if f throws, the exception from the lowest range is rethrown on the calling thread.
+    template <typename F>
+    void parallel_for(std::size_t count, std::size_t num_threads, F f)
+    {
+        if (num_threads == 0)
+        {
+            num_threads = default_thread_count();
+        }
+        if (num_threads > count)
+        {
+            num_threads = count;
+        }
+        if (num_threads == 0)
+        {
+            return;
+        }
+        std::size_t per_thread = count / num_threads;
+        std::size_t remainder = count % num_threads;
+
+        std::vector<std::exception_ptr> errors(num_threads);
+        auto work = [&f,&errors](std::size_t t, std::size_t begin, std::size_t end)
+        {
+            JSONCONS_TRY
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    f(i);
+                }
+            }
+            JSONCONS_CATCH(...)
+            {
+                errors[t] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(num_threads - 1);
+        std::size_t begin = per_thread + (remainder > 0 ? 1 : 0);
+        for (std::size_t t = 1; t < num_threads; ++t)
+        {
+            std::size_t end = begin + per_thread + (t < remainder ? 1 : 0);
+            JSONCONS_TRY
+            {
+                threads.emplace_back(work, t, begin, end);
+            }
+            JSONCONS_CATCH(...)
+            {
+                // Could not start a thread, the range is done on this one
+                work(t, begin, end);
+            }
+            begin = end;
+        }
+        work(0, 0, per_thread + (remainder > 0 ? 1 : 0));
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+        for (const auto& e : errors)
+        {
+            if (JSONCONS_UNLIKELY(e))
+            {
+                std::rethrow_exception(e);
+            }
+        }
+    }
+
+    // Decodes each item with decode, which returns a read_result<T>, on up to num_threads threads.
+    // Each thread takes a contiguous run of items of roughly equal size, and the results
+    // are returned in the original order. On failure, returns the error of the first failing item.
+    template <typename T,typename Item,typename Decode>
+    read_result<std::vector<T>> parallel_decode(const std::vector<Item>& items,
+        std::size_t num_threads,
+        Decode decode)
+    {
+        using result_type = read_result<std::vector<T>>;
+
+        struct run
+        {
+            std::size_t begin;
+            std::size_t end;
+            std::vector<T> values;
+            std::size_t error_index;
+            read_error error;
+
+            run(std::size_t b, std::size_t e)
+                : begin(b), end(e), error_index(e), error(std::error_code{})
+            {
+            }
+        };
+
+        if (num_threads == 0)
+        {
+            num_threads = default_thread_count();
+        }
+        if (num_threads > items.size())
+        {
+            num_threads = items.size();
+        }
+
+        std::size_t total = 0;
+        for (const auto& item : items)
+        {
+            total += item.size();
+        }
+
+        std::vector<run> runs;
+        runs.reserve(num_threads);
+        std::size_t target = num_threads == 0 ? 0 : (total + num_threads - 1) / num_threads;
+        std::size_t begin = 0;
+        std::size_t size = 0;
+        for (std::size_t i = 0; i < items.size(); ++i)
+        {
+            size += items[i].size();
+            if (size >= target && runs.size() + 1 < num_threads)
+            {
+                runs.emplace_back(begin, i+1);
+                begin = i+1;
+                size = 0;
+            }
+        }
+        if (begin < items.size())
+        {
+            runs.emplace_back(begin, items.size());
+        }
+
+        parallel_for(runs.size(), runs.size(), [&](std::size_t index)
+        {
+            run& r = runs[index];
+            r.values.reserve(r.end - r.begin);
+            for (std::size_t i = r.begin; i < r.end; ++i)
+            {
+                auto result = decode(items[i]);
+                if (JSONCONS_UNLIKELY(!result))
+                {
+                    r.error_index = i;
+                    r.error = result.error();
+                    return;
+                }
+                r.values.push_back(std::move(*result));
+            }
+        });
+
+        std::vector<T> values;
+        values.reserve(items.size());
+        for (auto& r : runs)
+        {
+            if (JSONCONS_UNLIKELY(r.error_index != r.end))
+            {
+                return result_type{jsoncons::unexpect, r.error};
+            }
+            for (auto& value : r.values)
+            {
+                values.push_back(std::move(value));
+            }
+        }
+        return result_type{std::move(values)};
+    }
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif // JSONCONS_DETAIL_PARALLEL_DECODE_HPP
@@ -0,0 +1,647 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_EVENT_BATCH_HPP
+#define JSONCONS_EVENT_BATCH_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory> // std::allocator
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <utility> // std::swap
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/semantic_tag.hpp>
+#include <jsoncons/ser_utils.hpp>
+#include <jsoncons/staj_event.hpp>
+#include <jsoncons/utility/byte_string.hpp>
+
+namespace jsoncons {
+
+// A parse event in a batch. Strings and keys are stored in the batch's character buffer,
+// and byte strings in its byte buffer, at offset with length value.length. line and column
+// are the position reported by the parser for the event.
+struct batch_event
+{
+    staj_events event_type;
+    semantic_tag tag;
+    union
+    {
+        bool bool_value;
+        int64_t int64_value;
+        uint64_t uint64_value;
+        uint16_t half_value;
+        double double_value;
+        std::size_t length;
+    } value;
+    std::size_t offset;
+    std::size_t line;
+    std::size_t column;
+};
+
+template <typename CharT,typename Allocator=std::allocator<char>>
+class basic_event_batch
+{
+public:
+    using char_type = CharT;
+    using string_view_type = jsoncons::basic_string_view<CharT>;
+    using allocator_type = Allocator;
+private:
+    using event_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<batch_event>;
+    using char_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<CharT>;
+    using byte_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<uint8_t>;
+
+    std::vector<batch_event,event_allocator_type> events_;
+    std::basic_string<CharT,std::char_traits<CharT>,char_allocator_type> chars_;
+    std::vector<uint8_t,byte_allocator_type> bytes_;
+
+    // Reports the position of the event being replayed
+    class event_context final : public ser_context
+    {
+        const batch_event* event_{nullptr};
+    public:
+        void event(const batch_event& e)
+        {
+            event_ = &e;
+        }
+
+        std::size_t line() const final
+        {
+            return event_ != nullptr ? event_->line : 0;
+        }
+
+        std::size_t column() const final
+        {
+            return event_ != nullptr ? event_->column : 0;
+        }
+    };
+public:
+    explicit basic_event_batch(const Allocator& alloc = Allocator())
+        : events_(alloc), chars_(alloc), bytes_(alloc)
+    {
+    }
+
+    std::size_t size() const
+    {
+        return events_.size();
+    }
+
+    bool empty() const
+    {
+        return events_.empty();
+    }
+
+    // Keeps the capacity of the buffers, so a batch can be refilled without allocating
+    void clear()
+    {
+        events_.clear();
+        chars_.clear();
+        bytes_.clear();
+    }
+
+    void swap(basic_event_batch& other) noexcept
+    {
+        events_.swap(other.events_);
+        chars_.swap(other.chars_);
+        bytes_.swap(other.bytes_);
+    }
+
+    const batch_event& operator[](std::size_t i) const
+    {
+        return events_[i];
+    }
+
+    string_view_type string_value(const batch_event& event) const
+    {
+        return string_view_type(chars_.data() + event.offset, event.value.length);
+    }
+
+    byte_string_view bytes_value(const batch_event& event) const
+    {
+        return byte_string_view(bytes_.data() + event.offset, event.value.length);
+    }
+
+    // The event's position is taken from context
+    void push_back(staj_events event_type, semantic_tag tag, const ser_context& context = ser_context())
+    {
+        events_.push_back(batch_event{event_type, tag, {}, 0, context.line(), context.column()});
+    }
+
+    void push_back(staj_events event_type, const string_view_type& s, semantic_tag tag, const ser_context& context = ser_context())
+    {
+        batch_event event{event_type, tag, {}, chars_.size(), context.line(), context.column()};
+        event.value.length = s.size();
+        chars_.append(s.data(), s.size());
+        events_.push_back(event);
+    }
+
+    void push_back(const byte_string_view& b, semantic_tag tag, const ser_context& context = ser_context())
+    {
+        batch_event event{staj_events::byte_string_value, tag, {}, bytes_.size(), context.line(), context.column()};
+        event.value.length = b.size();
+        bytes_.insert(bytes_.end(), b.begin(), b.end());
+        events_.push_back(event);
+    }
+
+    void push_back(bool value, semantic_tag tag, const ser_context& context = ser_context())
+    {
+        batch_event event{staj_events::bool_value, tag, {}, 0, context.line(), context.column()};
+        event.value.bool_value = value;
+        events_.push_back(event);
+    }
+
+    void push_back(int64_t value, semantic_tag tag, const ser_context& context = ser_context())
+    {
+        batch_event event{staj_events::int64_value, tag, {}, 0, context.line(), context.column()};
+        event.value.int64_value = value;
+        events_.push_back(event);
+    }
+
+    void push_back(uint64_t value, semantic_tag tag, const ser_context& context = ser_context())
+    {
+        batch_event event{staj_events::uint64_value, tag, {}, 0, context.line(), context.column()};
+        event.value.uint64_value = value;
+        events_.push_back(event);
+    }
+
+    void push_half(uint16_t value, semantic_tag tag, const ser_context& context = ser_context())
+    {
+        batch_event event{staj_events::half_value, tag, {}, 0, context.line(), context.column()};
+        event.value.half_value = value;
+        events_.push_back(event);
+    }
+
+    void push_back(double value, semantic_tag tag, const ser_context& context = ser_context())
+    {
+        batch_event event{staj_events::double_value, tag, {}, 0, context.line(), context.column()};
+        event.value.double_value = value;
+        events_.push_back(event);
+    }
+
+    // Sends the events to visitor in order, each with the position it was recorded with,
+    // stopping at the first error
+    void replay(basic_json_visitor<CharT>& visitor, std::error_code& ec) const
+    {
+        event_context context;
+        for (const auto& event : events_)
+        {
+            context.event(event);
+            switch (event.event_type)
+            {
+                case staj_events::begin_object:
+                    visitor.begin_object(event.tag, context, ec);
+                    break;
+                case staj_events::end_object:
+                    visitor.end_object(context, ec);
+                    break;
+                case staj_events::begin_array:
+                    visitor.begin_array(event.tag, context, ec);
+                    break;
+                case staj_events::end_array:
+                    visitor.end_array(context, ec);
+                    break;
+                case staj_events::key:
+                    visitor.key(string_value(event), context, ec);
+                    break;
+                case staj_events::string_value:
+                    visitor.string_value(string_value(event), event.tag, context, ec);
+                    break;
+                case staj_events::byte_string_value:
+                    visitor.byte_string_value(bytes_value(event), event.tag, context, ec);
+                    break;
+                case staj_events::null_value:
+                    visitor.null_value(event.tag, context, ec);
+                    break;
+                case staj_events::bool_value:
+                    visitor.bool_value(event.value.bool_value, event.tag, context, ec);
+                    break;
+                case staj_events::int64_value:
+                    visitor.int64_value(event.value.int64_value, event.tag, context, ec);
+                    break;
+                case staj_events::uint64_value:
+                    visitor.uint64_value(event.value.uint64_value, event.tag, context, ec);
+                    break;
+                case staj_events::half_value:
+                    visitor.half_value(event.value.half_value, event.tag, context, ec);
+                    break;
+                case staj_events::double_value:
+                    visitor.double_value(event.value.double_value, event.tag, context, ec);
+                    break;
+                default:
+                    break;
+            }
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+        }
+    }
+};
+
+template <typename CharT,typename Allocator>
+void swap(basic_event_batch<CharT,Allocator>& a, basic_event_batch<CharT,Allocator>& b) noexcept
+{
+    a.swap(b);
+}
+
+// Receives parse events a batch at a time
+template <typename CharT,typename Allocator=std::allocator<char>>
+class basic_batch_visitor
+{
+public:
+    using char_type = CharT;
+    using batch_type = basic_event_batch<CharT,Allocator>;
+
+    virtual ~basic_batch_visitor() = default;
+
+    // The visitor may take the contents of batch by swapping it with another batch.
+    // The caller clears batch afterwards.
+    void batch(batch_type& batch, std::error_code& ec)
+    {
+        visit_batch(batch, ec);
+    }
+
+    void flush()
+    {
+        visit_flush();
+    }
+private:
+    virtual void visit_batch(batch_type& batch, std::error_code& ec) = 0;
+
+    virtual void visit_flush()
+    {
+    }
+};
+
+// Collects the events it visits into batches of batch_size events, and hands each full batch
+// to a batch visitor, so the visitor is called once per batch rather than once per event.
+// A partial batch is handed over on flush, which parsers call at the end of each value.
+template <typename CharT,typename Allocator=std::allocator<char>>
+class basic_batching_json_visitor final : public basic_json_visitor<CharT>
+{
+public:
+    using typename basic_json_visitor<CharT>::string_view_type;
+    using batch_type = basic_event_batch<CharT,Allocator>;
+private:
+    basic_batch_visitor<CharT,Allocator>& destination_;
+    std::size_t batch_size_;
+    batch_type batch_;
+    std::error_code error_;
+
+    // Noncopyable and nonmoveable
+    basic_batching_json_visitor(const basic_batching_json_visitor&) = delete;
+    basic_batching_json_visitor& operator=(const basic_batching_json_visitor&) = delete;
+public:
+    basic_batching_json_visitor(basic_batch_visitor<CharT,Allocator>& destination,
+        std::size_t batch_size = 1024,
+        const Allocator& alloc = Allocator())
+        : destination_(destination), batch_size_(batch_size == 0 ? 1 : batch_size), batch_(alloc)
+    {
+    }
+
+    std::size_t batch_size() const
+    {
+        return batch_size_;
+    }
+
+    // The error from handing over a batch on flush, which flush cannot report itself.
+    // It is also reported to the next event visited.
+    const std::error_code& error() const
+    {
+        return error_;
+    }
+
+private:
+    bool failed(std::error_code& ec) const
+    {
+        if (JSONCONS_UNLIKELY(error_))
+        {
+            ec = error_;
+            return true;
+        }
+        return false;
+    }
+
+    void hand_over(std::error_code& ec)
+    {
+        destination_.batch(batch_, ec);
+        batch_.clear();
+    }
+
+    void check_full(std::error_code& ec)
+    {
+        if (batch_.size() >= batch_size_)
+        {
+            hand_over(ec);
+        }
+    }
+
+    // A flush may run on a producer thread with no caller to catch an exception,
+    // so an error is recorded rather than thrown
+    void visit_flush() final
+    {
+        if (!batch_.empty() && !error_)
+        {
+            hand_over(error_);
+        }
+        destination_.flush();
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_begin_object(semantic_tag tag, const ser_context& context, std::error_code& ec) final
+    {
+        if (failed(ec))
+        {
+            JSONCONS_VISITOR_RETURN;
+        }
+        batch_.push_back(staj_events::begin_object, tag, context);
+        check_full(ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_end_object(const ser_context& context, std::error_code& ec) final
+    {
+        if (failed(ec))
+        {
+            JSONCONS_VISITOR_RETURN;
+        }
+        batch_.push_back(staj_events::end_object, semantic_tag::none, context);
+        check_full(ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_begin_array(semantic_tag tag, const ser_context& context, std::error_code& ec) final
+    {
+        if (failed(ec))
+        {
+            JSONCONS_VISITOR_RETURN;
+        }
+        batch_.push_back(staj_events::begin_array, tag, context);
+        check_full(ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_end_array(const ser_context& context, std::error_code& ec) final
+    {
+        if (failed(ec))
+        {
+            JSONCONS_VISITOR_RETURN;
+        }
+        batch_.push_back(staj_events::end_array, semantic_tag::none, context);
+        check_full(ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_key(const string_view_type& name, const ser_context& context, std::error_code& ec) final
+    {
+        if (failed(ec))
+        {
+            JSONCONS_VISITOR_RETURN;
+        }
+        batch_.push_back(staj_events::key, name, semantic_tag::none, context);
+        check_full(ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_null(semantic_tag tag, const ser_context& context, std::error_code& ec) final
+    {
+        if (failed(ec))
+        {
+            JSONCONS_VISITOR_RETURN;
+        }
+        batch_.push_back(staj_events::null_value, tag, context);
+        check_full(ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_bool(bool value, semantic_tag tag, const ser_context& context, std::error_code& ec) final
+    {
+        if (failed(ec))
+        {
+            JSONCONS_VISITOR_RETURN;
+        }
+        batch_.push_back(value, tag, context);
+        check_full(ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_string(const string_view_type& value, semantic_tag tag, const ser_context& context, std::error_code& ec) final
+    {
+        if (failed(ec))
+        {
+            JSONCONS_VISITOR_RETURN;
+        }
+        batch_.push_back(staj_events::string_value, value, tag, context);
+        check_full(ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view& value, semantic_tag tag, const ser_context& context, std::error_code& ec) final
+    {
+        if (failed(ec))
+        {
+            JSONCONS_VISITOR_RETURN;
+        }
+        batch_.push_back(value, tag, context);
+        check_full(ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_uint64(uint64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) final
+    {
+        if (failed(ec))
+        {
+            JSONCONS_VISITOR_RETURN;
+        }
+        batch_.push_back(value, tag, context);
+        check_full(ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_int64(int64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) final
+    {
+        if (failed(ec))
+        {
+            JSONCONS_VISITOR_RETURN;
+        }
+        batch_.push_back(value, tag, context);
+        check_full(ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_half(uint16_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) final
+    {
+        if (failed(ec))
+        {
+            JSONCONS_VISITOR_RETURN;
+        }
+        batch_.push_half(value, tag, context);
+        check_full(ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_double(double value, semantic_tag tag, const ser_context& context, std::error_code& ec) final
+    {
+        if (failed(ec))
+        {
+            JSONCONS_VISITOR_RETURN;
+        }
+        batch_.push_back(value, tag, context);
+        check_full(ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+};
+
+// Replays each batch into a basic_json_visitor, such as a json_decoder or an encoder
+template <typename CharT,typename Allocator=std::allocator<char>>
+class basic_batch_to_json_visitor final : public basic_batch_visitor<CharT,Allocator>
+{
+public:
+    using typename basic_batch_visitor<CharT,Allocator>::batch_type;
+private:
+    basic_json_visitor<CharT>& destination_;
+public:
+    explicit basic_batch_to_json_visitor(basic_json_visitor<CharT>& destination)
+        : destination_(destination)
+    {
+    }
+
+private:
+    void visit_batch(batch_type& batch, std::error_code& ec) final
+    {
+        batch.replay(destination_, ec);
+    }
+
+    void visit_flush() final
+    {
+        destination_.flush();
+    }
+};
+
+// A bounded ring of batches passed from a producer thread, typically a parser reporting to a
+// basic_batching_json_visitor, to a consumer thread. The producer blocks while the ring is full,
+// and the consumer while it is empty. Batches are exchanged by swapping, so their buffers are
+// reused rather than reallocated.
+template <typename CharT,typename Allocator=std::allocator<char>>
+class basic_event_batch_queue final : public basic_batch_visitor<CharT,Allocator>
+{
+public:
+    using typename basic_batch_visitor<CharT,Allocator>::batch_type;
+private:
+    using batch_allocator_type = typename std::allocator_traits<Allocator>:: template rebind_alloc<batch_type>;
+
+    std::vector<batch_type,batch_allocator_type> slots_;
+    std::size_t head_{0};
+    std::size_t count_{0};
+    bool closed_{false};
+    std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+
+    // Noncopyable and nonmoveable
+    basic_event_batch_queue(const basic_event_batch_queue&) = delete;
+    basic_event_batch_queue& operator=(const basic_event_batch_queue&) = delete;
+public:
+    explicit basic_event_batch_queue(std::size_t capacity = 4, const Allocator& alloc = Allocator())
+        : slots_(alloc)
+    {
+        slots_.reserve(capacity == 0 ? 1 : capacity);
+        for (std::size_t i = 0; i < slots_.capacity(); ++i)
+        {
+            slots_.emplace_back(alloc);
+        }
+    }
+
+    std::size_t capacity() const
+    {
+        return slots_.size();
+    }
+
+    // Called by the producer after its last batch, or by the consumer to stop the producer,
+    // whose next batch then fails with std::errc::operation_canceled
+    void close()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        not_full_.notify_all();
+        not_empty_.notify_all();
+    }
+
+    // Waits for the next batch and swaps it into batch. Returns false once the queue
+    // is closed and empty.
+    bool pop(batch_type& batch)
+    {
+        batch.clear();
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            not_empty_.wait(lock, [this]{return count_ > 0 || closed_;});
+            if (count_ == 0)
+            {
+                return false;
+            }
+            batch.swap(slots_[head_]);
+            head_ = (head_ + 1) % slots_.size();
+            --count_;
+        }
+        not_full_.notify_one();
+        return true;
+    }
+
+    // Replays batches into visitor until the queue is closed and empty. On error, closes
+    // the queue so that the producer stops.
+    void replay(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        batch_type batch(slots_.get_allocator());
+        while (pop(batch))
+        {
+            batch.replay(visitor, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                close();
+                return;
+            }
+        }
+        visitor.flush();
+    }
+
+private:
+    void visit_batch(batch_type& batch, std::error_code& ec) final
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            not_full_.wait(lock, [this]{return count_ < slots_.size() || closed_;});
+            if (closed_)
+            {
+                ec = std::make_error_code(std::errc::operation_canceled);
+                return;
+            }
+            batch.swap(slots_[(head_ + count_) % slots_.size()]);
+            ++count_;
+        }
+        not_empty_.notify_one();
+    }
+};
+
+using event_batch = basic_event_batch<char>;
+using wevent_batch = basic_event_batch<wchar_t>;
+using batch_visitor = basic_batch_visitor<char>;
+using wbatch_visitor = basic_batch_visitor<wchar_t>;
+using batching_json_visitor = basic_batching_json_visitor<char>;
+using wbatching_json_visitor = basic_batching_json_visitor<wchar_t>;
+using batch_to_json_visitor = basic_batch_to_json_visitor<char>;
+using wbatch_to_json_visitor = basic_batch_to_json_visitor<wchar_t>;
+using event_batch_queue = basic_event_batch_queue<char>;
+using wevent_batch_queue = basic_event_batch_queue<wchar_t>;
+
+} // namespace jsoncons
+
+#endif // JSONCONS_EVENT_BATCH_HPP
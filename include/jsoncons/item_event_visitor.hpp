@@ -30,13 +30,13 @@
 
 namespace jsoncons { 
 
-    template <typename CharT,typename Allocator = std::allocator<char>>
+    template <typename CharT,typename Allocator = std::allocator<char>,typename Visitor = basic_json_visitor<CharT>>
     class basic_item_event_visitor_to_json_visitor;
 
     template <typename CharT>
     class basic_item_event_visitor : public typed_array_visitor
     {
-        template <typename Ch,typename Allocator>
+        template <typename Ch,typename Allocator,typename Visitor>
         friend class basic_item_event_visitor_to_json_visitor;
     public:
         using char_type = CharT;
@@ -770,8 +770,9 @@ namespace jsoncons {
         }
     };
 
- template <typename CharT,typename Allocator>
-    class basic_item_event_visitor_to_json_visitor : public basic_item_event_visitor<CharT>
+    // Visitor may be a concrete visitor type, so that events reach it without virtual dispatch
+    template <typename CharT,typename Allocator,typename Visitor>
+    class basic_item_event_visitor_to_json_visitor final : public basic_item_event_visitor<CharT>
     {
     public:
         using typename basic_item_event_visitor<CharT>::char_type;
@@ -833,7 +834,7 @@ namespace jsoncons {
         using level_allocator_type = typename std::allocator_traits<Allocator>:: template rebind_alloc<level>;
 
         basic_default_json_visitor<char_type> default_visitor_;
-        basic_json_visitor<char_type>* destination_;
+        Visitor* destination_;
         string_type key_;
         string_type key_buffer_;
         std::vector<level,level_allocator_type> level_stack_;
@@ -853,7 +854,7 @@ namespace jsoncons {
             level_stack_.emplace_back(target_t::destination,container_t::root); // root
         }
 
-        explicit basic_item_event_visitor_to_json_visitor(basic_json_visitor<char_type>& visitor, 
+        explicit basic_item_event_visitor_to_json_visitor(Visitor& visitor, 
                                                      const Allocator& alloc = Allocator())
             : destination_(std::addressof(visitor)), 
               key_(alloc), key_buffer_(alloc), level_stack_(alloc)
@@ -869,12 +870,12 @@ namespace jsoncons {
             level_stack_.emplace_back(target_t::destination,container_t::root); // root
         }
 
-        basic_json_visitor<char_type>& destination()
+        Visitor& destination()
         {
             return *destination_;
         }
 
-        void destination(basic_json_visitor<char_type>& dest)
+        void destination(Visitor& dest)
         {
             destination_ = std::addressof(dest);
         }
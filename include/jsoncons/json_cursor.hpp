@@ -12,6 +12,7 @@
 #include <ios>
 #include <memory> // std::allocator
 #include <system_error>
+#include <vector>
 
 #include <jsoncons/config/compiler_support.hpp>
 #include <jsoncons/utility/byte_string.hpp>
@@ -392,6 +393,47 @@ public:
         read_next(ec);
     }
 
+    void skip() final
+    {
+        std::error_code ec;
+        skip(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    void skip(std::error_code& ec) final
+    {
+        if (!is_begin_container(current().event_type()))
+        {
+            return;
+        }
+        parser_.begin_skip();
+        if (!parser_.skipping())
+        {
+            basic_staj_cursor<CharT>::skip(ec);
+            return;
+        }
+        while (parser_.skipping())
+        {
+            if (parser_.source_exhausted())
+            {
+                auto s = source_.read_buffer(ec);
+                if (JSONCONS_UNLIKELY(ec)) {return;}
+                if (s.size() == 0)
+                {
+                    ec = json_errc::unexpected_eof;
+                    return;
+                }
+                parser_.update(s.data(),s.size());
+            }
+            parser_.skip_some(ec);
+            if (JSONCONS_UNLIKELY(ec)) {return;}
+        }
+        read_next(ec);
+    }
+
     void check_done()
     {
         std::error_code ec;
@@ -560,10 +602,278 @@ private:
     }
 };
 
+// A cursor that is fed input with update rather than pulling it from a source.
+// When the buffered input runs out before the next event is complete, next() returns 
+// with need_more_input() true and the parser state intact, so it can be driven from 
+// non-blocking I/O.
+template <typename CharT,typename Allocator=std::allocator<char>>
+class basic_json_push_cursor : public basic_staj_cursor<CharT>, private virtual ser_context
+{
+public:
+    using char_type = CharT;
+    using allocator_type = Allocator;
+    using string_view_type = jsoncons::basic_string_view<CharT>;
+private:
+    using char_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<CharT>;
+
+    basic_json_parser<CharT,Allocator> parser_;
+    basic_staj_visitor<CharT> cursor_visitor_;
+    std::vector<CharT,char_allocator_type> buffer_;
+    bool done_{false};
+    bool eof_{false};
+    bool need_more_input_{true};
+    bool reading_to_{false};
+
+public:
+    basic_json_push_cursor(const basic_json_decode_options<CharT>& options = basic_json_decode_options<CharT>(),
+        const Allocator& alloc = Allocator())
+       : parser_(options, alloc), buffer_(alloc)
+    {
+        parser_.cursor_mode(true);
+    }
+
+    basic_json_push_cursor(const basic_json_push_cursor&) = delete;
+    basic_json_push_cursor(basic_json_push_cursor&&) = default;
+
+    ~basic_json_push_cursor() = default;
+
+    basic_json_push_cursor& operator=(const basic_json_push_cursor&) = delete;
+    basic_json_push_cursor& operator=(basic_json_push_cursor&&) = default;
+
+    // Appends input. Unconsumed input from earlier calls is retained, so the caller 
+    // may reuse its buffer as soon as update returns.
+    void update(const CharT* data, std::size_t length)
+    {
+        std::size_t unread = parser_.source_exhausted() ? 0 : 
+            static_cast<std::size_t>((buffer_.data() + buffer_.size()) - parser_.current());
+        buffer_.erase(buffer_.begin(), buffer_.end() - unread);
+        buffer_.insert(buffer_.end(), data, data + length);
+        parser_.update(buffer_.data(), buffer_.size());
+    }
+
+    void update(string_view_type sv)
+    {
+        update(sv.data(), sv.size());
+    }
+
+    // Indicates that no more input will be supplied
+    void finish()
+    {
+        eof_ = true;
+    }
+
+    bool need_more_input() const
+    {
+        return need_more_input_;
+    }
+
+    void reset()
+    {
+        std::error_code ec;
+        reset(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    void reset(std::error_code& ec)
+    {
+        parser_.reset();
+        cursor_visitor_.reset();
+        done_ = false;
+        reading_to_ = false;
+        read_next(ec);
+    }
+
+    bool done() const final
+    {
+        return parser_.done() || done_;
+    }
+
+    const basic_staj_event<CharT>& current() const final
+    {
+        return cursor_visitor_.event();
+    }
+
+    void read_to(basic_json_visitor<CharT>& visitor) final
+    {
+        std::error_code ec;
+        read_to(visitor, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    // If the input runs out before the matching end event, returns with need_more_input() 
+    // true, and a later call with the same visitor continues where this one stopped.
+    void read_to(basic_json_visitor<CharT>& visitor,
+        std::error_code& ec) final
+    {
+        if (reading_to_ || is_begin_container(current().event_type()))
+        {
+            if (!reading_to_)
+            {
+                parser_.cursor_mode(false);
+                parser_.mark_level(parser_.level());
+                cursor_visitor_.event().send_json_event(visitor, *this, ec);
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    return;
+                }
+                reading_to_ = true;
+            }
+            read_next(visitor, ec);
+            if (JSONCONS_UNLIKELY(ec) || need_more_input_)
+            {
+                return;
+            }
+            reading_to_ = false;
+            parser_.cursor_mode(true);
+            parser_.mark_level(0);
+            if (current().event_type() == staj_events::begin_object)
+            {
+                cursor_visitor_.end_object(*this);
+            }
+            else
+            {
+                cursor_visitor_.end_array(*this);
+            }
+        }
+        else
+        {
+            cursor_visitor_.event().send_json_event(visitor, *this, ec);
+        }
+    }
+
+    void next() final
+    {
+        std::error_code ec;
+        next(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    void next(std::error_code& ec) final
+    {
+        read_next(ec);
+    }
+
+    void skip() final
+    {
+        std::error_code ec;
+        skip(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    // If the input runs out before the matching end event, returns with need_more_input() 
+    // true, and a later call continues the skip.
+    void skip(std::error_code& ec) final
+    {
+        if (!parser_.skipping())
+        {
+            if (reading_to_ || !is_begin_container(current().event_type()))
+            {
+                basic_staj_cursor<CharT>::skip(ec);
+                return;
+            }
+            parser_.begin_skip();
+            if (!parser_.skipping())
+            {
+                basic_staj_cursor<CharT>::skip(ec);
+                return;
+            }
+        }
+        while (parser_.skipping())
+        {
+            if (parser_.source_exhausted())
+            {
+                if (eof_)
+                {
+                    ec = json_errc::unexpected_eof;
+                    return;
+                }
+                need_more_input_ = true;
+                return;
+            }
+            parser_.skip_some(ec);
+            if (JSONCONS_UNLIKELY(ec)) {return;}
+        }
+        read_next(ec);
+    }
+
+    const ser_context& context() const final
+    {
+        return *this;
+    }
+
+    std::size_t line() const final
+    {
+        return parser_.line();
+    }
+
+    std::size_t column() const final
+    {
+        return parser_.column();
+    }
+
+    friend
+    basic_staj_filter_view<CharT> operator|(basic_json_push_cursor& cursor, 
+        std::function<bool(const basic_staj_event<CharT>&, const ser_context&)> pred)
+    {
+        return basic_staj_filter_view<CharT>(cursor, pred);
+    }
+
+private:
+
+    void read_next(std::error_code& ec)
+    {
+        read_next(cursor_visitor_, ec);
+    }
+
+    void read_next(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        need_more_input_ = false;
+        parser_.restart();
+        while (!parser_.stopped())
+        {
+            if (parser_.source_exhausted() && !eof_ && !parser_.accept())
+            {
+                need_more_input_ = true;
+                return;
+            }
+            bool eof = parser_.source_exhausted();
+            parser_.parse_some(visitor, ec);
+            if (JSONCONS_UNLIKELY(ec)) {return;}
+            if (eof)
+            {
+                if (parser_.enter())
+                {
+                    done_ = true;
+                    break;
+                }
+                else if (!parser_.accept())
+                {
+                    ec = json_errc::unexpected_eof;
+                    return;
+                }
+            }
+        }
+    }
+};
+
 using json_stream_cursor = basic_json_cursor<char,jsoncons::stream_source<char>>;
 using json_string_cursor = basic_json_cursor<char,jsoncons::string_source<char>>;
 using wjson_stream_cursor = basic_json_cursor<wchar_t,jsoncons::stream_source<wchar_t>>;
 using wjson_string_cursor = basic_json_cursor<wchar_t,jsoncons::string_source<wchar_t>>;
+using json_push_cursor = basic_json_push_cursor<char>;
+using wjson_push_cursor = basic_json_push_cursor<wchar_t>;
 
 } // namespace jsoncons
 
@@ -103,6 +103,18 @@ enum class parse_number_state : uint8_t
     exp3
 };
 
+enum class parse_skip_state : uint8_t 
+{
+    value,
+    string,
+    escape,
+    cr,
+    slash,
+    slash_slash,
+    slash_star,
+    slash_star_star
+};
+
 template <typename CharT,typename TempAlloc  = std::allocator<char>>
 class basic_json_parser : public ser_context
 {
@@ -146,6 +158,9 @@ private:
     parse_state state_{parse_state::start};
     parse_string_state string_state_{};
     parse_number_state number_state_{};
+    parse_skip_state skip_state_{};
+    int skip_level_{0};
+    bool skipping_{false};
     bool more_{true};
     bool done_{false};
     bool cursor_mode_{false};
@@ -357,7 +372,8 @@ public:
         }
     }
 
-    void begin_object(basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    template <typename Visitor>
+    void begin_object(Visitor& visitor, std::error_code& ec)
     {
         if (JSONCONS_UNLIKELY(++level_ > max_nesting_depth_))
         {
@@ -375,7 +391,8 @@ public:
         more_ = !cursor_mode_;
     }
 
-    void end_object(basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    template <typename Visitor>
+    void end_object(Visitor& visitor, std::error_code& ec)
     {
         if (JSONCONS_UNLIKELY(level_ < 1))
         {
@@ -421,7 +438,8 @@ public:
         }
     }
 
-    void begin_array(basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    template <typename Visitor>
+    void begin_array(Visitor& visitor, std::error_code& ec)
     {
         if (++level_ > max_nesting_depth_)
         {
@@ -441,7 +459,8 @@ public:
         more_ = !cursor_mode_;
     }
 
-    void end_array(basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    template <typename Visitor>
+    void end_array(Visitor& visitor, std::error_code& ec)
     {
         if (level_ < 1)
         {
@@ -488,6 +507,187 @@ public:
         }
     }
 
+    void begin_skip()
+    {
+        skip_state_ = parse_skip_state::value;
+        skip_level_ = 0;
+        skipping_ = state_ == parse_state::expect_member_name_or_end || state_ == parse_state::expect_value_or_end;
+    }
+
+    bool skipping() const
+    {
+        return skipping_;
+    }
+
+    // Advances over the remaining members or elements of the innermost object or array,
+    // looking only at brackets, string delimiters, comments and line breaks, and stops 
+    // with the closing bracket as the next input character. The skipped text is not 
+    // otherwise validated.
+    void skip_some(std::error_code& ec)
+    {
+        const char_type* local_input_end = input_end_;
+
+        while (input_ptr_ < local_input_end && skipping_)
+        {
+            switch (skip_state_)
+            {
+                case parse_skip_state::value:
+                    switch (*input_ptr_)
+                    {
+                        case '{':
+                        case '[':
+                            if (JSONCONS_UNLIKELY(level_ + (++skip_level_) > max_nesting_depth_))
+                            {
+                                more_ = false;
+                                skipping_ = false;
+                                ec = json_errc::max_nesting_depth_exceeded;
+                                return;
+                            }
+                            ++input_ptr_;
+                            ++position_;
+                            break;
+                        case '}':
+                        case ']':
+                            if (skip_level_ == 0)
+                            {
+                                state_ = parse_state::expect_comma_or_end;
+                                skipping_ = false;
+                                return;
+                            }
+                            --skip_level_;
+                            ++input_ptr_;
+                            ++position_;
+                            break;
+                        case '\"':
+                            skip_state_ = parse_skip_state::string;
+                            ++input_ptr_;
+                            ++position_;
+                            break;
+                        case '/':
+                            if (allow_comments_)
+                            {
+                                skip_state_ = parse_skip_state::slash;
+                            }
+                            ++input_ptr_;
+                            ++position_;
+                            break;
+                        case '\n':
+                            ++input_ptr_;
+                            ++position_;
+                            ++line_;
+                            mark_position_ = position_;
+                            break;
+                        case '\r':
+                            skip_state_ = parse_skip_state::cr;
+                            ++input_ptr_;
+                            ++position_;
+                            break;
+                        default:
+                            ++input_ptr_;
+                            ++position_;
+                            break;
+                    }
+                    break;
+                case parse_skip_state::string:
+                {
+                    const char_type* cur = input_ptr_;
+                    while (cur < local_input_end && *cur != '\"' && *cur != '\\')
+                    {
+                        ++cur;
+                    }
+                    position_ += (cur - input_ptr_);
+                    input_ptr_ = cur;
+                    if (cur < local_input_end)
+                    {
+                        skip_state_ = *cur == '\"' ? parse_skip_state::value : parse_skip_state::escape;
+                        ++input_ptr_;
+                        ++position_;
+                    }
+                    break;
+                }
+                case parse_skip_state::escape:
+                    skip_state_ = parse_skip_state::string;
+                    ++input_ptr_;
+                    ++position_;
+                    break;
+                case parse_skip_state::cr:
+                    ++line_;
+                    if (*input_ptr_ == '\n')
+                    {
+                        ++input_ptr_;
+                        ++position_;
+                    }
+                    mark_position_ = position_;
+                    skip_state_ = parse_skip_state::value;
+                    break;
+                case parse_skip_state::slash:
+                    switch (*input_ptr_)
+                    {
+                        case '/':
+                            skip_state_ = parse_skip_state::slash_slash;
+                            ++input_ptr_;
+                            ++position_;
+                            break;
+                        case '*':
+                            skip_state_ = parse_skip_state::slash_star;
+                            ++input_ptr_;
+                            ++position_;
+                            break;
+                        default:
+                            skip_state_ = parse_skip_state::value;
+                            break;
+                    }
+                    break;
+                case parse_skip_state::slash_slash:
+                    switch (*input_ptr_)
+                    {
+                        case '\n':
+                        case '\r':
+                            skip_state_ = parse_skip_state::value;
+                            break;
+                        default:
+                            ++input_ptr_;
+                            ++position_;
+                            break;
+                    }
+                    break;
+                case parse_skip_state::slash_star:
+                    switch (*input_ptr_)
+                    {
+                        case '*':
+                            skip_state_ = parse_skip_state::slash_star_star;
+                            break;
+                        case '\n':
+                            ++line_;
+                            mark_position_ = position_ + 1;
+                            break;
+                        default:
+                            break;
+                    }
+                    ++input_ptr_;
+                    ++position_;
+                    break;
+                case parse_skip_state::slash_star_star:
+                    switch (*input_ptr_)
+                    {
+                        case '/':
+                            skip_state_ = parse_skip_state::value;
+                            ++input_ptr_;
+                            ++position_;
+                            break;
+                        case '*':
+                            ++input_ptr_;
+                            ++position_;
+                            break;
+                        default:
+                            skip_state_ = parse_skip_state::slash_star;
+                            break;
+                    }
+                    break;
+            }
+        }
+    }
+
     void reinitialize()
     {
         reset();
@@ -510,6 +710,7 @@ public:
         position_ = 0;
         mark_position_ = 0;
         level_ = 0;
+        skipping_ = false;
     }
 
     void restart()
@@ -562,7 +763,8 @@ public:
         input_ptr_ = data;
     }
 
-    void parse_some(basic_json_visitor<char_type>& visitor)
+    template <typename Visitor>
+    void parse_some(Visitor& visitor)
     {
         std::error_code ec;
         parse_some(visitor, ec);
@@ -572,12 +774,14 @@ public:
         }
     }
 
-    void parse_some(basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    template <typename Visitor>
+    void parse_some(Visitor& visitor, std::error_code& ec)
     {
         parse_some_(visitor, ec);
     }
 
-    void finish_parse(basic_json_visitor<char_type>& visitor)
+    template <typename Visitor>
+    void finish_parse(Visitor& visitor)
     {
         std::error_code ec;
         finish_parse(visitor, ec);
@@ -587,7 +791,8 @@ public:
         }
     }
 
-    void finish_parse(basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    template <typename Visitor>
+    void finish_parse(Visitor& visitor, std::error_code& ec)
     {
         while (!finished())
         {
@@ -596,7 +801,8 @@ public:
         }
     }
 
-    void parse_some_(basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    template <typename Visitor>
+    void parse_some_(Visitor& visitor, std::error_code& ec)
     {
         if (state_ == parse_state::accept)
         {
@@ -1614,7 +1820,8 @@ public:
         }
     }
 
-    const char_type* parse_true(const char_type* cur, basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    template <typename Visitor>
+    const char_type* parse_true(const char_type* cur, Visitor& visitor, std::error_code& ec)
     {
         begin_position_ = position_;
         if (JSONCONS_LIKELY(input_end_ - cur >= 4))
@@ -1652,7 +1859,8 @@ public:
         return cur;
     }
 
-    void parse_null(basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    template <typename Visitor>
+    void parse_null(Visitor& visitor, std::error_code& ec)
     {
         begin_position_ = position_;
         if (JSONCONS_LIKELY(input_end_ - input_ptr_ >= 4))
@@ -1689,7 +1897,8 @@ public:
         }
     }
 
-    const char_type* parse_false(const char_type* cur, basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    template <typename Visitor>
+    const char_type* parse_false(const char_type* cur, Visitor& visitor, std::error_code& ec)
     {
         begin_position_ = position_;
         if (JSONCONS_LIKELY(input_end_ - cur >= 5))
@@ -1727,7 +1936,8 @@ public:
         return cur;
     }
 
-    const char_type* parse_number(const char_type* hdr, basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    template <typename Visitor>
+    const char_type* parse_number(const char_type* hdr, Visitor& visitor, std::error_code& ec)
     {
         const char_type* cur = hdr;
         const char_type* local_input_end = input_end_;
@@ -1951,7 +2161,8 @@ exp3:
         return cur;
     }
 
-    const char_type* parse_string(const char_type* cur, basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    template <typename Visitor>
+    const char_type* parse_string(const char_type* cur, Visitor& visitor, std::error_code& ec)
     {
         const char_type* local_input_end = input_end_;
         const char_type* sb = cur;
@@ -2453,7 +2664,8 @@ private:
         *ptr = cur;
     }
 
-    void end_integer_value(basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    template <typename Visitor>
+    void end_integer_value(Visitor& visitor, std::error_code& ec)
     {
         if (buffer_[0] == '-')
         {
@@ -2465,7 +2677,8 @@ private:
         }
     }
 
-    void end_negative_value(basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    template <typename Visitor>
+    void end_negative_value(Visitor& visitor, std::error_code& ec)
     {
         int64_t val;
         auto result = jsoncons::dec_to_integer(buffer_.data(), buffer_.length(), val);
@@ -2507,7 +2720,8 @@ private:
         after_value(ec);
     }
 
-    void end_positive_value(basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    template <typename Visitor>
+    void end_positive_value(Visitor& visitor, std::error_code& ec)
     {
         uint64_t val;
         auto result = jsoncons::dec_to_integer(buffer_.data(), buffer_.length(), val);
@@ -2549,7 +2763,8 @@ private:
         after_value(ec);
     }
 
-    void end_fraction_value(basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    template <typename Visitor>
+    void end_fraction_value(Visitor& visitor, std::error_code& ec)
     {
         if (lossless_number_)
         {
@@ -2590,7 +2805,8 @@ private:
         after_value(ec);
     }
 
-    void end_string_value(const char_type* s, std::size_t length, basic_json_visitor<char_type>& visitor, std::error_code& ec) 
+    template <typename Visitor>
+    void end_string_value(const char_type* s, std::size_t length, Visitor& visitor, std::error_code& ec) 
     {
         string_view_type sv(s, length);
         auto result = unicode_traits::validate(s, length);
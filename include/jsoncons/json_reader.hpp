@@ -166,7 +166,10 @@ namespace jsoncons {
         }
     };
 
-    template <typename CharT,typename Source=jsoncons::stream_source<CharT>,typename TempAlloc =std::allocator<char>>
+    // Visitor may be a concrete visitor type, e.g. an encoder, so that the parser's calls
+    // reach it without virtual dispatch
+    template <typename CharT,typename Source=jsoncons::stream_source<CharT>,typename TempAlloc =std::allocator<char>,
+        typename Visitor=basic_json_visitor<CharT>>
     class basic_json_reader 
     {
     public:
@@ -180,7 +183,7 @@ namespace jsoncons {
 
         json_source_adaptor<Source> source_;
         basic_default_json_visitor<CharT> default_visitor_;
-        basic_json_visitor<CharT>& visitor_;
+        Visitor& visitor_;
         basic_json_parser<CharT,TempAlloc> parser_;
 
         // Noncopyable and nonmoveable
@@ -202,7 +205,7 @@ namespace jsoncons {
 
         template <typename Sourceable>
         basic_json_reader(Sourceable&& source, 
-            basic_json_visitor<CharT>& visitor, 
+            Visitor& visitor, 
             const TempAlloc& temp_alloc = TempAlloc())
             : basic_json_reader(std::forward<Sourceable>(source),
                                 visitor,
@@ -213,7 +216,7 @@ namespace jsoncons {
 
         template <typename Sourceable>
         basic_json_reader(Sourceable&& source, 
-            basic_json_visitor<CharT>& visitor,
+            Visitor& visitor,
             const basic_json_decode_options<CharT>& options, 
             const TempAlloc& temp_alloc = TempAlloc())
         : source_(std::forward<Sourceable>(source)),
@@ -238,7 +241,7 @@ namespace jsoncons {
 
         template <typename Sourceable>
         basic_json_reader(Sourceable&& source,
-                          basic_json_visitor<CharT>& visitor,
+                          Visitor& visitor,
                           std::function<bool(json_errc,const ser_context&)> err_handler, 
                           const TempAlloc& temp_alloc = TempAlloc())
             : basic_json_reader(std::forward<Sourceable>(source),
@@ -251,7 +254,7 @@ namespace jsoncons {
 
         template <typename Sourceable>
         basic_json_reader(Sourceable&& source,
-                          basic_json_visitor<CharT>& visitor, 
+                          Visitor& visitor, 
                           const basic_json_decode_options<CharT>& options,
                           std::function<bool(json_errc,const ser_context&)> err_handler, 
                           const TempAlloc& temp_alloc = TempAlloc())
@@ -14,6 +14,7 @@
 #include <ostream>
 #include <vector>
 
+#include <jsoncons/config/compiler_support.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
 #include <jsoncons/utility/more_type_traits.hpp>
 
@@ -224,6 +225,35 @@ namespace jsoncons {
                 *p_++ = ch;
             }
         }
+
+        // True if the underlying stream reports a position, e.g. a file or string stream
+        bool is_seekable() const
+        {
+            return stream_ptr_->tellp() != std::basic_ostream<char>::pos_type(-1);
+        }
+
+        std::size_t position() const
+        {
+            return static_cast<std::size_t>(stream_ptr_->tellp()) + buffer_length();
+        }
+
+        // Overwrites length bytes previously written at position pos 
+        void overwrite(std::size_t pos, const uint8_t* s, std::size_t length)
+        {
+            auto base = static_cast<std::size_t>(stream_ptr_->tellp());
+            if (pos >= base)
+            {
+                std::memcpy(begin_buffer_ + (pos - base), s, length*sizeof(uint8_t));
+            }
+            else
+            {
+                flush();
+                auto end = stream_ptr_->tellp();
+                stream_ptr_->seekp(static_cast<std::streamoff>(pos));
+                stream_ptr_->write((const char*)s, length);
+                stream_ptr_->seekp(end);
+            }
+        }
     private:
 
         std::size_t buffer_length() const
@@ -329,8 +359,151 @@ namespace jsoncons {
         {
             buf_ptr->push_back(static_cast<value_type>(ch));
         }
+
+        bool is_seekable() const
+        {
+            return true;
+        }
+
+        std::size_t position() const
+        {
+            return buf_ptr->size();
+        }
+
+        // Overwrites length bytes previously written at position pos 
+        void overwrite(std::size_t pos, const uint8_t* s, std::size_t length)
+        {
+            auto it = buf_ptr->begin() + pos;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                *it++ = static_cast<value_type>(s[i]);
+            }
+        }
     };
 
+    // counting_sink
+
+    // Counts the bytes written to it without storing them
+    class counting_sink
+    {
+    public:
+        using value_type = uint8_t;
+    private:
+        std::size_t* count_ptr_;
+    public:
+        counting_sink(const counting_sink&) = delete;
+
+        counting_sink(counting_sink&&) = default;
+
+        explicit counting_sink(std::size_t& count)
+            : count_ptr_(std::addressof(count))
+        {
+        }
+
+        ~counting_sink() = default;
+
+        counting_sink& operator=(const counting_sink&) = delete;
+        counting_sink& operator=(counting_sink&&) = default;
+
+        void flush()
+        {
+        }
+
+        void push_back(uint8_t)
+        {
+            ++(*count_ptr_);
+        }
+    };
+
+    // fixed_bytes_sink
+
+    // Writes to a caller provided buffer that does not grow. Bytes past the end of the
+    // buffer are counted but not written, so length exceeding capacity indicates overflow.
+    class fixed_bytes_sink
+    {
+    public:
+        using value_type = uint8_t;
+    private:
+        uint8_t* data_;
+        std::size_t capacity_;
+        std::size_t* length_ptr_;
+    public:
+        fixed_bytes_sink(const fixed_bytes_sink&) = delete;
+
+        fixed_bytes_sink(fixed_bytes_sink&&) = default;
+
+        fixed_bytes_sink(uint8_t* data, std::size_t capacity, std::size_t& length)
+            : data_(data), capacity_(capacity), length_ptr_(std::addressof(length))
+        {
+        }
+
+        ~fixed_bytes_sink() = default;
+
+        fixed_bytes_sink& operator=(const fixed_bytes_sink&) = delete;
+        fixed_bytes_sink& operator=(fixed_bytes_sink&&) = default;
+
+        void flush()
+        {
+        }
+
+        void push_back(uint8_t ch)
+        {
+            if (JSONCONS_LIKELY(*length_ptr_ < capacity_))
+            {
+                data_[*length_ptr_] = ch;
+            }
+            ++(*length_ptr_);
+        }
+
+        bool is_seekable() const
+        {
+            return true;
+        }
+
+        std::size_t position() const
+        {
+            return *length_ptr_;
+        }
+
+        // Overwrites length bytes previously written at position pos 
+        void overwrite(std::size_t pos, const uint8_t* s, std::size_t length)
+        {
+            for (std::size_t i = 0; i < length && pos + i < capacity_; ++i)
+            {
+                data_[pos + i] = s[i];
+            }
+        }
+    };
+
+    template <typename Sink>
+    using sink_overwrite_t = decltype(std::declval<Sink&>().overwrite(std::size_t(), std::declval<const uint8_t*>(), std::size_t()));
+
+    // Sinks that can overwrite bytes already written, if is_seekable() returns true
+    template <typename Sink>
+    using is_seekable_sink = ext_traits::is_detected<sink_overwrite_t,Sink>;
+
+namespace detail {
+
+    // Reserves length bytes in an empty container that has reserve(), so that appending
+    // to a non-empty container keeps its own growth policy
+    template <typename Container>
+    typename std::enable_if<ext_traits::has_reserve<Container>::value>::type
+    reserve_if_empty(Container& cont, std::size_t length)
+    {
+        if (cont.empty())
+        {
+            cont.reserve(length);
+        }
+    }
+
+    template <typename Container>
+    typename std::enable_if<!ext_traits::has_reserve<Container>::value>::type
+    reserve_if_empty(Container&, std::size_t)
+    {
+    }
+
+} // namespace detail
+
 } // namespace jsoncons
 
 #endif // JSONCONS_SINK_HPP
@@ -712,6 +712,19 @@ namespace jsoncons {
             return span<const value_type>(data, length);
         }
 
+        // Returns a view of up to length bytes of the input, without copying
+        span<const value_type> read_buffer(std::size_t length) 
+        {
+            const value_type* data = current_;
+            if (std::size_t(end_ - current_) < length)
+            {
+                length = end_ - current_;
+            }
+            current_ += length;
+
+            return span<const value_type>(data, length);
+        }
+
         std::size_t read(value_type* p, std::size_t length)
         {
             std::size_t len;
@@ -843,12 +856,27 @@ namespace jsoncons {
         }
     };
 
+    template <typename Source>
+    using source_read_buffer_t = decltype(std::declval<Source&>().read_buffer(std::size_t()));
+
+    // Sources over contiguous memory that can return a view of their input
+    template <typename Source>
+    using is_contiguous_source = ext_traits::is_detected<source_read_buffer_t,Source>;
+
     template <typename Source>
     struct source_reader
     {
         using value_type = typename Source::value_type;
         static constexpr std::size_t max_buffer_length = 16384;
 
+        // Reads up to length values. For contiguous sources, returns a view into
+        // the input, otherwise replaces the contents of buffer and returns a view of it.
+        template <typename Container>
+        static span<const typename Container::value_type> read_view(Source& source, Container& buffer, std::size_t length)
+        {
+            return read_view(source, buffer, length, std::integral_constant<bool,is_contiguous_source<Source>::value>());
+        }
+
         template <typename Container>
         static
         typename std::enable_if<std::is_convertible<value_type,typename Container::value_type>::value &&
@@ -903,6 +931,25 @@ namespace jsoncons {
 
             return length - unread;
         }
+
+    private:
+        template <typename Container>
+        static span<const typename Container::value_type> read_view(Source& source, Container&, 
+            std::size_t length, std::true_type)
+        {
+            static_assert(sizeof(typename Container::value_type) == sizeof(value_type), "Expected a byte container");
+            auto s = source.read_buffer(length);
+            return span<const typename Container::value_type>(reinterpret_cast<const typename Container::value_type*>(s.data()), s.size());
+        }
+
+        template <typename Container>
+        static span<const typename Container::value_type> read_view(Source& source, Container& buffer, 
+            std::size_t length, std::false_type)
+        {
+            buffer.clear();
+            read(source, buffer, length);
+            return span<const typename Container::value_type>(buffer.data(), buffer.size());
+        }
     };
 #if __cplusplus >= 201703L
 // not needed for C++17
@@ -7,9 +7,11 @@
 #ifndef JSONCONS_STAJ_CURSOR_HPP
 #define JSONCONS_STAJ_CURSOR_HPP
 
+#include <algorithm> // std::copy
 #include <array> // std::array
 #include <cstddef>
 #include <cstdint>
+#include <cstring> // std::memcpy
 #include <functional> // std::function
 #include <ios>
 #include <memory> // std::allocator
@@ -282,6 +284,29 @@ public:
 
     virtual void next(std::error_code& ec) = 0;
 
+    virtual void skip()
+    {
+        std::error_code ec;
+        skip(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,line(),column()));
+        }
+    }
+
+    // If the current event is begin_object or begin_array, advances to the
+    // matching end event without reporting the events inbetween.
+    // Otherwise does nothing. Derived cursors override this to skip at
+    // the byte level.
+    virtual void skip(std::error_code& ec)
+    {
+        if (is_begin_container(current().event_type()))
+        {
+            basic_default_json_visitor<CharT> visitor;
+            read_to(visitor, ec);
+        }
+    }
+
     virtual const ser_context& context() const = 0;
     
     virtual std::size_t line() const = 0;
@@ -326,222 +351,262 @@ public:
     typename std::enable_if<ext_traits::is_back_insertable<T>::value,void>::type
     read_typed_array(T& v)
     {
-        using value_type = typename T::value_type;
-
         if (is_typed_array())
         {
+            v.clear();
             switch (array_tag())
             {
                 case typed_array_tags::int8:
-                {
-                    auto ta = typed_array_cast<const int8_t>(array_buffer());
-                    if (std::is_same<value_type, int8_t>::value)
-                    {
-                        v.resize(ta.size());
-                        std::memcpy(v.data(), ta.data(), ta.size()*sizeof(value_type));
-                    }
-                    else
-                    {
-                        v.reserve(ta.size());
-                        for (auto item : ta)
-                        {
-                            v.push_back(static_cast<value_type>(item));
-                        }
-                    }
+                    copy_typed_array(typed_array_cast<const int8_t>(array_buffer()), v);
                     break;
-                }
                 case typed_array_tags::int16:
-                {
-                    auto ta = typed_array_cast<const int16_t>(array_buffer());
-                    if (std::is_same<value_type, int16_t>::value)
-                    {
-                        v.resize(ta.size());
-                        std::memcpy(v.data(), ta.data(), ta.size()*sizeof(value_type));
-                    }
-                    else
-                    {
-                        v.reserve(ta.size());
-                        for (auto item : ta)
-                        {
-                            v.push_back(static_cast<value_type>(item));
-                        }
-                    }
+                    copy_typed_array(typed_array_cast<const int16_t>(array_buffer()), v);
                     break;
-                }
                 case typed_array_tags::int32:
-                {
-                    auto ta = typed_array_cast<const int32_t>(array_buffer());
-                    if (std::is_same<value_type, int32_t>::value)
-                    {
-                        v.resize(ta.size());
-                        std::memcpy(v.data(), ta.data(), ta.size()*sizeof(value_type));
-                    }
-                    else
-                    {
-                        v.reserve(ta.size());
-                        for (auto item : ta)
-                        {
-                            v.push_back(static_cast<value_type>(item));
-                        }
-                    }
+                    copy_typed_array(typed_array_cast<const int32_t>(array_buffer()), v);
                     break;
-                }
                 case typed_array_tags::int64:
-                {
-                    auto ta = typed_array_cast<const int64_t>(array_buffer());
-                    if (std::is_same<value_type, int64_t>::value)
-                    {
-                        v.resize(ta.size());
-                        std::memcpy(v.data(), ta.data(), ta.size()*sizeof(value_type));
-                    }
-                    else
-                    {
-                        v.reserve(ta.size());
-                        for (auto item : ta)
-                        {
-                            v.push_back(static_cast<value_type>(item));
-                        }
-                    }
+                    copy_typed_array(typed_array_cast<const int64_t>(array_buffer()), v);
                     break;
-                }
                 case typed_array_tags::uint8:
-                {
-                    auto ta = typed_array_cast<const uint8_t>(array_buffer());
-                    if (std::is_same<value_type, uint8_t>::value)
-                    {
-                        v.resize(ta.size());
-                        std::memcpy(v.data(), ta.data(), ta.size()*sizeof(value_type));
-                    }
-                    else
-                    {
-                        v.reserve(ta.size());
-                        for (auto item : ta)
-                        {
-                            v.push_back(static_cast<value_type>(item));
-                        }
-                    }
+                    copy_typed_array(typed_array_cast<const uint8_t>(array_buffer()), v);
                     break;
-                }
                 case typed_array_tags::uint16:
-                {
-                    auto ta = typed_array_cast<const uint16_t>(array_buffer());
-                    if (std::is_same<value_type, uint16_t>::value)
-                    {
-                        v.resize(ta.size());
-                        std::memcpy(v.data(), ta.data(), ta.size()*sizeof(value_type));
-                    }
-                    else
-                    {
-                        v.reserve(ta.size());
-                        for (auto item : ta)
-                        {
-                            v.push_back(static_cast<value_type>(item));
-                        }
-                    }
+                    copy_typed_array(typed_array_cast<const uint16_t>(array_buffer()), v);
                     break;
-                }
                 case typed_array_tags::uint32:
-                {
-                    auto ta = typed_array_cast<const uint32_t>(array_buffer());
-                    if (std::is_same<value_type, uint32_t>::value)
-                    {
-                        v.resize(ta.size());
-                        std::memcpy(v.data(), ta.data(), ta.size()*sizeof(value_type));
-                    }
-                    else
-                    {
-                        v.reserve(ta.size());
-                        for (auto item : ta)
-                        {
-                            v.push_back(static_cast<value_type>(item));
-                        }
-                    }
+                    copy_typed_array(typed_array_cast<const uint32_t>(array_buffer()), v);
                     break;
-                }
                 case typed_array_tags::uint64:
-                {
-                    auto ta = typed_array_cast<const uint64_t>(array_buffer());
-                    if (std::is_same<value_type, uint64_t>::value)
-                    {
-                        v.resize(ta.size());
-                        std::memcpy(v.data(), ta.data(), ta.size()*sizeof(value_type));
-                    }
-                    else
-                    {
-                        v.reserve(ta.size());
-                        for (auto item : ta)
-                        {
-                            v.push_back(static_cast<value_type>(item));
-                        }
-                    }
+                    copy_typed_array(typed_array_cast<const uint64_t>(array_buffer()), v);
                     break;
-                }
                 case typed_array_tags::half_float:
-                {
-                    auto ta = typed_array_cast<const int16_t>(array_buffer());
-                    if (std::is_same<value_type, int16_t>::value)
-                    {
-                        v.resize(ta.size());
-                        std::memcpy(v.data(), ta.data(), ta.size()*sizeof(value_type));
-                    }
-                    else if (std::is_floating_point<value_type>::value)
-                    {
-                        v.reserve(ta.size());
-                        for (auto item : ta)
-                        {
-                            v.push_back(static_cast<value_type>(binary::decode_half(item)));
-                        }
-                    }
-                    else
-                    {
-                        v.reserve(ta.size());
-                        for (auto item : ta)
-                        {
-                            v.push_back(static_cast<value_type>(item));
-                        }
-                    }
+                    copy_half_float_array(typed_array_cast<const int16_t>(array_buffer()), v, 
+                        std::is_floating_point<typename T::value_type>());
                     break;
-                }
                 case typed_array_tags::float32:
-                {
-                    auto ta = typed_array_cast<const float>(array_buffer());
-                    if (std::is_same<value_type, float>::value)
-                    {
-                        v.resize(ta.size());
-                        std::memcpy(v.data(), ta.data(), ta.size()*sizeof(value_type));
-                    }
-                    else
-                    {
-                        v.reserve(ta.size());
-                        for (auto item : ta)
-                        {
-                            v.push_back(static_cast<value_type>(item));
-                        }
-                    }
+                    copy_typed_array(typed_array_cast<const float>(array_buffer()), v);
                     break;
-                }
                 case typed_array_tags::float64 :
+                    copy_typed_array(typed_array_cast<const double>(array_buffer()), v);
+                    break;
+                default:
+                    break;
+            }
+            to_end_array();
+        }
+    }
+
+    // Reads a multi-dimensional array into a flat buffer in row-major order, and its extents.
+    // Leaves the cursor at the end_array event.
+    template <typename T>
+    typename std::enable_if<ext_traits::is_back_insertable<T>::value,void>::type
+    read_mdarray(T& v, std::vector<std::size_t>& extents, std::error_code& ec)
+    {
+        using value_type = typename T::value_type;
+
+        if (!is_multi_dim())
+        {
+            ec = conv_errc::not_vector;
+            return;
+        }
+        auto ext = this->extents();
+        extents.assign(ext.begin(), ext.end());
+        const bool column_major = order() == mdarray_order::column_major;
+        v.clear();
+        if (is_typed_array())
+        {
+            read_typed_array(v);
+        }
+        else
+        {
+            read_classical_array(v, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+        }
+        std::size_t count = 1;
+        for (auto n : extents)
+        {
+            count *= n;
+        }
+        if (JSONCONS_UNLIKELY(v.size() != count))
+        {
+            ec = conv_errc::invalid_mdarray;
+            return;
+        }
+        if (column_major && extents.size() > 1)
+        {
+            std::vector<value_type> row_major(count);
+            transpose_to_row_major(v.begin(), extents, row_major.data());
+            std::copy(row_major.begin(), row_major.end(), v.begin());
+        }
+    }
+
+    template <typename T>
+    typename std::enable_if<ext_traits::is_back_insertable<T>::value,void>::type
+    read_mdarray(T& v, std::vector<std::size_t>& extents)
+    {
+        std::error_code ec;
+        read_mdarray(v, extents, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,line(),column()));
+        }
+    }
+
+private:
+    // Reads the elements of an array with classical storage, in storage order
+    template <typename T>
+    void read_classical_array(T& v, std::error_code& ec)
+    {
+        using value_type = typename T::value_type;
+
+        int depth = 0;
+        do 
+        {
+            switch (current().event_type())
+            {
+                case staj_events::begin_array:
+                    ++depth;
+                    break;
+                case staj_events::end_array:
+                    --depth;
+                    break;
+                case staj_events::uint64_value:
+                case staj_events::int64_value:
+                case staj_events::half_value:
+                case staj_events::double_value:
                 {
-                    auto ta = typed_array_cast<const double>(array_buffer());
-                    if (std::is_same<value_type, double>::value)
-                    {
-                        v.resize(ta.size());
-                        std::memcpy(v.data(), ta.data(), ta.size()*sizeof(value_type));
-                    }
-                    else
+                    auto val = current().template get<value_type>(ec);
+                    if (JSONCONS_UNLIKELY(ec))
                     {
-                        v.reserve(ta.size());
-                        for (auto item : ta)
-                        {
-                            v.push_back(static_cast<value_type>(item));
-                        }
+                        return;
                     }
+                    v.push_back(val);
                     break;
                 }
                 default:
+                    ec = conv_errc::not_vector;
+                    return;
+            }
+            if (depth > 0)
+            {
+                next(ec);
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    return;
+                }
+            }
+        } 
+        while (depth > 0 && !done());
+    }
+
+    // Containers with contiguous storage are resized once and filled in place
+    template <typename U, typename T>
+    static void copy_typed_array(jsoncons::span<const U> ta, T& v)
+    {
+        copy_typed_array(ta, v, std::integral_constant<bool, ext_traits::has_data_exact<typename T::value_type*,T>::value>());
+    }
+
+    template <typename U, typename T>
+    static void copy_typed_array(jsoncons::span<const U> ta, T& v, std::true_type)
+    {
+        using value_type = typename T::value_type;
+
+        v.resize(ta.size());
+        value_type* p = v.data();
+        if (std::is_same<value_type,U>::value)
+        {
+            if (ta.size() > 0)
+            {
+                std::memcpy(p, ta.data(), ta.size()*sizeof(U));
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < ta.size(); ++i)
+            {
+                p[i] = static_cast<value_type>(ta[i]);
+            }
+        }
+    }
+
+    template <typename U, typename T>
+    static void copy_typed_array(jsoncons::span<const U> ta, T& v, std::false_type)
+    {
+        using value_type = typename T::value_type;
+
+        reserve_storage(v, ta.size(), std::integral_constant<bool, ext_traits::has_reserve<T>::value>());
+        for (auto item : ta)
+        {
+            v.push_back(static_cast<value_type>(item));
+        }
+    }
+
+    template <typename T>
+    static void copy_half_float_array(jsoncons::span<const int16_t> ta, T& v, std::true_type)
+    {
+        using value_type = typename T::value_type;
+
+        reserve_storage(v, ta.size(), std::integral_constant<bool, ext_traits::has_reserve<T>::value>());
+        for (auto item : ta)
+        {
+            v.push_back(static_cast<value_type>(binary::decode_half(static_cast<uint16_t>(item))));
+        }
+    }
+
+    template <typename T>
+    static void copy_half_float_array(jsoncons::span<const int16_t> ta, T& v, std::false_type)
+    {
+        copy_typed_array(ta, v);
+    }
+
+    template <typename T>
+    static void reserve_storage(T& v, std::size_t n, std::true_type)
+    {
+        v.reserve(v.size() + n);
+    }
+
+    template <typename T>
+    static void reserve_storage(T&, std::size_t, std::false_type)
+    {
+    }
+
+    // Writes the elements of column-major storage to their row-major positions in out.
+    // The number of elements must equal the product of the extents.
+    template <typename InputIt, typename ValueType>
+    static void transpose_to_row_major(InputIt first, const std::vector<std::size_t>& extents, ValueType* out)
+    {
+        const std::size_t rank = extents.size();
+        std::vector<std::size_t> index(rank, 0);
+        std::vector<std::size_t> strides(rank, 1);
+        for (std::size_t i = rank-1; i-- > 0; )
+        {
+            strides[i] = strides[i+1]*extents[i+1];
+        }
+        std::size_t count = 1;
+        for (auto n : extents)
+        {
+            count *= n;
+        }
+        for (std::size_t k = 0; k < count; ++k, ++first)
+        {
+            std::size_t pos = 0;
+            for (std::size_t i = 0; i < rank; ++i)
+            {
+                pos += index[i]*strides[i];
+            }
+            out[pos] = *first;
+            for (std::size_t i = 0; i < rank; ++i)
+            {
+                if (++index[i] < extents[i])
+                {
                     break;
+                }
+                index[i] = 0;
             }
-            to_end_array();
         }
     }
 };
@@ -601,6 +666,16 @@ public:
         }
     }
 
+    void skip() override
+    {
+        cursor_->skip();
+    }
+
+    void skip(std::error_code& ec) override
+    {
+        cursor_->skip(ec);
+    }
+
     const ser_context& context() const override
     {
         return cursor_->context();
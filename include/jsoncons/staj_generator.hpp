@@ -0,0 +1,390 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_STAJ_GENERATOR_HPP
+#define JSONCONS_STAJ_GENERATOR_HPP
+
+#include <jsoncons/config/compiler_support.hpp>
+
+#if defined(JSONCONS_HAS_COROUTINES)
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/conv_error.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/reflect/decode_traits.hpp>
+#include <jsoncons/staj_cursor.hpp>
+#include <jsoncons/staj_event.hpp>
+#include <jsoncons/utility/more_type_traits.hpp>
+
+namespace jsoncons {
+
+namespace detail {
+
+    // Yielded by a generator body when a push cursor has run out of input
+    struct staj_starved
+    {
+    };
+
+    // Yielded by a generator body to record an error, the body is not resumed after it
+    struct staj_failed
+    {
+        std::error_code ec;
+    };
+
+    template <typename Cursor,typename Enable=void>
+    struct is_push_cursor : std::false_type {};
+
+    template <typename Cursor>
+    struct is_push_cursor<Cursor,
+        ext_traits::void_t<decltype(std::declval<const Cursor&>().need_more_input())>> : std::true_type {};
+
+} // namespace detail
+
+// A coroutine that produces values of type T from a cursor. Resuming it with next() 
+// runs the cursor until a value is available, the input is exhausted, or the cursor is done.
+// With a push cursor that runs out of input, next() returns false with need_more_input() true,
+// and the coroutine stays suspended until more input has been supplied and next() is called again.
+template <typename T>
+class staj_generator
+{
+public:
+    using value_type = T;
+
+    class promise_type
+    {
+        friend class staj_generator;
+
+        const T* value_{nullptr};
+        bool need_more_input_{false};
+        std::error_code ec_;
+        std::exception_ptr exception_;
+    public:
+        staj_generator get_return_object() noexcept
+        {
+            return staj_generator{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always yield_value(const T& value) noexcept
+        {
+            value_ = std::addressof(value);
+            return {};
+        }
+
+        std::suspend_always yield_value(detail::staj_starved) noexcept
+        {
+            need_more_input_ = true;
+            return {};
+        }
+
+        std::suspend_always yield_value(detail::staj_failed failed) noexcept
+        {
+            ec_ = failed.ec;
+            return {};
+        }
+
+        void return_void() const noexcept
+        {
+        }
+
+        void unhandled_exception() noexcept
+        {
+            exception_ = std::current_exception();
+        }
+    };
+
+    class iterator
+    {
+        staj_generator* gen_{nullptr};
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        iterator() noexcept = default;
+
+        explicit iterator(staj_generator& gen) noexcept
+            : gen_(std::addressof(gen))
+        {
+        }
+
+        reference operator*() const
+        {
+            return gen_->value();
+        }
+
+        pointer operator->() const
+        {
+            return std::addressof(gen_->value());
+        }
+
+        iterator& operator++()
+        {
+            if (!gen_->next())
+            {
+                gen_ = nullptr;
+            }
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        friend bool operator==(const iterator& it, std::default_sentinel_t) noexcept
+        {
+            return it.gen_ == nullptr;
+        }
+    };
+
+private:
+    std::coroutine_handle<promise_type> handle_;
+
+    explicit staj_generator(std::coroutine_handle<promise_type> handle) noexcept
+        : handle_(handle)
+    {
+    }
+public:
+    staj_generator(const staj_generator&) = delete;
+
+    staj_generator(staj_generator&& other) noexcept
+        : handle_(std::exchange(other.handle_, nullptr))
+    {
+    }
+
+    ~staj_generator() noexcept
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+        }
+    }
+
+    staj_generator& operator=(const staj_generator&) = delete;
+
+    staj_generator& operator=(staj_generator&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (handle_)
+            {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    // Returns true if a value is available. Otherwise the generator either needs more input, 
+    // has failed, or is done. An exception thrown by the cursor or a conversion is rethrown.
+    bool next()
+    {
+        if (!handle_ || handle_.done() || handle_.promise().ec_)
+        {
+            return false;
+        }
+        auto& promise = handle_.promise();
+        promise.value_ = nullptr;
+        promise.need_more_input_ = false;
+        handle_.resume();
+        if (JSONCONS_UNLIKELY(promise.exception_))
+        {
+            std::rethrow_exception(std::exchange(promise.exception_, nullptr));
+        }
+        return promise.value_ != nullptr;
+    }
+
+    const T& value() const
+    {
+        JSONCONS_ASSERT(handle_ && handle_.promise().value_ != nullptr);
+        return *handle_.promise().value_;
+    }
+
+    bool need_more_input() const noexcept
+    {
+        return handle_ && handle_.promise().need_more_input_;
+    }
+
+    bool done() const noexcept
+    {
+        return !handle_ || handle_.done() || handle_.promise().ec_;
+    }
+
+    std::error_code error() const noexcept
+    {
+        return handle_ ? handle_.promise().ec_ : std::error_code{};
+    }
+
+    // Iterates over the values that can be produced without more input
+    iterator begin()
+    {
+        return next() ? iterator(*this) : iterator();
+    }
+
+    std::default_sentinel_t end() const noexcept
+    {
+        return std::default_sentinel;
+    }
+};
+
+// Yields the events of a cursor from the current one on. A push cursor that has not 
+// yet read an event, or has run out of input, is advanced first.
+template <typename Cursor>
+staj_generator<basic_staj_event<typename Cursor::char_type>> staj_event_generator(Cursor& cursor)
+{
+    std::error_code ec;
+    while (true)
+    {
+        if constexpr (detail::is_push_cursor<Cursor>::value)
+        {
+            while (cursor.need_more_input())
+            {
+                cursor.next(ec);
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    co_yield detail::staj_failed{ec};
+                    co_return;
+                }
+                if (cursor.need_more_input())
+                {
+                    co_yield detail::staj_starved{};
+                }
+            }
+        }
+        if (cursor.done())
+        {
+            co_return;
+        }
+        co_yield cursor.current();
+        cursor.next(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            co_yield detail::staj_failed{ec};
+            co_return;
+        }
+    }
+}
+
+// Yields the elements of the array at the cursor's current event, decoded as T.
+// With a push cursor, an element that is only partly available is buffered until it is complete.
+template <typename T,typename Cursor>
+staj_generator<T> staj_array_generator(Cursor& cursor)
+{
+    using char_type = typename Cursor::char_type;
+
+    std::error_code ec;
+    if constexpr (detail::is_push_cursor<Cursor>::value)
+    {
+        while (cursor.need_more_input())
+        {
+            cursor.next(ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                co_yield detail::staj_failed{ec};
+                co_return;
+            }
+            if (cursor.need_more_input())
+            {
+                co_yield detail::staj_starved{};
+            }
+        }
+    }
+    if (cursor.done() || cursor.current().event_type() != staj_events::begin_array)
+    {
+        co_yield detail::staj_failed{conv_errc::not_array};
+        co_return;
+    }
+    while (true)
+    {
+        cursor.next(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            co_yield detail::staj_failed{ec};
+            co_return;
+        }
+        if constexpr (detail::is_push_cursor<Cursor>::value)
+        {
+            while (cursor.need_more_input())
+            {
+                co_yield detail::staj_starved{};
+                cursor.next(ec);
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    co_yield detail::staj_failed{ec};
+                    co_return;
+                }
+            }
+        }
+        if (JSONCONS_UNLIKELY(cursor.done()))
+        {
+            co_yield detail::staj_failed{conv_errc::conversion_failed};
+            co_return;
+        }
+        if (cursor.current().event_type() == staj_events::end_array)
+        {
+            co_return;
+        }
+        if constexpr (detail::is_push_cursor<Cursor>::value)
+        {
+            json_decoder<basic_json<char_type>> decoder;
+            cursor.read_to(decoder, ec);
+            while (!ec && cursor.need_more_input())
+            {
+                co_yield detail::staj_starved{};
+                cursor.read_to(decoder, ec);
+            }
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                co_yield detail::staj_failed{ec};
+                co_return;
+            }
+            auto result = decoder.get_result().template try_as<T>();
+            if (JSONCONS_UNLIKELY(!result))
+            {
+                co_yield detail::staj_failed{result.error().code()};
+                co_return;
+            }
+            co_yield *result;
+        }
+        else
+        {
+            auto result = reflect::decode_traits<T>::try_decode(make_alloc_set(), cursor);
+            if (JSONCONS_UNLIKELY(!result))
+            {
+                co_yield detail::staj_failed{result.error().code()};
+                co_return;
+            }
+            co_yield *result;
+        }
+    }
+}
+
+} // namespace jsoncons
+
+#endif // defined(JSONCONS_HAS_COROUTINES)
+
+#endif // JSONCONS_STAJ_GENERATOR_HPP
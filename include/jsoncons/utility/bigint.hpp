@@ -304,7 +304,7 @@ public:
         }
         else
         {
-            ::new (&allocated_) allocated_storage(other.allocated_, get_allocator());
+            ::new (&allocated_) allocated_storage(other.allocated_, other.get_allocator());
         }
     }
 
@@ -10,6 +10,7 @@
 #include <jsoncons_ext/bson/bson_cursor.hpp>
 #include <jsoncons_ext/bson/bson_encoder.hpp>
 #include <jsoncons_ext/bson/bson_reader.hpp>
+#include <jsoncons_ext/bson/bson_view.hpp>
 #include <jsoncons_ext/bson/decode_bson.hpp>
 #include <jsoncons_ext/bson/encode_bson.hpp>
 
@@ -14,6 +14,7 @@
 #include <memory>
 #include <string>
 #include <system_error>
+#include <type_traits>
 #include <utility> // std::move
 #include <vector>
 
@@ -43,6 +44,8 @@ class basic_bson_encoder final : public basic_json_visitor<char>
     enum class decimal_parse_state { start, integer, exp1, exp2, fraction1 };
     static constexpr int64_t nanos_in_milli = 1000000;
     static constexpr int64_t millis_in_second = 1000;
+    static constexpr std::size_t stream_buffer_length = 16384;
+    using seekable_sink_tag = std::integral_constant<bool,is_seekable_sink<Sink>::value>;
 public:
     using allocator_type = Allocator;
     using char_type = char;
@@ -97,6 +100,9 @@ private:
     std::vector<stack_item> stack_;
     std::vector<uint8_t> buffer_;
     int nesting_depth_{0};
+    bool stream_output_{false};
+    std::size_t start_{0}; // sink position of the first byte
+    std::size_t base_{0};  // sink position of buffer_[0]
 public:
 
     // Noncopyable and nonmoveable
@@ -116,8 +122,13 @@ public:
                                 const Allocator& alloc = Allocator())
        : sink_(std::forward<Sink>(sink)),
          max_nesting_depth_(options.max_nesting_depth()),
-         alloc_(alloc)
+         alloc_(alloc),
+         stream_output_(options.stream_output() && sink_is_seekable(seekable_sink_tag()))
     {
+        if (stream_output_)
+        {
+            start_ = base_ = sink_position(seekable_sink_tag());
+        }
     }
 
     ~basic_bson_encoder() noexcept
@@ -133,11 +144,16 @@ public:
         stack_.clear();
         buffer_.clear();
         nesting_depth_ = 0;
+        if (stream_output_)
+        {
+            start_ = base_ = sink_position(seekable_sink_tag());
+        }
     }
 
     void reset(Sink&& sink)
     {
         sink_ = std::move(sink);
+        stream_output_ = stream_output_ && sink_is_seekable(seekable_sink_tag());
         reset();
     }
 
@@ -156,7 +172,7 @@ private:
             ec = bson_errc::max_nesting_depth_exceeded;
             JSONCONS_VISITOR_RETURN;
         } 
-        if (buffer_.size() > 0)
+        if (encoded_length() > 0)
         {
             if (stack_.empty())
             {
@@ -166,7 +182,7 @@ private:
             before_value(jsoncons::bson::bson_type::document_type);
         }
 
-        stack_.emplace_back(jsoncons::bson::bson_container_type::document, buffer_.size());
+        stack_.emplace_back(jsoncons::bson::bson_container_type::document, base_ + buffer_.size());
         buffer_.insert(buffer_.end(), sizeof(int32_t), 0);
 
         JSONCONS_VISITOR_RETURN;
@@ -179,15 +195,22 @@ private:
 
         buffer_.push_back(0x00);
 
-        std::size_t length = buffer_.size() - stack_.back().offset();
-        binary::native_to_little(static_cast<uint32_t>(length), buffer_.begin()+stack_.back().offset());
+        std::size_t length = base_ + buffer_.size() - stack_.back().offset();
+        write_length(stack_.back().offset(), length);
 
         stack_.pop_back();
         if (stack_.empty())
         {
-            for (auto c : buffer_)
+            if (stream_output_)
             {
-                sink_.push_back(c);
+                flush_buffer();
+            }
+            else
+            {
+                for (auto c : buffer_)
+                {
+                    sink_.push_back(c);
+                }
             }
         }
         JSONCONS_VISITOR_RETURN;
@@ -200,7 +223,7 @@ private:
             ec = bson_errc::max_nesting_depth_exceeded;
             JSONCONS_VISITOR_RETURN;
         } 
-        if (buffer_.size() > 0)
+        if (encoded_length() > 0)
         {
             if (stack_.empty())
             {
@@ -209,7 +232,7 @@ private:
             }
             before_value(jsoncons::bson::bson_type::array_type);
         }
-        stack_.emplace_back(jsoncons::bson::bson_container_type::array, buffer_.size());
+        stack_.emplace_back(jsoncons::bson::bson_container_type::array, base_ + buffer_.size());
         buffer_.insert(buffer_.end(), sizeof(int32_t), 0);
         JSONCONS_VISITOR_RETURN;
     }
@@ -221,15 +244,22 @@ private:
 
         buffer_.push_back(0x00);
 
-        std::size_t length = buffer_.size() - stack_.back().offset();
-        binary::native_to_little(static_cast<uint32_t>(length), buffer_.begin()+stack_.back().offset());
+        std::size_t length = base_ + buffer_.size() - stack_.back().offset();
+        write_length(stack_.back().offset(), length);
 
         stack_.pop_back();
         if (stack_.empty())
         {
-            for (auto c : buffer_)
+            if (stream_output_)
+            {
+                flush_buffer();
+            }
+            else
             {
-                sink_.push_back(c);
+                for (auto c : buffer_)
+                {
+                    sink_.push_back(c);
+                }
             }
         }
         JSONCONS_VISITOR_RETURN;
@@ -237,6 +267,10 @@ private:
 
     JSONCONS_VISITOR_RETURN_TYPE visit_key(const string_view_type& name, const ser_context&, std::error_code&) override
     {
+        if (stream_output_ && buffer_.size() >= stream_buffer_length)
+        {
+            flush_buffer();
+        }
         stack_.back().member_offset(buffer_.size());
         buffer_.push_back(0x00); // reserve space for code
         for (auto c : name)
@@ -573,12 +607,76 @@ private:
         }
         else
         {
+            if (stream_output_ && buffer_.size() >= stream_buffer_length)
+            {
+                flush_buffer();
+            }
             buffer_.push_back(code);
             std::string name = std::to_string(stack_.back().next_index());
             buffer_.insert(buffer_.end(), name.begin(), name.end());
             buffer_.push_back(0x00);
         }
     }
+
+    std::size_t encoded_length() const
+    {
+        return base_ + buffer_.size() - start_;
+    }
+
+    // Writes the length of a document or array, in the buffer if its 
+    // length placeholder is still there, otherwise in the sink
+    void write_length(std::size_t offset, std::size_t length)
+    {
+        if (offset >= base_)
+        {
+            binary::native_to_little(static_cast<uint32_t>(length), buffer_.begin()+(offset - base_));
+        }
+        else
+        {
+            uint8_t buf[sizeof(uint32_t)];
+            binary::native_to_little(static_cast<uint32_t>(length), buf);
+            sink_overwrite(seekable_sink_tag(), offset, buf, sizeof(buf));
+        }
+    }
+
+    void flush_buffer()
+    {
+        for (auto c : buffer_)
+        {
+            sink_.push_back(c);
+        }
+        base_ += buffer_.size();
+        buffer_.clear();
+    }
+
+    bool sink_is_seekable(std::true_type) const
+    {
+        return sink_.is_seekable();
+    }
+
+    bool sink_is_seekable(std::false_type) const
+    {
+        return false;
+    }
+
+    std::size_t sink_position(std::true_type) const
+    {
+        return sink_.position();
+    }
+
+    std::size_t sink_position(std::false_type) const
+    {
+        return 0;
+    }
+
+    void sink_overwrite(std::true_type, std::size_t pos, const uint8_t* s, std::size_t length)
+    {
+        sink_.overwrite(pos, s, length);
+    }
+
+    void sink_overwrite(std::false_type, std::size_t, const uint8_t*, std::size_t)
+    {
+    }
 };
 
 using bson_stream_encoder = basic_bson_encoder<jsoncons::binary_stream_sink>;
@@ -46,17 +46,27 @@ protected:
 class bson_encode_options : public virtual bson_options_common
 {
     friend class bson_options;
+
+    bool stream_output_{false};
 public:
     bson_encode_options() = default;
     bson_encode_options(const bson_encode_options& other) = default;
 protected:
     bson_encode_options& operator=(const bson_encode_options& other) = default;
+public:
+    // Write to the sink as encoding proceeds and patch document lengths in place,
+    // rather than buffering the whole document
+    bool stream_output() const 
+    {
+        return stream_output_;
+    }
 };
 
 class bson_options final : public bson_decode_options, public bson_encode_options
 {
 public:
     using bson_options_common::max_nesting_depth;
+    using bson_encode_options::stream_output;
 
     bson_options() = default;
     bson_options(const bson_options& other) = default;
@@ -67,6 +77,12 @@ public:
         this->max_nesting_depth_ = value;
         return *this;
     }
+
+    bson_options& stream_output(bool value)
+    {
+        this->stream_output_ = value;
+        return *this;
+    }
 };
 
 } // namespace bson
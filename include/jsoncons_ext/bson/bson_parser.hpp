@@ -244,6 +244,34 @@ public:
         }
     }
 
+    // Jumps over the remaining elements of the innermost document or array using its 
+    // length prefix, so that the next call to parse reports the end of the container.
+    void skip_container(std::error_code& ec)
+    {
+        auto& state = state_stack_.back();
+        if (state.mode != parse_mode::document && state.mode != parse_mode::array)
+        {
+            return;
+        }
+        if (JSONCONS_UNLIKELY(state.length < state.pos + 1))
+        {
+            ec = bson_errc::size_mismatch;
+            more_ = false;
+            return;
+        }
+        std::size_t length = state.length - state.pos - 1;
+        std::size_t position = source_.position();
+        source_.ignore(length);
+        std::size_t n = source_.position() - position;
+        state.pos += n;
+        if (JSONCONS_UNLIKELY(n != length))
+        {
+            ec = bson_errc::unexpected_eof;
+            more_ = false;
+            return;
+        }
+    }
+
 private:
 
     void begin_document(json_visitor& visitor, std::error_code& ec)
@@ -387,39 +415,37 @@ private:
             case jsoncons::bson::bson_type::max_key_type:
             case jsoncons::bson::bson_type::string_type:
             {
-                text_buffer_.clear();
-                read_string(text_buffer_, ec);
+                auto sv = read_string(text_buffer_, ec);
                 if (JSONCONS_UNLIKELY(ec))
                 {
                     return;
                 }
-                auto result = unicode_traits::validate(text_buffer_.data(), text_buffer_.size());
+                auto result = unicode_traits::validate(sv.data(), sv.size());
                 if (JSONCONS_UNLIKELY(result.ec != unicode_traits::conv_errc()))
                 {
                     ec = bson_errc::invalid_utf8_text_string;
                     more_ = false;
                     return;
                 }
-                visitor.string_value(text_buffer_, semantic_tag::none, *this, ec);
+                visitor.string_value(sv, semantic_tag::none, *this, ec);
                 more_ = !cursor_mode_;
                 break;
             }
             case jsoncons::bson::bson_type::javascript_type:
             {
-                text_buffer_.clear();
-                read_string(text_buffer_, ec);
+                auto sv = read_string(text_buffer_, ec);
                 if (JSONCONS_UNLIKELY(ec))
                 {
                     return;
                 }
-                auto result = unicode_traits::validate(text_buffer_.data(), text_buffer_.size());
+                auto result = unicode_traits::validate(sv.data(), sv.size());
                 if (JSONCONS_UNLIKELY(result.ec != unicode_traits::conv_errc()))
                 {
                     ec = bson_errc::invalid_utf8_text_string;
                     more_ = false;
                     return;
                 }
-                visitor.string_value(text_buffer_, semantic_tag::code, *this, ec);
+                visitor.string_value(sv, semantic_tag::code, *this, ec);
                 more_ = !cursor_mode_;
                 break;
             }
@@ -575,17 +601,16 @@ private:
                     return;
                 }
 
-                bytes_buffer_.clear();
-                n = source_reader<Source>::read(source_, bytes_buffer_, len);
-                state_stack_.back().pos += n;
-                if (JSONCONS_UNLIKELY(n != static_cast<std::size_t>(len)))
+                auto bytes = source_reader<Source>::read_view(source_, bytes_buffer_, len);
+                state_stack_.back().pos += bytes.size();
+                if (JSONCONS_UNLIKELY(bytes.size() != static_cast<std::size_t>(len)))
                 {
                     ec = bson_errc::unexpected_eof;
                     more_ = false;
                     return;
                 }
 
-                visitor.byte_string_value(bytes_buffer_, 
+                visitor.byte_string_value(byte_string_view(bytes.data(), bytes.size()), 
                                                   subtype, 
                                                   *this,
                                                   ec);
@@ -664,7 +689,8 @@ private:
         }
     }
 
-    void read_string(string_type& buffer, std::error_code& ec)
+    // Returns a view of the string, either into the input or into buffer
+    string_view read_string(string_type& buffer, std::error_code& ec)
     {
         uint8_t buf[sizeof(int32_t)]; 
         std::size_t n = source_.read(buf, sizeof(int32_t));
@@ -673,25 +699,25 @@ private:
         {
             ec = bson_errc::unexpected_eof;
             more_ = false;
-            return;
+            return string_view{};
         }
         auto len = binary::little_to_native<int32_t>(buf, sizeof(buf));
         if (JSONCONS_UNLIKELY(len < 1))
         {
             ec = bson_errc::string_length_is_non_positive;
             more_ = false;
-            return;
+            return string_view{};
         }
 
         std::size_t size = static_cast<std::size_t>(len) - static_cast<std::size_t>(1);
-        n = source_reader<Source>::read(source_, buffer, size);
-        state_stack_.back().pos += n;
+        auto chars = source_reader<Source>::read_view(source_, buffer, size);
+        state_stack_.back().pos += chars.size();
 
-        if (JSONCONS_UNLIKELY(n != size))
+        if (JSONCONS_UNLIKELY(chars.size() != size))
         {
             ec = bson_errc::unexpected_eof;
             more_ = false;
-            return;
+            return string_view{};
         }
         uint8_t c;
         n = source_.read(&c, 1);
@@ -700,8 +726,9 @@ private:
         {
             ec = bson_errc::unexpected_eof;
             more_ = false;
-            return;
+            return string_view{};
         }
+        return string_view(chars.data(), chars.size());
     }
 };
 
@@ -0,0 +1,507 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_EXT_BSON_BSON_VIEW_HPP
+#define JSONCONS_EXT_BSON_BSON_VIEW_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memchr
+#include <iterator>
+#include <stdexcept>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/detail/span.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/utility/binary.hpp>
+#include <jsoncons/utility/byte_string.hpp>
+
+#include <jsoncons_ext/bson/bson_decimal128.hpp>
+#include <jsoncons_ext/bson/bson_error.hpp>
+#include <jsoncons_ext/bson/bson_oid.hpp>
+#include <jsoncons_ext/bson/bson_type.hpp>
+
+namespace jsoncons {
+namespace bson {
+
+class bson_view;
+
+// A read-only view of one element of a BSON document or array. Values
+// are decoded from the underlying bytes when requested.
+class bson_element
+{
+    uint8_t type_{0};
+    jsoncons::string_view key_;
+    const uint8_t* value_{nullptr};
+    std::size_t length_{0};
+public:
+    bson_element() = default;
+
+    bson_element(uint8_t type, const jsoncons::string_view& key, const uint8_t* value, std::size_t length) noexcept
+        : type_(type), key_(key), value_(value), length_(length)
+    {
+    }
+
+    uint8_t type() const noexcept
+    {
+        return type_;
+    }
+
+    jsoncons::string_view key() const noexcept
+    {
+        return key_;
+    }
+
+    // The encoded value, without the type and key
+    jsoncons::span<const uint8_t> bytes() const noexcept
+    {
+        return jsoncons::span<const uint8_t>(value_, length_);
+    }
+
+    bool is_null() const noexcept
+    {
+        return type_ == jsoncons::bson::bson_type::null_type || type_ == jsoncons::bson::bson_type::undefined_type;
+    }
+
+    bool is_document() const noexcept
+    {
+        return type_ == jsoncons::bson::bson_type::document_type;
+    }
+
+    bool is_array() const noexcept
+    {
+        return type_ == jsoncons::bson::bson_type::array_type;
+    }
+
+    bool is_string() const noexcept
+    {
+        return type_ == jsoncons::bson::bson_type::string_type || type_ == jsoncons::bson::bson_type::javascript_type ||
+               type_ == jsoncons::bson::bson_type::symbol_type;
+    }
+
+    bool is_int64() const noexcept
+    {
+        return type_ == jsoncons::bson::bson_type::int32_type || type_ == jsoncons::bson::bson_type::int64_type ||
+               type_ == jsoncons::bson::bson_type::datetime_type;
+    }
+
+    bool as_bool() const
+    {
+        if (type_ != jsoncons::bson::bson_type::bool_type)
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a bool"));
+        }
+        return value_[0] != 0;
+    }
+
+    // int32, int64 and datetime (milliseconds since the epoch) values
+    int64_t as_int64() const
+    {
+        switch (type_)
+        {
+            case jsoncons::bson::bson_type::int32_type:
+                return binary::little_to_native<int32_t>(value_, length_);
+            case jsoncons::bson::bson_type::int64_type:
+            case jsoncons::bson::bson_type::datetime_type:
+                return binary::little_to_native<int64_t>(value_, length_);
+            default:
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an int64"));
+        }
+    }
+
+    uint64_t as_timestamp() const
+    {
+        if (type_ != jsoncons::bson::bson_type::timestamp_type)
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a timestamp"));
+        }
+        return binary::little_to_native<uint64_t>(value_, length_);
+    }
+
+    double as_double() const
+    {
+        switch (type_)
+        {
+            case jsoncons::bson::bson_type::double_type:
+                return binary::little_to_native<double>(value_, length_);
+            case jsoncons::bson::bson_type::int32_type:
+            case jsoncons::bson::bson_type::int64_type:
+                return static_cast<double>(as_int64());
+            default:
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a double"));
+        }
+    }
+
+    // string, javascript and symbol values, without the terminating null
+    jsoncons::string_view as_string_view() const
+    {
+        if (!is_string())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a string"));
+        }
+        return jsoncons::string_view(reinterpret_cast<const char*>(value_) + sizeof(int32_t), length_ - sizeof(int32_t) - 1);
+    }
+
+    oid_t as_oid() const
+    {
+        if (type_ != jsoncons::bson::bson_type::object_id_type)
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object id"));
+        }
+        std::array<uint8_t,12> bytes;
+        std::memcpy(bytes.data(), value_, bytes.size());
+        return oid_t(bytes);
+    }
+
+    decimal128_t as_decimal128() const
+    {
+        if (type_ != jsoncons::bson::bson_type::decimal128_type)
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a decimal128"));
+        }
+        decimal128_t dec;
+        dec.low = binary::little_to_native<uint64_t>(value_, sizeof(uint64_t));
+        dec.high = binary::little_to_native<uint64_t>(value_ + sizeof(uint64_t), sizeof(uint64_t));
+        return dec;
+    }
+
+    byte_string_view as_byte_string_view() const
+    {
+        if (type_ != jsoncons::bson::bson_type::binary_type)
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a byte string"));
+        }
+        return byte_string_view(value_ + sizeof(int32_t) + 1, length_ - sizeof(int32_t) - 1);
+    }
+
+    uint8_t binary_subtype() const
+    {
+        if (type_ != jsoncons::bson::bson_type::binary_type)
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a byte string"));
+        }
+        return value_[sizeof(int32_t)];
+    }
+
+    bson_view as_document() const;
+
+    bson_view as_array() const;
+};
+
+// A read-only view of an encoded BSON document or array. Elements are located
+// by following the length prefixes, without decoding or allocating.
+class bson_view
+{
+    const uint8_t* data_{nullptr};
+    std::size_t length_{0};
+public:
+    class const_iterator
+    {
+        const uint8_t* p_{nullptr};
+        const uint8_t* last_{nullptr};
+        bson_element element_;
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = bson_element;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const bson_element*;
+        using reference = const bson_element&;
+
+        const_iterator() = default;
+
+        // first points at the type of an element, or at the terminating null,
+        // last at the terminating null
+        const_iterator(const uint8_t* first, const uint8_t* last)
+            : p_(first), last_(last)
+        {
+            read_element();
+        }
+
+        reference operator*() const
+        {
+            return element_;
+        }
+
+        pointer operator->() const
+        {
+            return &element_;
+        }
+
+        const_iterator& operator++()
+        {
+            p_ = element_.bytes().data() + element_.bytes().size();
+            read_element();
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator temp(*this);
+            ++(*this);
+            return temp;
+        }
+
+        friend bool operator==(const const_iterator& lhs, const const_iterator& rhs)
+        {
+            return lhs.p_ == rhs.p_;
+        }
+
+        friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs)
+        {
+            return lhs.p_ != rhs.p_;
+        }
+    private:
+        void read_element()
+        {
+            if (p_ == last_)
+            {
+                element_ = bson_element();
+                return;
+            }
+            uint8_t type = *p_;
+            const uint8_t* key = p_ + 1;
+            const uint8_t* end_key = static_cast<const uint8_t*>(std::memchr(key, 0, last_ - key));
+            if (JSONCONS_UNLIKELY(end_key == nullptr))
+            {
+                JSONCONS_THROW(ser_error(bson_errc::unexpected_eof));
+            }
+            const uint8_t* value = end_key + 1;
+            std::size_t length = value_length(type, value, last_);
+            element_ = bson_element(type, jsoncons::string_view(reinterpret_cast<const char*>(key), end_key - key), value, length);
+        }
+    };
+
+    using iterator = const_iterator;
+
+    bson_view() = default;
+
+    // Views the document or array that starts at data, checking its length prefix
+    // and terminating null against length
+    bson_view(const uint8_t* data, std::size_t length)
+        : data_(data), length_(length)
+    {
+        if (JSONCONS_UNLIKELY(length < sizeof(int32_t) + 1))
+        {
+            JSONCONS_THROW(ser_error(bson_errc::unexpected_eof));
+        }
+        auto n = binary::little_to_native<int32_t>(data, length);
+        if (JSONCONS_UNLIKELY(n < static_cast<int32_t>(sizeof(int32_t) + 1) || static_cast<std::size_t>(n) > length || data[n-1] != 0))
+        {
+            JSONCONS_THROW(ser_error(bson_errc::size_mismatch));
+        }
+        length_ = static_cast<std::size_t>(n);
+    }
+
+    explicit bson_view(const jsoncons::span<const uint8_t>& bytes)
+        : bson_view(bytes.data(), bytes.size())
+    {
+    }
+
+    // The encoded document or array, including its length prefix
+    jsoncons::span<const uint8_t> bytes() const noexcept
+    {
+        return jsoncons::span<const uint8_t>(data_, length_);
+    }
+
+    const_iterator begin() const
+    {
+        return data_ == nullptr ? const_iterator() : const_iterator(data_ + sizeof(int32_t), data_ + length_ - 1);
+    }
+
+    const_iterator end() const
+    {
+        return data_ == nullptr ? const_iterator() : const_iterator(data_ + length_ - 1, data_ + length_ - 1);
+    }
+
+    bool empty() const
+    {
+        return length_ <= sizeof(int32_t) + 1;
+    }
+
+    // Counts the elements, which requires a pass over them
+    std::size_t size() const
+    {
+        std::size_t count = 0;
+        for (auto it = begin(); it != end(); ++it)
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    const_iterator find(const jsoncons::string_view& key) const
+    {
+        auto last = end();
+        for (auto it = begin(); it != last; ++it)
+        {
+            if (it->key() == key)
+            {
+                return it;
+            }
+        }
+        return last;
+    }
+
+    bool contains(const jsoncons::string_view& key) const
+    {
+        return find(key) != end();
+    }
+
+    bson_element at(const jsoncons::string_view& key) const
+    {
+        auto it = find(key);
+        if (it == end())
+        {
+            JSONCONS_THROW(key_not_found(key.data(),key.length()));
+        }
+        return *it;
+    }
+
+    bson_element operator[](const jsoncons::string_view& key) const
+    {
+        return at(key);
+    }
+
+    // The element at position index, for arrays
+    bson_element at(std::size_t index) const
+    {
+        auto last = end();
+        std::size_t i = 0;
+        for (auto it = begin(); it != last; ++it, ++i)
+        {
+            if (i == index)
+            {
+                return *it;
+            }
+        }
+        JSONCONS_THROW(std::out_of_range("Index out of range"));
+    }
+private:
+    static std::size_t value_length(uint8_t type, const uint8_t* value, const uint8_t* last)
+    {
+        std::size_t available = static_cast<std::size_t>(last - value);
+        std::size_t length = 0;
+        switch (type)
+        {
+            case jsoncons::bson::bson_type::undefined_type:
+            case jsoncons::bson::bson_type::null_type:
+            case jsoncons::bson::bson_type::min_key_type:
+            case jsoncons::bson::bson_type::max_key_type:
+                length = 0;
+                break;
+            case jsoncons::bson::bson_type::bool_type:
+                length = 1;
+                break;
+            case jsoncons::bson::bson_type::int32_type:
+                length = sizeof(int32_t);
+                break;
+            case jsoncons::bson::bson_type::double_type:
+            case jsoncons::bson::bson_type::datetime_type:
+            case jsoncons::bson::bson_type::timestamp_type:
+            case jsoncons::bson::bson_type::int64_type:
+                length = sizeof(int64_t);
+                break;
+            case jsoncons::bson::bson_type::object_id_type:
+                length = 12;
+                break;
+            case jsoncons::bson::bson_type::decimal128_type:
+                length = 2*sizeof(uint64_t);
+                break;
+            case jsoncons::bson::bson_type::string_type:
+            case jsoncons::bson::bson_type::javascript_type:
+            case jsoncons::bson::bson_type::symbol_type:
+            {
+                auto n = read_int32(value, available);
+                if (JSONCONS_UNLIKELY(n < 1))
+                {
+                    JSONCONS_THROW(ser_error(bson_errc::string_length_is_non_positive));
+                }
+                length = sizeof(int32_t) + static_cast<std::size_t>(n);
+                break;
+            }
+            case jsoncons::bson::bson_type::binary_type:
+            {
+                auto n = read_int32(value, available);
+                if (JSONCONS_UNLIKELY(n < 0))
+                {
+                    JSONCONS_THROW(ser_error(bson_errc::length_is_negative));
+                }
+                length = sizeof(int32_t) + 1 + static_cast<std::size_t>(n);
+                break;
+            }
+            case jsoncons::bson::bson_type::document_type:
+            case jsoncons::bson::bson_type::array_type:
+            case jsoncons::bson::bson_type::javascript_with_scope_type:
+            {
+                auto n = read_int32(value, available);
+                if (JSONCONS_UNLIKELY(n < 0))
+                {
+                    JSONCONS_THROW(ser_error(bson_errc::length_is_negative));
+                }
+                length = static_cast<std::size_t>(n);
+                break;
+            }
+            case jsoncons::bson::bson_type::regex_type:
+            {
+                // pattern and options, both null terminated
+                const uint8_t* p = static_cast<const uint8_t*>(std::memchr(value, 0, available));
+                if (p != nullptr)
+                {
+                    p = static_cast<const uint8_t*>(std::memchr(p + 1, 0, last - (p + 1)));
+                }
+                if (JSONCONS_UNLIKELY(p == nullptr))
+                {
+                    JSONCONS_THROW(ser_error(bson_errc::unexpected_eof));
+                }
+                length = static_cast<std::size_t>(p + 1 - value);
+                break;
+            }
+            default:
+                JSONCONS_THROW(ser_error(bson_errc::unknown_type));
+        }
+        if (JSONCONS_UNLIKELY(length > available))
+        {
+            JSONCONS_THROW(ser_error(bson_errc::unexpected_eof));
+        }
+        return length;
+    }
+
+    static int32_t read_int32(const uint8_t* p, std::size_t available)
+    {
+        if (JSONCONS_UNLIKELY(available < sizeof(int32_t)))
+        {
+            JSONCONS_THROW(ser_error(bson_errc::unexpected_eof));
+        }
+        return binary::little_to_native<int32_t>(p, sizeof(int32_t));
+    }
+};
+
+inline
+bson_view bson_element::as_document() const
+{
+    if (type_ != jsoncons::bson::bson_type::document_type)
+    {
+        JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a document"));
+    }
+    return bson_view(value_, length_);
+}
+
+inline
+bson_view bson_element::as_array() const
+{
+    if (type_ != jsoncons::bson::bson_type::array_type)
+    {
+        JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
+    }
+    return bson_view(value_, length_);
+}
+
+} // namespace bson
+} // namespace jsoncons
+
+#endif // JSONCONS_EXT_BSON_BSON_VIEW_HPP
@@ -7,9 +7,15 @@
 #ifndef JSONCONS_EXT_BSON_ENCODE_BSON_HPP
 #define JSONCONS_EXT_BSON_ENCODE_BSON_HPP
 
+#include <algorithm> // std::sort
+#include <cstddef>
+#include <cstdint>
+#include <memory> // std::addressof
 #include <ostream> // std::basic_ostream
 #include <system_error> 
 #include <type_traits> // std::enable_if
+#include <utility> // std::pair
+#include <vector>
 
 #include <jsoncons/allocator_set.hpp>
 #include <jsoncons/basic_json.hpp>
@@ -19,6 +25,7 @@
 #include <jsoncons/reflect/encode_traits.hpp>
 #include <jsoncons/ser_utils.hpp>
 #include <jsoncons/sink.hpp>
+#include <jsoncons/utility/binary.hpp>
 #include <jsoncons/utility/more_type_traits.hpp>
 
 #include <jsoncons_ext/bson/bson_encoder.hpp>
@@ -26,6 +33,146 @@
 
 namespace jsoncons { 
 namespace bson {
+namespace detail {
+
+    // Counts the bytes written and records the document and array lengths
+    // that the encoder patches after they have left its buffer
+    class bson_length_sink
+    {
+    public:
+        using value_type = uint8_t;
+    private:
+        std::vector<std::pair<std::size_t,uint32_t>>* lengths_;
+        std::size_t position_{0};
+    public:
+        bson_length_sink(std::vector<std::pair<std::size_t,uint32_t>>& lengths)
+            : lengths_(std::addressof(lengths))
+        {
+        }
+
+        void flush()
+        {
+        }
+
+        void push_back(uint8_t)
+        {
+            ++position_;
+        }
+
+        bool is_seekable() const
+        {
+            return true;
+        }
+
+        std::size_t position() const
+        {
+            return position_;
+        }
+
+        void overwrite(std::size_t pos, const uint8_t* s, std::size_t length)
+        {
+            JSONCONS_ASSERT(length == sizeof(uint32_t));
+            lengths_->emplace_back(pos, binary::little_to_native<uint32_t>(s, length));
+        }
+    };
+
+    // Writes to a stream that cannot seek, filling in the lengths recorded
+    // by a bson_length_sink as their placeholders go by
+    class bson_prefilled_length_sink
+    {
+    public:
+        using value_type = uint8_t;
+    private:
+        binary_stream_sink sink_;
+        const std::vector<std::pair<std::size_t,uint32_t>>* lengths_;
+        std::size_t index_{0};
+        std::size_t position_{0};
+    public:
+        bson_prefilled_length_sink(std::ostream& os, const std::vector<std::pair<std::size_t,uint32_t>>& lengths)
+            : sink_(os), lengths_(std::addressof(lengths))
+        {
+        }
+
+        void flush()
+        {
+            sink_.flush();
+        }
+
+        void push_back(uint8_t ch)
+        {
+            if (index_ < lengths_->size() && position_ >= (*lengths_)[index_].first)
+            {
+                std::size_t i = position_ - (*lengths_)[index_].first;
+                ch = static_cast<uint8_t>(((*lengths_)[index_].second >> (8*i)) & 0xff);
+                if (i + 1 == sizeof(uint32_t))
+                {
+                    ++index_;
+                }
+            }
+            sink_.push_back(ch);
+            ++position_;
+        }
+
+        bool is_seekable() const
+        {
+            return true;
+        }
+
+        std::size_t position() const
+        {
+            return position_;
+        }
+
+        void overwrite(std::size_t, const uint8_t*, std::size_t)
+        {
+            // already written
+        }
+    };
+
+    template <typename T,typename Alloc,typename TempAlloc,typename Encoder>
+    typename std::enable_if<ext_traits::is_basic_json<T>::value,write_result>::type 
+    try_encode_bson_value(const allocator_set<Alloc,TempAlloc>&, const T& j, Encoder& encoder)
+    {
+        using char_type = typename T::char_type;
+        auto adaptor = make_json_visitor_adaptor<basic_json_visitor<char_type>>(encoder);
+        return j.try_dump(adaptor);
+    }
+
+    template <typename T,typename Alloc,typename TempAlloc,typename Encoder>
+    typename std::enable_if<!ext_traits::is_basic_json<T>::value,write_result>::type 
+    try_encode_bson_value(const allocator_set<Alloc,TempAlloc>& aset, const T& val, Encoder& encoder)
+    {
+        return reflect::encode_traits<T>::try_encode(aset, val, encoder);
+    }
+
+    // With stream_output, a stream that cannot seek is written in two passes, the first
+    // computing the document and array lengths that would otherwise be patched in place 
+    template <typename T,typename Alloc,typename TempAlloc>
+    write_result try_encode_bson_to_stream(const allocator_set<Alloc,TempAlloc>& aset,
+        const T& val, 
+        std::ostream& os, 
+        const bson_encode_options& options)
+    {
+        if (options.stream_output() && os.tellp() == std::ostream::pos_type(-1))
+        {
+            std::vector<std::pair<std::size_t,uint32_t>> lengths;
+            {
+                basic_bson_encoder<bson_length_sink,TempAlloc> encoder(bson_length_sink(lengths), options, aset.get_temp_allocator());
+                auto r = try_encode_bson_value(aset, val, encoder);
+                if (!r)
+                {
+                    return r;
+                }
+            }
+            std::sort(lengths.begin(), lengths.end());
+            basic_bson_encoder<bson_prefilled_length_sink,TempAlloc> encoder(bson_prefilled_length_sink(os, lengths), options, aset.get_temp_allocator());
+            return try_encode_bson_value(aset, val, encoder);
+        }
+        basic_bson_encoder<jsoncons::binary_stream_sink,TempAlloc> encoder(os, options, aset.get_temp_allocator());
+        return try_encode_bson_value(aset, val, encoder);
+    }
+
+} // namespace detail
 
 template <typename T,typename BytesLike>
 typename std::enable_if<ext_traits::is_basic_json<T>::value &&
@@ -58,10 +205,7 @@ try_encode_bson(const T& j,
     std::ostream& os, 
     const bson_encode_options& options = bson_encode_options())
 {
-    using char_type = typename T::char_type;
-    bson_stream_encoder encoder(os, options);
-    auto adaptor = make_json_visitor_adaptor<basic_json_visitor<char_type>>(encoder);
-    return j.try_dump(adaptor);
+    return detail::try_encode_bson_to_stream(make_alloc_set(), j, os, options);
 }
 
 template <typename T>
@@ -70,9 +214,7 @@ try_encode_bson(const T& val,
     std::ostream& os, 
     const bson_encode_options& options = bson_encode_options())
 {
-    bson_stream_encoder encoder(os, options);
-    std::error_code ec;
-    return reflect::encode_traits<T>::try_encode(make_alloc_set(), val, encoder);
+    return detail::try_encode_bson_to_stream(make_alloc_set(), val, os, options);
 }
 
 template <typename T,typename BytesLike,typename Alloc,typename TempAlloc >
@@ -109,10 +251,7 @@ try_encode_bson(const allocator_set<Alloc,TempAlloc>& aset,
     std::ostream& os, 
     const bson_encode_options& options = bson_encode_options())
 {
-    using char_type = typename T::char_type;
-    basic_bson_encoder<jsoncons::binary_stream_sink,TempAlloc> encoder(os, options, aset.get_temp_allocator());
-    auto adaptor = make_json_visitor_adaptor<basic_json_visitor<char_type>>(encoder);
-    return j.try_dump(adaptor);
+    return detail::try_encode_bson_to_stream(aset, j, os, options);
 }
 
 template <typename T,typename Alloc,typename TempAlloc >
@@ -122,9 +261,7 @@ try_encode_bson(const allocator_set<Alloc,TempAlloc>& aset,
     std::ostream& os, 
     const bson_encode_options& options = bson_encode_options())
 {
-    basic_bson_encoder<jsoncons::binary_stream_sink,TempAlloc> encoder(os, options, aset.get_temp_allocator());
-    std::error_code ec;
-    return reflect::encode_traits<T>::try_encode(aset, val, encoder);
+    return detail::try_encode_bson_to_stream(aset, val, os, options);
 }
 
 template <typename... Args>
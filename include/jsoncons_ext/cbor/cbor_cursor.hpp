@@ -10,8 +10,10 @@
 #include <cstddef>
 #include <functional>
 #include <ios>
+#include <limits>
 #include <memory> // std::allocator
 #include <system_error>
+#include <vector>
 
 #include <jsoncons/utility/byte_string.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
@@ -258,6 +260,41 @@ public:
         read_next(ec);
     }
 
+    void skip() final
+    {
+        std::error_code ec;
+        skip(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    void skip(std::error_code& ec) final
+    {
+        if (!is_begin_container(current().event_type()))
+        {
+            return;
+        }
+        if (is_typed_array())
+        {
+            to_end_array();
+        }
+        else if (!parser_.can_skip_container())
+        {
+            basic_staj_cursor<char_type>::skip(ec);
+        }
+        else
+        {
+            parser_.skip_container(ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+            read_next(ec);
+        }
+    }
+
     const ser_context& context() const final
     {
         return *this;
@@ -346,8 +383,444 @@ private:
     }
 };
 
+namespace detail {
+
+// Finds the end of the first complete data item in a buffer that may be cut off anywhere.
+// Scanning resumes where the previous call stopped, so feeding an item in pieces costs 
+// time proportional to its size.
+class cbor_item_scanner
+{
+    static constexpr uint64_t indefinite = (std::numeric_limits<uint64_t>::max)();
+
+    int max_nesting_depth_;
+    std::size_t offset_{0};
+    std::vector<uint64_t> counts_; // items remaining in each open container
+
+public:
+    explicit cbor_item_scanner(int max_nesting_depth)
+        : max_nesting_depth_(max_nesting_depth)
+    {
+    }
+
+    void reset()
+    {
+        offset_ = 0;
+        counts_.clear();
+    }
+
+    // Returns the size of the item that starts at data, or 0 if more bytes are needed.
+    // Malformed input is left for the parser to report.
+    std::size_t scan(const uint8_t* data, std::size_t length, std::error_code& ec)
+    {
+        while (offset_ < length)
+        {
+            const uint8_t* p = data + offset_;
+            std::size_t available = length - offset_;
+
+            if (*p == 0xff)
+            {
+                bool closes = !counts_.empty() && counts_.back() == indefinite;
+                ++offset_;
+                if (closes)
+                {
+                    counts_.pop_back();
+                }
+                if (end_item())
+                {
+                    return take();
+                }
+                continue;
+            }
+
+            auto major_type = static_cast<cbor_major_type>(*p >> 5);
+            uint8_t info = *p & 0x1f;
+            std::size_t head = 1;
+            uint64_t val = info;
+            if (info >= 24 && info <= 27)
+            {
+                head += std::size_t(1) << (info - 24);
+                if (available < head)
+                {
+                    return 0;
+                }
+                switch (info)
+                {
+                    case 24:
+                        val = p[1];
+                        break;
+                    case 25:
+                        val = binary::big_to_native<uint16_t>(p+1, 2);
+                        break;
+                    case 26:
+                        val = binary::big_to_native<uint32_t>(p+1, 4);
+                        break;
+                    default:
+                        val = binary::big_to_native<uint64_t>(p+1, 8);
+                        break;
+                }
+            }
+            else if (info >= 28 && info <= 30)
+            {
+                // reserved, left for the parser to report
+                ++offset_;
+                if (end_item())
+                {
+                    return take();
+                }
+                continue;
+            }
+            bool is_indefinite = info == additional_info::indefinite_length;
+
+            switch (major_type)
+            {
+                case cbor_major_type::semantic_tag:
+                    offset_ += head;
+                    continue;
+                case cbor_major_type::byte_string:
+                case cbor_major_type::text_string:
+                    if (is_indefinite)
+                    {
+                        offset_ += head;
+                        open(indefinite, ec);
+                        if (JSONCONS_UNLIKELY(ec))
+                        {
+                            return 0;
+                        }
+                        continue;
+                    }
+                    if (val > available - head)
+                    {
+                        return 0;
+                    }
+                    offset_ += head + static_cast<std::size_t>(val);
+                    break;
+                case cbor_major_type::array:
+                case cbor_major_type::map:
+                    offset_ += head;
+                    if (is_indefinite)
+                    {
+                        open(indefinite, ec);
+                        if (JSONCONS_UNLIKELY(ec))
+                        {
+                            return 0;
+                        }
+                        continue;
+                    }
+                    if (major_type == cbor_major_type::map)
+                    {
+                        if (val > (indefinite-1)/2)
+                        {
+                            ec = cbor_errc::number_too_large;
+                            return 0;
+                        }
+                        val *= 2;
+                    }
+                    if (val > 0)
+                    {
+                        open(val, ec);
+                        if (JSONCONS_UNLIKELY(ec))
+                        {
+                            return 0;
+                        }
+                        continue;
+                    }
+                    break;
+                default:
+                    offset_ += head;
+                    break;
+            }
+            if (end_item())
+            {
+                return take();
+            }
+        }
+        return 0;
+    }
+
+private:
+    void open(uint64_t count, std::error_code& ec)
+    {
+        if (JSONCONS_UNLIKELY(static_cast<int>(counts_.size()) >= max_nesting_depth_))
+        {
+            ec = cbor_errc::max_nesting_depth_exceeded;
+            return;
+        }
+        counts_.push_back(count);
+    }
+
+    bool end_item()
+    {
+        while (!counts_.empty())
+        {
+            if (counts_.back() == indefinite || --counts_.back() > 0)
+            {
+                return false;
+            }
+            counts_.pop_back();
+        }
+        return true;
+    }
+
+    std::size_t take()
+    {
+        std::size_t size = offset_;
+        offset_ = 0;
+        return size;
+    }
+};
+
+} // namespace detail
+
+// A cursor that is fed input with update rather than pulling it from a source.
+// The events of a top level item (e.g. an item of a CBOR sequence) are reported once
+// all of its bytes have arrived, until then next() returns with need_more_input() true.
+template <typename Allocator=std::allocator<char>>
+class basic_cbor_push_cursor : public basic_staj_cursor<char>, private virtual ser_context
+{
+public:
+    using char_type = char;
+    using allocator_type = Allocator;
+    using string_view_type = string_view;
+private:
+    using byte_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<uint8_t>;
+    using cursor_type = basic_cbor_cursor<jsoncons::bytes_source,Allocator>;
+
+    cbor_decode_options options_;
+    allocator_type alloc_;
+    detail::cbor_item_scanner scanner_;
+    std::vector<uint8_t,byte_allocator_type> input_;
+    std::size_t input_pos_{0};
+    std::vector<uint8_t,byte_allocator_type> item_;
+    std::size_t item_position_{0};
+    std::unique_ptr<cursor_type> cursor_;
+    basic_staj_event<char_type> empty_event_{staj_events::null_value};
+    bool loaded_{false};
+    bool need_more_input_{true};
+
+public:
+    basic_cbor_push_cursor(const cbor_decode_options& options = cbor_decode_options(),
+        const Allocator& alloc = Allocator())
+        : options_(options), alloc_(alloc), scanner_(options.max_nesting_depth()), 
+          input_(alloc), item_(alloc)
+    {
+    }
+
+    basic_cbor_push_cursor(const basic_cbor_push_cursor&) = delete;
+    basic_cbor_push_cursor(basic_cbor_push_cursor&&) = default;
+
+    ~basic_cbor_push_cursor() = default;
+
+    basic_cbor_push_cursor& operator=(const basic_cbor_push_cursor&) = delete;
+    basic_cbor_push_cursor& operator=(basic_cbor_push_cursor&&) = default;
+
+    // Appends input. The bytes are copied, so the caller may reuse its buffer 
+    // as soon as update returns.
+    void update(const uint8_t* data, std::size_t length)
+    {
+        if (input_pos_ > 0)
+        {
+            input_.erase(input_.begin(), input_.begin() + input_pos_);
+            input_pos_ = 0;
+        }
+        input_.insert(input_.end(), data, data + length);
+    }
+
+    bool need_more_input() const
+    {
+        return need_more_input_;
+    }
+
+    // Moves on to the next top level item
+    void reset()
+    {
+        std::error_code ec;
+        reset(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,line(),column()));
+        }
+    }
+
+    void reset(std::error_code& ec)
+    {
+        loaded_ = false;
+        load_item(ec);
+    }
+
+    bool done() const final
+    {
+        return loaded_ && cursor_->done();
+    }
+
+    uint64_t raw_tag() const
+    {
+        return loaded_ ? cursor_->raw_tag() : 0;
+    }
+
+    bool is_multi_dim() const final
+    {
+        return loaded_ && cursor_->is_multi_dim();
+    }
+
+    jsoncons::span<const std::size_t> extents() const final
+    {
+        return cursor_->extents();
+    }
+
+    mdarray_order order() const final
+    {
+        return cursor_->order();
+    }
+
+    bool is_typed_array() const final
+    {
+        return loaded_ && cursor_->is_typed_array();
+    }
+
+    typed_array_tags array_tag() const final
+    {
+        return cursor_->array_tag();
+    }
+
+    jsoncons::span<uint8_t> array_buffer() final
+    {
+        return cursor_->array_buffer();
+    }
+
+    void to_end_array() final
+    {
+        cursor_->to_end_array();
+    }
+
+    const staj_event& current() const final
+    {
+        return cursor_ ? cursor_->current() : empty_event_;
+    }
+
+    void read_to(basic_json_visitor<char_type>& visitor) final
+    {
+        std::error_code ec;
+        read_to(visitor, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,line(),column()));
+        }
+    }
+
+    void read_to(basic_json_visitor<char_type>& visitor,
+        std::error_code& ec) final
+    {
+        if (loaded_)
+        {
+            cursor_->read_to(visitor, ec);
+        }
+    }
+
+    void next() final
+    {
+        std::error_code ec;
+        next(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,line(),column()));
+        }
+    }
+
+    void next(std::error_code& ec) final
+    {
+        if (loaded_)
+        {
+            cursor_->next(ec);
+        }
+        else
+        {
+            load_item(ec);
+        }
+    }
+
+    void skip() final
+    {
+        std::error_code ec;
+        skip(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,line(),column()));
+        }
+    }
+
+    void skip(std::error_code& ec) final
+    {
+        if (loaded_)
+        {
+            cursor_->skip(ec);
+        }
+    }
+
+    const ser_context& context() const final
+    {
+        return *this;
+    }
+
+    std::size_t line() const final
+    {
+        return 0;
+    }
+
+    std::size_t column() const final
+    {
+        return loaded_ ? item_position_ + cursor_->column() : item_position_ + item_.size();
+    }
+
+    friend
+    staj_filter_view operator|(basic_cbor_push_cursor& cursor, 
+        std::function<bool(const staj_event&, const ser_context&)> pred)
+    {
+        return staj_filter_view(cursor, pred);
+    }
+
+private:
+
+    void load_item(std::error_code& ec)
+    {
+        std::size_t length = scanner_.scan(input_.data() + input_pos_, input_.size() - input_pos_, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            return;
+        }
+        if (length == 0)
+        {
+            need_more_input_ = true;
+            return;
+        }
+        need_more_input_ = false;
+
+        item_position_ += item_.size();
+        if (input_pos_ == 0 && length == input_.size())
+        {
+            item_.swap(input_);
+            input_.clear();
+        }
+        else
+        {
+            item_.assign(input_.begin() + input_pos_, input_.begin() + (input_pos_ + length));
+            input_pos_ += length;
+        }
+
+        if (!cursor_)
+        {
+            cursor_ = std::unique_ptr<cursor_type>(new cursor_type(std::allocator_arg, alloc_, item_, options_, ec));
+        }
+        else
+        {
+            cursor_->reset(item_, ec);
+        }
+        loaded_ = true;
+    }
+};
+
 using cbor_stream_cursor = basic_cbor_cursor<jsoncons::binary_stream_source>;
 using cbor_bytes_cursor = basic_cbor_cursor<jsoncons::bytes_source>;
+using cbor_push_cursor = basic_cbor_push_cursor<>;
 
 } // namespace cbor
 } // namespace jsoncons
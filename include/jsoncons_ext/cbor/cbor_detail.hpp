@@ -80,6 +80,24 @@ size_t min_length_for_stringref(uint64_t index)
     return n;
 }
 
+// FNV-1a hash over the bytes of a text or byte string, for stringref tables
+struct stringref_hash
+{
+    template <typename StringT>
+    std::size_t operator()(const StringT& s) const noexcept
+    {
+        uint64_t hash = 14695981039346656037ull;
+        const auto* p = s.data();
+        const auto* last = p + s.size();
+        for (; p != last; ++p)
+        {
+            hash ^= static_cast<uint8_t>(*p);
+            hash *= 1099511628211ull;
+        }
+        return static_cast<std::size_t>(hash);
+    }
+};
+
 } // namespace detail 
 } // namespace cbor
 } // namespace jsoncons
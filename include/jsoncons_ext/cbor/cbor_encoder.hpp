@@ -11,11 +11,11 @@
 #include <cstdint>
 #include <cstring>
 #include <limits> // std::numeric_limits
-#include <map>
 #include <memory>
 #include <string>
 #include <system_error>
 #include <type_traits>
+#include <unordered_map>
 #include <utility> // std::move
 #include <vector>
 
@@ -110,9 +110,10 @@ private:
     allocator_type alloc_;
 
     std::vector<stack_item,stack_item_allocator_type> stack_;
-    std::map<string_type,size_t,std::less<string_type>,string_size_allocator_type> stringref_map_;
-    std::map<byte_string_type,size_t,std::less<byte_string_type>,byte_string_size_allocator_type> bytestringref_map_;
+    std::unordered_map<string_type,size_t,jsoncons::cbor::detail::stringref_hash,std::equal_to<string_type>,string_size_allocator_type> stringref_map_;
+    std::unordered_map<byte_string_type,size_t,jsoncons::cbor::detail::stringref_hash,std::equal_to<byte_string_type>,byte_string_size_allocator_type> bytestringref_map_;
     std::size_t next_stringref_ = 0;
+    std::size_t dictionary_size_ = 0;
     int nesting_depth_{0};
 public:
 
@@ -139,6 +140,11 @@ public:
     {
         if (options.pack_strings())
         {
+            for (const auto& item : options.stringref_dictionary())
+            {
+                stringref_map_.emplace(string_type(item.data(), item.size(), alloc_), next_stringref_++);
+            }
+            dictionary_size_ = next_stringref_;
             write_tag(256);
         }
     }
@@ -160,9 +166,20 @@ public:
     void reset()
     {
         stack_.clear();
-        stringref_map_.clear();
+        // Keep the pre-seeded dictionary entries
+        for (auto it = stringref_map_.begin(); it != stringref_map_.end();)
+        {
+            if ((*it).second >= dictionary_size_)
+            {
+                it = stringref_map_.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
         bytestringref_map_.clear();
-        next_stringref_ = 0;
+        next_stringref_ = dictionary_size_;
         nesting_depth_ = 0;
     }
 
@@ -464,19 +481,29 @@ private:
             JSONCONS_THROW(ser_error(cbor_errc::invalid_utf8_text_string));
         }
 
-        if (pack_strings_ && sv.size() >= jsoncons::cbor::detail::min_length_for_stringref(next_stringref_))
+        if (pack_strings_ && sv.size() >= jsoncons::cbor::detail::min_length_for_stringref(0))
         {
             string_type s(sv.data(), sv.size(), alloc_);
             auto it = stringref_map_.find(s);
-            if (it == stringref_map_.end())
+            if (it != stringref_map_.end())
             {
-                stringref_map_.emplace(std::make_pair(std::move(s), next_stringref_++));
-                write_utf8_string(sv);
+                if (sv.size() >= jsoncons::cbor::detail::min_length_for_stringref((*it).second))
+                {
+                    write_tag(25);
+                    write_uint64_value((*it).second);
+                }
+                else
+                {
+                    write_utf8_string(sv);
+                }
             }
             else
             {
-                write_tag(25);
-                write_uint64_value((*it).second);
+                if (sv.size() >= jsoncons::cbor::detail::min_length_for_stringref(next_stringref_))
+                {
+                    stringref_map_.emplace(std::make_pair(std::move(s), next_stringref_++));
+                }
+                write_utf8_string(sv);
             }
         }
         else
@@ -8,6 +8,8 @@
 #define JSONCONS_EXT_CBOR_CBOR_OPTIONS_HPP
 
 #include <cwchar>
+#include <string>
+#include <vector>
 
 #include <jsoncons_ext/cbor/cbor_detail.hpp>
 
@@ -21,6 +23,7 @@ class cbor_options_common
     friend class cbor_options;
 
     int max_nesting_depth_{1024};
+    std::vector<std::string> stringref_dictionary_;
 protected:
     cbor_options_common() = default;
     cbor_options_common(const cbor_options_common&) = default;
@@ -33,6 +36,13 @@ public:
     {
         return max_nesting_depth_;
     }
+
+    // Strings agreed by encoder and decoder that occupy the first indexes 
+    // of the outermost stringref namespace
+    const std::vector<std::string>& stringref_dictionary() const 
+    {
+        return stringref_dictionary_;
+    }
 };
 
 class cbor_decode_options : public virtual cbor_options_common
@@ -72,6 +82,7 @@ class cbor_options final : public cbor_decode_options, public cbor_encode_option
 {
 public:
     using cbor_options_common::max_nesting_depth;
+    using cbor_options_common::stringref_dictionary;
     using cbor_encode_options::pack_strings;
     using cbor_encode_options::use_typed_arrays;
 
@@ -85,6 +96,12 @@ public:
         return *this;
     }
 
+    cbor_options& stringref_dictionary(const std::vector<std::string>& value)
+    {
+        this->stringref_dictionary_ = value;
+        return *this;
+    }
+
     cbor_options& pack_strings(bool value)
     {
         this->use_stringref_ = value;
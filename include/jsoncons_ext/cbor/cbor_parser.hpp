@@ -147,6 +147,7 @@ class basic_cbor_parser : public ser_context
     std::vector<parse_state,parse_state_allocator_type> state_stack_;
     std::vector<std::shared_ptr<typed_array_iterator>> multi_dim_stack_;
     std::vector<stringref_map,stringref_map_allocator_type> stringref_map_stack_;
+    stringref_map dictionary_;
     mdarray_order order_{};
     typed_array_tags array_tag_{};
     semantic_tag typed_array_tag_{};
@@ -200,9 +201,14 @@ public:
          text_buffer_(alloc),
          bytes_buffer_(alloc),
          state_stack_(alloc),
-         stringref_map_stack_(alloc)
+         stringref_map_stack_(alloc),
+         dictionary_(alloc)
     {
         state_stack_.emplace_back(parse_mode::root,0);
+        for (const auto& item : options.stringref_dictionary())
+        {
+            dictionary_.emplace_back(mapped_string(string_type(item.data(), item.size(), alloc), alloc));
+        }
     }
     
     basic_cbor_parser(const basic_cbor_parser&) = delete;
@@ -241,7 +247,7 @@ public:
     }
     mdarray_order order() const
     {
-        return typed_array_iter_->order();
+        return is_multi_dim() ? order_ : typed_array_iter_->order();
     }
 
     typed_array_tags array_tag() const
@@ -256,7 +262,8 @@ public:
 
     jsoncons::span<const std::size_t> extents() const 
     {
-        return typed_array_iter_->extents();
+        // In cursor mode the storage of a multi-dimensional typed array is reported as one dimensional
+        return is_multi_dim() ? jsoncons::span<const std::size_t>(extents_.data(), extents_.size()) : typed_array_iter_->extents();
     }
 
     template <typename Sourceable>
@@ -316,7 +323,77 @@ public:
         state_stack_.pop_back();
     }
 
-    void parse(item_event_visitor& visitor, std::error_code& ec)
+    bool can_skip_container() const
+    {
+        if (is_typed_array() || is_multi_dim())
+        {
+            return false;
+        }
+        // Strings inside the container may be referenced later through an enclosing stringref namespace
+        std::size_t own_namespaces = state_stack_.back().pop_stringref_map_stack ? 1 : 0;
+        return stringref_map_stack_.size() <= own_namespaces;
+    }
+
+    // Consumes the remaining items of the innermost array or map without reporting them,
+    // so that the next call to parse reports the end of the container. Only the major types
+    // and length headers are examined.
+    void skip_container(std::error_code& ec)
+    {
+        switch (state_stack_.back().mode)
+        {
+            case parse_mode::array:
+                while (state_stack_.back().index < state_stack_.back().length)
+                {
+                    ++state_stack_.back().index;
+                    skip_item(0, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                }
+                break;
+            case parse_mode::map_value:
+            case parse_mode::map_key:
+                if (state_stack_.back().mode == parse_mode::map_value)
+                {
+                    state_stack_.back().mode = parse_mode::map_key;
+                    skip_item(0, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                }
+                while (state_stack_.back().index < state_stack_.back().length)
+                {
+                    ++state_stack_.back().index;
+                    skip_item(0, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                    skip_item(0, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                }
+                break;
+            case parse_mode::indefinite_array:
+            case parse_mode::indefinite_map_key:
+            case parse_mode::indefinite_map_value:
+                if (state_stack_.back().mode != parse_mode::indefinite_array)
+                {
+                    state_stack_.back().mode = parse_mode::indefinite_map_key;
+                }
+                skip_to_break(0, ec);
+                break;
+            default:
+                break;
+        }
+    }
+
+    template <typename Visitor>
+    void parse(Visitor& visitor, std::error_code& ec)
     {
         while (!done_ && more_)
         {
@@ -543,7 +620,8 @@ public:
         }
     }
 
-    void read_typed_array_item(item_event_visitor& visitor, std::error_code& ec)
+    template <typename Visitor>
+    void read_typed_array_item(Visitor& visitor, std::error_code& ec)
     {
         if (!typed_array_iter_->done())
         {
@@ -561,7 +639,8 @@ public:
         }
     }
 
-    void read_item(item_event_visitor& visitor, std::error_code& ec)
+    template <typename Visitor>
+    void read_item(Visitor& visitor, std::error_code& ec)
     {
         read_tags(ec);
         if (JSONCONS_UNLIKELY(ec))
@@ -590,7 +669,7 @@ public:
                 if (!stringref_map_stack_.empty() && other_tags_[stringref_tag])
                 {
                     other_tags_[stringref_tag] = false;
-                    if (val >= stringref_map_stack_.back().size())
+                    if (val >= stringref_count())
                     {
                         ec = cbor_errc::stringref_too_large;
                         more_ = false;
@@ -603,7 +682,7 @@ public:
                         more_ = false;
                         return;
                     }
-                    auto& str = stringref_map_stack_.back().at(index);
+                    const auto& str = stringref_at(index);
                     switch (str.type)
                     {
                         case jsoncons::cbor::detail::cbor_major_type::text_string:
@@ -676,6 +755,26 @@ public:
             }
             case jsoncons::cbor::detail::cbor_major_type::byte_string:
             {
+                if (!other_tags_[item_tag] && stringref_map_stack_.empty() && 
+                    info != jsoncons::cbor::detail::additional_info::indefinite_length)
+                {
+                    // Definite length and untagged, may be a view of the input 
+                    std::size_t length = read_size(ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                    auto bytes = source_reader<Source>::read_view(source_, bytes_buffer_, length);
+                    if (JSONCONS_UNLIKELY(bytes.size() != length))
+                    {
+                        ec = cbor_errc::unexpected_eof;
+                        more_ = false;
+                        return;
+                    }
+                    visitor.byte_string_value(byte_string_view(bytes.data(), bytes.size()), semantic_tag::none, *this, ec);
+                    more_ = !cursor_mode_;
+                    break;
+                }
                 read_byte_string_from_source read(this);
                 read_byte_string(read, visitor, ec);
                 if (JSONCONS_UNLIKELY(ec))
@@ -686,21 +785,43 @@ public:
             }
             case jsoncons::cbor::detail::cbor_major_type::text_string:
             {
-                text_buffer_.clear();
-
-                read_text_string(text_buffer_, ec);
-                if (JSONCONS_UNLIKELY(ec))
+                jsoncons::basic_string_view<char> sv;
+                if (stringref_map_stack_.empty() && 
+                    info != jsoncons::cbor::detail::additional_info::indefinite_length)
                 {
-                    return;
+                    // Definite length and not a stringref candidate, may be a view of the input 
+                    std::size_t length = read_size(ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                    auto chars = source_reader<Source>::read_view(source_, text_buffer_, length);
+                    if (JSONCONS_UNLIKELY(chars.size() != length))
+                    {
+                        ec = cbor_errc::unexpected_eof;
+                        more_ = false;
+                        return;
+                    }
+                    sv = jsoncons::basic_string_view<char>(chars.data(), chars.size());
+                }
+                else
+                {
+                    text_buffer_.clear();
+                    read_text_string(text_buffer_, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                    sv = jsoncons::basic_string_view<char>(text_buffer_.data(),text_buffer_.length());
                 }
-                auto result = unicode_traits::validate(text_buffer_.data(),text_buffer_.size());
+                auto result = unicode_traits::validate(sv.data(),sv.size());
                 if (result.ec != unicode_traits::conv_errc())
                 {
                     ec = cbor_errc::invalid_utf8_text_string;
                     more_ = false;
                     return;
                 }
-                handle_string(visitor, jsoncons::basic_string_view<char>(text_buffer_.data(),text_buffer_.length()),ec);
+                handle_string(visitor, sv, ec);
                 if (JSONCONS_UNLIKELY(ec))
                 {
                     return;
@@ -887,7 +1008,8 @@ public:
     }
 private:
 
-    void begin_array(item_event_visitor& visitor, uint8_t info, std::error_code& ec)
+    template <typename Visitor>
+    void begin_array(Visitor& visitor, uint8_t info, std::error_code& ec)
     {
         if (JSONCONS_UNLIKELY(++nesting_depth_ > max_nesting_depth_))
         {
@@ -936,7 +1058,8 @@ private:
         }
     }
 
-    void end_array(item_event_visitor& visitor, std::error_code& ec)
+    template <typename Visitor>
+    void end_array(Visitor& visitor, std::error_code& ec)
     {
         --nesting_depth_;
 
@@ -1011,7 +1134,8 @@ private:
         state_stack_.pop_back();
     }
 
-    void begin_object(item_event_visitor& visitor, uint8_t info, std::error_code& ec)
+    template <typename Visitor>
+    void begin_object(Visitor& visitor, uint8_t info, std::error_code& ec)
     {
         if (JSONCONS_UNLIKELY(++nesting_depth_ > max_nesting_depth_))
         {
@@ -1059,7 +1183,8 @@ private:
         }
     }
 
-    void end_object(item_event_visitor& visitor, std::error_code& ec)
+    template <typename Visitor>
+    void end_object(Visitor& visitor, std::error_code& ec)
     {
         --nesting_depth_;
         visitor.end_object(*this, ec);
@@ -1079,6 +1204,22 @@ private:
         state_stack_.pop_back();
     }
 
+    // The outermost namespace begins with the pre-seeded dictionary
+    std::size_t stringref_count() const
+    {
+        std::size_t count = stringref_map_stack_.back().size();
+        return stringref_map_stack_.size() == 1 ? dictionary_.size() + count : count;
+    }
+
+    const mapped_string& stringref_at(std::size_t index) const
+    {
+        if (stringref_map_stack_.size() == 1)
+        {
+            return index < dictionary_.size() ? dictionary_[index] : stringref_map_stack_.back()[index - dictionary_.size()];
+        }
+        return stringref_map_stack_.back()[index];
+    }
+
     void read_text_string(string_type& str, std::error_code& ec)
     {
         auto c = source_.peek();
@@ -1109,7 +1250,7 @@ private:
 
         if (!stringref_map_stack_.empty() && 
             info != jsoncons::cbor::detail::additional_info::indefinite_length &&
-            str.length() >= jsoncons::cbor::detail::min_length_for_stringref(stringref_map_stack_.back().size()))
+            str.length() >= jsoncons::cbor::detail::min_length_for_stringref(stringref_count()))
         {
             stringref_map_stack_.back().emplace_back(mapped_string(str,alloc_));
         }
@@ -1179,7 +1320,7 @@ private:
                     return;
                 }
                 if (!stringref_map_stack_.empty() &&
-                    v.size() >= jsoncons::cbor::detail::min_length_for_stringref(stringref_map_stack_.back().size()))
+                    v.size() >= jsoncons::cbor::detail::min_length_for_stringref(stringref_count()))
                 {
                     stringref_map_stack_.back().emplace_back(mapped_string(v, alloc_));
                 }
@@ -1836,7 +1977,8 @@ private:
         }
     }
 
-    void handle_string(item_event_visitor& visitor, const jsoncons::basic_string_view<char>& v, std::error_code& ec)
+    template <typename Visitor>
+    void handle_string(Visitor& visitor, const jsoncons::basic_string_view<char>& v, std::error_code& ec)
     {
         semantic_tag tag = semantic_tag::none;
         if (other_tags_[item_tag])
@@ -1877,8 +2019,8 @@ private:
         return std::size_t(1) << (f + ll); 
     }
 
-    template <typename Read>
-    void read_byte_string(Read read, item_event_visitor& visitor, std::error_code& ec)
+    template <typename Read,typename Visitor>
+    void read_byte_string(Read read, Visitor& visitor, std::error_code& ec)
     {
         if (other_tags_[item_tag])
         {
@@ -2454,7 +2596,144 @@ private:
         }
     }
 
-    void read_mdarray_header(item_event_visitor& visitor, std::error_code& ec)
+    void skip_bytes(std::size_t length, std::error_code& ec)
+    {
+        std::size_t position = source_.position();
+        source_.ignore(length);
+        if (JSONCONS_UNLIKELY(source_.position() - position != length))
+        {
+            ec = cbor_errc::unexpected_eof;
+            more_ = false;
+        }
+    }
+
+    // Skips items up to but not including the 0xff break 
+    void skip_to_break(int depth, std::error_code& ec)
+    {
+        while (true)
+        {
+            auto c = source_.peek();
+            if (JSONCONS_UNLIKELY(c.eof))
+            {
+                ec = cbor_errc::unexpected_eof;
+                more_ = false;
+                return;
+            }
+            if (c.value == 0xff)
+            {
+                return;
+            }
+            skip_item(depth, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+        }
+    }
+
+    void skip_item(int depth, std::error_code& ec)
+    {
+        auto c = source_.peek();
+        if (JSONCONS_UNLIKELY(c.eof))
+        {
+            ec = cbor_errc::unexpected_eof;
+            more_ = false;
+            return;
+        }
+        while (get_major_type(c.value) == jsoncons::cbor::detail::cbor_major_type::semantic_tag)
+        {
+            read_uint64(ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+            c = source_.peek();
+            if (JSONCONS_UNLIKELY(c.eof))
+            {
+                ec = cbor_errc::unexpected_eof;
+                more_ = false;
+                return;
+            }
+        }
+        jsoncons::cbor::detail::cbor_major_type major_type = get_major_type(c.value);
+        uint8_t info = get_additional_information_value(c.value);
+
+        switch (major_type)
+        {
+            case jsoncons::cbor::detail::cbor_major_type::unsigned_integer:
+            case jsoncons::cbor::detail::cbor_major_type::negative_integer:
+                read_uint64(ec);
+                break;
+            case jsoncons::cbor::detail::cbor_major_type::byte_string:
+            case jsoncons::cbor::detail::cbor_major_type::text_string:
+            {
+                auto func = [this](Source&, std::size_t length, std::error_code& ec) -> bool
+                {
+                    skip_bytes(length, ec);
+                    return !ec;
+                };
+                iterate_string_chunks(func, major_type, ec);
+                break;
+            }
+            case jsoncons::cbor::detail::cbor_major_type::array:
+            case jsoncons::cbor::detail::cbor_major_type::map:
+            {
+                if (JSONCONS_UNLIKELY(nesting_depth_ + (++depth) > max_nesting_depth_))
+                {
+                    ec = cbor_errc::max_nesting_depth_exceeded;
+                    more_ = false;
+                    return;
+                }
+                if (info == jsoncons::cbor::detail::additional_info::indefinite_length)
+                {
+                    source_.ignore(1);
+                    skip_to_break(depth, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                    source_.ignore(1);
+                }
+                else
+                {
+                    std::size_t len = read_size(ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                    std::size_t count = major_type == jsoncons::cbor::detail::cbor_major_type::map ? 2 : 1;
+                    for (std::size_t i = 0; i < len; ++i)
+                    {
+                        for (std::size_t j = 0; j < count; ++j)
+                        {
+                            skip_item(depth, ec);
+                            if (JSONCONS_UNLIKELY(ec))
+                            {
+                                return;
+                            }
+                        }
+                    }
+                }
+                break;
+            }
+            case jsoncons::cbor::detail::cbor_major_type::simple:
+                if (info <= 0x1b)
+                {
+                    read_uint64(ec);
+                }
+                else
+                {
+                    ec = cbor_errc::unknown_type;
+                    more_ = false;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    template <typename Visitor>
+    void read_mdarray_header(Visitor& visitor, std::error_code& ec)
     {
         uint8_t b;
         if (source_.read(&b, 1) == 0)
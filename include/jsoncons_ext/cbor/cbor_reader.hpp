@@ -24,18 +24,20 @@
 namespace jsoncons { 
 namespace cbor {
 
-template <typename Source,typename Allocator=std::allocator<char>>
+// Visitor may be a concrete visitor type, e.g. an encoder, so that the parser's calls
+// reach it without virtual dispatch
+template <typename Source,typename Allocator=std::allocator<char>,typename Visitor=json_visitor>
 class basic_cbor_reader 
 {
     using char_type = char;
 
     basic_cbor_parser<Source,Allocator> parser_;
-    basic_item_event_visitor_to_json_visitor<char_type,Allocator> adaptor_;
-    item_event_visitor& visitor_;
+    basic_item_event_visitor_to_json_visitor<char_type,Allocator,Visitor> adaptor_;
+    item_event_visitor* visitor_{nullptr};
 public:
     template <typename Sourceable>
     basic_cbor_reader(Sourceable&& source, 
-                      json_visitor& visitor, 
+                      Visitor& visitor, 
                       const Allocator& alloc)
        : basic_cbor_reader(std::forward<Sourceable>(source),
                            visitor,
@@ -46,11 +48,11 @@ public:
 
     template <typename Sourceable>
     basic_cbor_reader(Sourceable&& source, 
-                      json_visitor& visitor, 
+                      Visitor& visitor, 
                       const cbor_decode_options& options = cbor_decode_options(),
                       const Allocator& alloc=Allocator())
        : parser_(std::forward<Sourceable>(source), options, alloc),
-         adaptor_(visitor, alloc), visitor_(adaptor_)
+         adaptor_(visitor, alloc)
     {
     }
     template <typename Sourceable>
@@ -70,7 +72,7 @@ public:
                       const cbor_decode_options& options = cbor_decode_options(),
                       const Allocator& alloc=Allocator())
        : parser_(std::forward<Sourceable>(source), options, alloc),
-         visitor_(visitor)
+         visitor_(std::addressof(visitor))
     {
     }
 
@@ -87,7 +89,14 @@ public:
     void read(std::error_code& ec)
     {
         parser_.reset();
-        parser_.parse(visitor_, ec);
+        if (visitor_ != nullptr)
+        {
+            parser_.parse(*visitor_, ec);
+        }
+        else
+        {
+            parser_.parse(adaptor_, ec);
+        }
         if (JSONCONS_UNLIKELY(ec))
         {
             return;
@@ -0,0 +1,945 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_EXT_CBOR_CBOR_VIEW_HPP
+#define JSONCONS_EXT_CBOR_CBOR_VIEW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <iterator>
+#include <limits> // std::numeric_limits
+#include <stdexcept>
+#include <vector>
+
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/detail/span.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/utility/binary.hpp>
+#include <jsoncons/utility/byte_string.hpp>
+
+#include <jsoncons_ext/cbor/cbor_detail.hpp>
+#include <jsoncons_ext/cbor/cbor_error.hpp>
+
+namespace jsoncons {
+namespace cbor {
+
+class cbor_array_iterator;
+class cbor_object_iterator;
+class cbor_indexed_view;
+
+// A read-only view of one encoded CBOR data item. Arrays and maps are navigated
+// by skipping over the items that precede the one requested, and scalar values
+// are decoded from the underlying bytes when requested. Stringrefs are not resolved.
+// A view holds no mutable state, so one view may be read from several threads.
+class cbor_view
+{
+    static constexpr int max_nesting_depth = 1024;
+    // Item count of an indefinite length container, which ends at a break byte
+    static constexpr uint64_t indefinite_count = (std::numeric_limits<uint64_t>::max)();
+
+    struct item_header
+    {
+        uint8_t major_type;
+        uint8_t info;
+        uint64_t value;
+        std::size_t length;
+    };
+
+    const uint8_t* data_{nullptr};
+    // The length of the item if sized_, otherwise the number of bytes available to it
+    std::size_t length_{0};
+    bool sized_{false};
+
+    friend class cbor_array_iterator;
+    friend class cbor_object_iterator;
+    friend class cbor_indexed_view;
+public:
+    using array_iterator = cbor_array_iterator;
+    using object_iterator = cbor_object_iterator;
+
+    cbor_view() = default;
+
+    // Views the first data item in [data, data+length). The item is not scanned
+    // until it is read, and only as far as the read requires.
+    cbor_view(const uint8_t* data, std::size_t length)
+        : data_(data), length_(length)
+    {
+    }
+
+    explicit cbor_view(const jsoncons::span<const uint8_t>& bytes)
+        : cbor_view(bytes.data(), bytes.size())
+    {
+    }
+
+    // The encoded data item
+    jsoncons::span<const uint8_t> bytes() const
+    {
+        if (sized_ || data_ == nullptr)
+        {
+            return jsoncons::span<const uint8_t>(data_, length_);
+        }
+        return jsoncons::span<const uint8_t>(data_, static_cast<std::size_t>(skip(data_, data_ + length_, 0) - data_));
+    }
+
+    // Sets ec rather than throwing if the item cannot be read
+    jsoncons::span<const uint8_t> bytes(std::error_code& ec) const
+    {
+        if (sized_ || data_ == nullptr)
+        {
+            return jsoncons::span<const uint8_t>(data_, length_);
+        }
+        const uint8_t* last = skip(data_, data_ + length_, 0, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            return jsoncons::span<const uint8_t>();
+        }
+        return jsoncons::span<const uint8_t>(data_, static_cast<std::size_t>(last - data_));
+    }
+
+    bool has_tag() const
+    {
+        return data_ != nullptr && major_type(data_) == detail::cbor_major_type::semantic_tag;
+    }
+
+    // The outermost tag
+    uint64_t tag() const
+    {
+        if (!has_tag())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a tagged item"));
+        }
+        return read_header(data_, data_ + length_).value;
+    }
+
+    bool is_null() const
+    {
+        auto h = content_header();
+        return h.major_type == static_cast<uint8_t>(detail::cbor_major_type::simple) && h.info == 22;
+    }
+
+    bool is_bool() const
+    {
+        auto h = content_header();
+        return h.major_type == static_cast<uint8_t>(detail::cbor_major_type::simple) && (h.info == 20 || h.info == 21);
+    }
+
+    bool is_uint64() const
+    {
+        return content_header().major_type == static_cast<uint8_t>(detail::cbor_major_type::unsigned_integer);
+    }
+
+    bool is_int64() const
+    {
+        auto h = content_header();
+        switch (static_cast<detail::cbor_major_type>(h.major_type))
+        {
+            case detail::cbor_major_type::unsigned_integer:
+            case detail::cbor_major_type::negative_integer:
+                return h.value <= static_cast<uint64_t>((std::numeric_limits<int64_t>::max)());
+            default:
+                return false;
+        }
+    }
+
+    bool is_double() const
+    {
+        auto h = content_header();
+        return h.major_type == static_cast<uint8_t>(detail::cbor_major_type::simple) && h.info >= 25 && h.info <= 27;
+    }
+
+    bool is_string() const
+    {
+        return content_header().major_type == static_cast<uint8_t>(detail::cbor_major_type::text_string);
+    }
+
+    bool is_byte_string() const
+    {
+        return content_header().major_type == static_cast<uint8_t>(detail::cbor_major_type::byte_string);
+    }
+
+    bool is_array() const
+    {
+        return content_header().major_type == static_cast<uint8_t>(detail::cbor_major_type::array);
+    }
+
+    bool is_object() const
+    {
+        return content_header().major_type == static_cast<uint8_t>(detail::cbor_major_type::map);
+    }
+
+    bool as_bool() const
+    {
+        if (!is_bool())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a bool"));
+        }
+        return content_header().info == 21;
+    }
+
+    uint64_t as_uint64() const
+    {
+        auto h = content_header();
+        if (h.major_type != static_cast<uint8_t>(detail::cbor_major_type::unsigned_integer))
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an unsigned integer"));
+        }
+        return h.value;
+    }
+
+    int64_t as_int64() const
+    {
+        if (!is_int64())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an int64"));
+        }
+        auto h = content_header();
+        return h.major_type == static_cast<uint8_t>(detail::cbor_major_type::unsigned_integer) ?
+            static_cast<int64_t>(h.value) : -1 - static_cast<int64_t>(h.value);
+    }
+
+    double as_double() const
+    {
+        auto h = content_header();
+        if (h.major_type == static_cast<uint8_t>(detail::cbor_major_type::simple))
+        {
+            switch (h.info)
+            {
+                case 25:
+                    return binary::decode_half(static_cast<uint16_t>(h.value));
+                case 26:
+                {
+                    uint32_t bits = static_cast<uint32_t>(h.value);
+                    float val;
+                    std::memcpy(&val, &bits, sizeof(val));
+                    return val;
+                }
+                case 27:
+                {
+                    double val;
+                    std::memcpy(&val, &h.value, sizeof(val));
+                    return val;
+                }
+                default:
+                    break;
+            }
+        }
+        else if (is_int64())
+        {
+            return static_cast<double>(as_int64());
+        }
+        else if (is_uint64())
+        {
+            return static_cast<double>(h.value);
+        }
+        JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a double"));
+    }
+
+    // Definite length text strings
+    jsoncons::string_view as_string_view() const
+    {
+        auto s = definite_string(detail::cbor_major_type::text_string);
+        return jsoncons::string_view(reinterpret_cast<const char*>(s.data()), s.size());
+    }
+
+    // Definite length byte strings
+    byte_string_view as_byte_string_view() const
+    {
+        auto s = definite_string(detail::cbor_major_type::byte_string);
+        return byte_string_view(s.data(), s.size());
+    }
+
+    // The number of elements of an array or members of a map
+    std::size_t size() const
+    {
+        auto h = content_header();
+        switch (static_cast<detail::cbor_major_type>(h.major_type))
+        {
+            case detail::cbor_major_type::array:
+            case detail::cbor_major_type::map:
+                if (h.info != detail::additional_info::indefinite_length)
+                {
+                    return static_cast<std::size_t>(h.value);
+                }
+                return count_children()/(h.major_type == static_cast<uint8_t>(detail::cbor_major_type::array) ? 1 : 2);
+            default:
+                return 0;
+        }
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    range<array_iterator,array_iterator> array_range() const;
+
+    range<object_iterator,object_iterator> object_range() const;
+
+    // Finds the first member with a text string key equal to key
+    object_iterator find(const jsoncons::string_view& key) const;
+
+    bool contains(const jsoncons::string_view& key) const;
+
+    cbor_view at(const jsoncons::string_view& key) const;
+
+    // The element at position index of an array
+    cbor_view at(std::size_t index) const;
+
+    cbor_view operator[](const jsoncons::string_view& key) const
+    {
+        return at(key);
+    }
+
+    // Records the positions of the children of an array or map, for repeated lookups
+    cbor_indexed_view index() const;
+private:
+    cbor_view(const uint8_t* data, std::size_t length, int)
+        : data_(data), length_(length), sized_(true)
+    {
+    }
+
+    static detail::cbor_major_type major_type(const uint8_t* p)
+    {
+        return static_cast<detail::cbor_major_type>((*p & 0xe0) >> 5);
+    }
+
+    static item_header read_header(const uint8_t* p, const uint8_t* last)
+    {
+        std::error_code ec;
+        auto h = read_header(p, last, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec));
+        }
+        return h;
+    }
+
+    static item_header read_header(const uint8_t* p, const uint8_t* last, std::error_code& ec)
+    {
+        item_header h{0, 0, 0, 0};
+        if (JSONCONS_UNLIKELY(p >= last))
+        {
+            ec = cbor_errc::unexpected_eof;
+            return h;
+        }
+        h.major_type = static_cast<uint8_t>((*p & 0xe0) >> 5);
+        h.info = static_cast<uint8_t>(*p & 0x1f);
+        std::size_t available = static_cast<std::size_t>(last - p) - 1;
+        switch (h.info)
+        {
+            case 24:
+                h.length = 1 + sizeof(uint8_t);
+                if (JSONCONS_UNLIKELY(available < sizeof(uint8_t))) {ec = cbor_errc::unexpected_eof; return h;}
+                h.value = p[1];
+                break;
+            case 25:
+                h.length = 1 + sizeof(uint16_t);
+                if (JSONCONS_UNLIKELY(available < sizeof(uint16_t))) {ec = cbor_errc::unexpected_eof; return h;}
+                h.value = binary::big_to_native<uint16_t>(p + 1, available);
+                break;
+            case 26:
+                h.length = 1 + sizeof(uint32_t);
+                if (JSONCONS_UNLIKELY(available < sizeof(uint32_t))) {ec = cbor_errc::unexpected_eof; return h;}
+                h.value = binary::big_to_native<uint32_t>(p + 1, available);
+                break;
+            case 27:
+                h.length = 1 + sizeof(uint64_t);
+                if (JSONCONS_UNLIKELY(available < sizeof(uint64_t))) {ec = cbor_errc::unexpected_eof; return h;}
+                h.value = binary::big_to_native<uint64_t>(p + 1, available);
+                break;
+            case 28:
+            case 29:
+            case 30:
+                ec = cbor_errc::unknown_type;
+                return h;
+            case detail::additional_info::indefinite_length:
+                h.length = 1;
+                h.value = 0;
+                break;
+            default:
+                h.length = 1;
+                h.value = h.info;
+                break;
+        }
+        return h;
+    }
+
+    // Returns a pointer past the data item that starts at p
+    static const uint8_t* skip(const uint8_t* p, const uint8_t* last, int depth)
+    {
+        std::error_code ec;
+        const uint8_t* q = skip(p, last, depth, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec));
+        }
+        return q;
+    }
+
+    // Returns a pointer past the data item that starts at p, or nullptr on error
+    static const uint8_t* skip(const uint8_t* p, const uint8_t* last, int depth, std::error_code& ec)
+    {
+        if (JSONCONS_UNLIKELY(depth > max_nesting_depth))
+        {
+            ec = cbor_errc::max_nesting_depth_exceeded;
+            return nullptr;
+        }
+        auto h = read_header(p, last, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            return nullptr;
+        }
+        const uint8_t* q = p + h.length;
+        switch (static_cast<detail::cbor_major_type>(h.major_type))
+        {
+            case detail::cbor_major_type::unsigned_integer:
+            case detail::cbor_major_type::negative_integer:
+                if (JSONCONS_UNLIKELY(h.info == detail::additional_info::indefinite_length))
+                {
+                    ec = cbor_errc::unknown_type;
+                    return nullptr;
+                }
+                return q;
+            case detail::cbor_major_type::byte_string:
+            case detail::cbor_major_type::text_string:
+                if (h.info == detail::additional_info::indefinite_length)
+                {
+                    while (true)
+                    {
+                        if (JSONCONS_UNLIKELY(q >= last))
+                        {
+                            ec = cbor_errc::unexpected_eof;
+                            return nullptr;
+                        }
+                        if (*q == 0xff)
+                        {
+                            return q + 1;
+                        }
+                        auto chunk = read_header(q, last, ec);
+                        if (JSONCONS_UNLIKELY(ec))
+                        {
+                            return nullptr;
+                        }
+                        if (JSONCONS_UNLIKELY(chunk.major_type != h.major_type || chunk.info == detail::additional_info::indefinite_length))
+                        {
+                            ec = cbor_errc::illegal_chunked_string;
+                            return nullptr;
+                        }
+                        q = advance(q + chunk.length, chunk.value, last, ec);
+                        if (JSONCONS_UNLIKELY(ec))
+                        {
+                            return nullptr;
+                        }
+                    }
+                }
+                return advance(q, h.value, last, ec);
+            case detail::cbor_major_type::array:
+            case detail::cbor_major_type::map:
+            {
+                if (h.info == detail::additional_info::indefinite_length)
+                {
+                    while (true)
+                    {
+                        if (JSONCONS_UNLIKELY(q >= last))
+                        {
+                            ec = cbor_errc::unexpected_eof;
+                            return nullptr;
+                        }
+                        if (*q == 0xff)
+                        {
+                            return q + 1;
+                        }
+                        q = skip(q, last, depth+1, ec);
+                        if (JSONCONS_UNLIKELY(ec))
+                        {
+                            return nullptr;
+                        }
+                    }
+                }
+                uint64_t n = h.major_type == static_cast<uint8_t>(detail::cbor_major_type::map) ? 2*h.value : h.value;
+                if (JSONCONS_UNLIKELY(n > static_cast<uint64_t>(last - q)))
+                {
+                    // every item occupies at least one byte
+                    ec = cbor_errc::unexpected_eof;
+                    return nullptr;
+                }
+                for (uint64_t i = 0; i < n; ++i)
+                {
+                    q = skip(q, last, depth+1, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return nullptr;
+                    }
+                }
+                return q;
+            }
+            case detail::cbor_major_type::semantic_tag:
+                return skip(q, last, depth+1, ec);
+            default: // simple
+                if (JSONCONS_UNLIKELY(h.info == detail::additional_info::indefinite_length))
+                {
+                    ec = cbor_errc::unknown_type;
+                    return nullptr;
+                }
+                return q;
+        }
+    }
+
+    static const uint8_t* advance(const uint8_t* p, uint64_t n, const uint8_t* last, std::error_code& ec)
+    {
+        if (JSONCONS_UNLIKELY(n > static_cast<uint64_t>(last - p)))
+        {
+            ec = cbor_errc::unexpected_eof;
+            return nullptr;
+        }
+        return p + n;
+    }
+
+    // The data item following any tags
+    const uint8_t* content() const
+    {
+        if (data_ == nullptr)
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Empty view"));
+        }
+        const uint8_t* p = data_;
+        const uint8_t* last = data_ + length_;
+        while (major_type(p) == detail::cbor_major_type::semantic_tag)
+        {
+            p += read_header(p, last).length;
+        }
+        return p;
+    }
+
+    item_header content_header() const
+    {
+        return read_header(content(), data_ + length_);
+    }
+
+    bool is_indefinite() const
+    {
+        return content_header().info == detail::additional_info::indefinite_length;
+    }
+
+    const uint8_t* children() const
+    {
+        return content() + content_header().length;
+    }
+
+    jsoncons::span<const uint8_t> definite_string(detail::cbor_major_type type) const
+    {
+        auto h = content_header();
+        if (h.major_type != static_cast<uint8_t>(type))
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>(type == detail::cbor_major_type::text_string ? "Not a string" : "Not a byte string"));
+        }
+        if (h.info == detail::additional_info::indefinite_length)
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Indefinite length string"));
+        }
+        return jsoncons::span<const uint8_t>(content() + h.length, static_cast<std::size_t>(h.value));
+    }
+
+    // The number of items in an indefinite length container
+    std::size_t count_children() const
+    {
+        const uint8_t* p = children();
+        const uint8_t* last = data_ + length_;
+        std::size_t count = 0;
+        while (true)
+        {
+            if (JSONCONS_UNLIKELY(p >= last))
+            {
+                JSONCONS_THROW(ser_error(cbor_errc::unexpected_eof));
+            }
+            if (*p == 0xff)
+            {
+                return count;
+            }
+            p = skip(p, last, 0);
+            ++count;
+        }
+    }
+
+    uint64_t child_count() const
+    {
+        auto h = content_header();
+        if (h.info == detail::additional_info::indefinite_length)
+        {
+            return indefinite_count;
+        }
+        return h.value;
+    }
+};
+
+class cbor_array_iterator
+{
+    const uint8_t* p_{nullptr};
+    const uint8_t* last_{nullptr};
+    // Items left, or indefinite_count up to a break byte; an end iterator has a null p_
+    uint64_t remaining_{0};
+    cbor_view value_;
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = cbor_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const cbor_view*;
+    using reference = const cbor_view&;
+
+    cbor_array_iterator() = default;
+
+    cbor_array_iterator(const uint8_t* first, const uint8_t* last, uint64_t count)
+        : p_(first), last_(last), remaining_(count)
+    {
+        read_item();
+    }
+
+    reference operator*() const
+    {
+        return value_;
+    }
+
+    pointer operator->() const
+    {
+        return &value_;
+    }
+
+    cbor_array_iterator& operator++()
+    {
+        p_ += value_.length_;
+        if (remaining_ != cbor_view::indefinite_count)
+        {
+            --remaining_;
+        }
+        read_item();
+        return *this;
+    }
+
+    cbor_array_iterator operator++(int)
+    {
+        cbor_array_iterator temp(*this);
+        ++(*this);
+        return temp;
+    }
+
+    friend bool operator==(const cbor_array_iterator& lhs, const cbor_array_iterator& rhs)
+    {
+        return lhs.p_ == rhs.p_;
+    }
+
+    friend bool operator!=(const cbor_array_iterator& lhs, const cbor_array_iterator& rhs)
+    {
+        return lhs.p_ != rhs.p_;
+    }
+private:
+    void read_item()
+    {
+        if (remaining_ == 0)
+        {
+            p_ = nullptr;
+            return;
+        }
+        if (JSONCONS_UNLIKELY(p_ >= last_))
+        {
+            JSONCONS_THROW(ser_error(cbor_errc::unexpected_eof));
+        }
+        if (remaining_ == cbor_view::indefinite_count && *p_ == 0xff)
+        {
+            p_ = nullptr;
+            remaining_ = 0;
+            return;
+        }
+        value_ = cbor_view(p_, cbor_view::skip(p_, last_, 0) - p_, 0);
+    }
+};
+
+class cbor_member_view
+{
+    cbor_view key_;
+    cbor_view value_;
+public:
+    cbor_member_view() = default;
+
+    cbor_member_view(const cbor_view& key, const cbor_view& value)
+        : key_(key), value_(value)
+    {
+    }
+
+    const cbor_view& key() const noexcept
+    {
+        return key_;
+    }
+
+    const cbor_view& value() const noexcept
+    {
+        return value_;
+    }
+};
+
+class cbor_object_iterator
+{
+    const uint8_t* p_{nullptr};
+    const uint8_t* last_{nullptr};
+    // Members left, or indefinite_count up to a break byte; an end iterator has a null p_
+    uint64_t remaining_{0};
+    cbor_member_view member_;
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = cbor_member_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const cbor_member_view*;
+    using reference = const cbor_member_view&;
+
+    cbor_object_iterator() = default;
+
+    cbor_object_iterator(const uint8_t* first, const uint8_t* last, uint64_t count)
+        : p_(first), last_(last), remaining_(count)
+    {
+        read_member();
+    }
+
+    reference operator*() const
+    {
+        return member_;
+    }
+
+    pointer operator->() const
+    {
+        return &member_;
+    }
+
+    cbor_object_iterator& operator++()
+    {
+        p_ += member_.key().length_ + member_.value().length_;
+        if (remaining_ != cbor_view::indefinite_count)
+        {
+            --remaining_;
+        }
+        read_member();
+        return *this;
+    }
+
+    cbor_object_iterator operator++(int)
+    {
+        cbor_object_iterator temp(*this);
+        ++(*this);
+        return temp;
+    }
+
+    friend bool operator==(const cbor_object_iterator& lhs, const cbor_object_iterator& rhs)
+    {
+        return lhs.p_ == rhs.p_;
+    }
+
+    friend bool operator!=(const cbor_object_iterator& lhs, const cbor_object_iterator& rhs)
+    {
+        return lhs.p_ != rhs.p_;
+    }
+private:
+    void read_member()
+    {
+        if (remaining_ == 0)
+        {
+            p_ = nullptr;
+            return;
+        }
+        if (JSONCONS_UNLIKELY(p_ >= last_))
+        {
+            JSONCONS_THROW(ser_error(cbor_errc::unexpected_eof));
+        }
+        if (remaining_ == cbor_view::indefinite_count && *p_ == 0xff)
+        {
+            p_ = nullptr;
+            remaining_ = 0;
+            return;
+        }
+        const uint8_t* q = cbor_view::skip(p_, last_, 0);
+        const uint8_t* r = cbor_view::skip(q, last_, 0);
+        member_ = cbor_member_view(cbor_view(p_, q - p_, 0), cbor_view(q, r - q, 0));
+    }
+};
+
+// The children of an array or map, located once when the index is built. Lookups by
+// position take constant time, and by key a scan of the keys without skipping values.
+// An index is not modified after construction, so it may be read from several threads.
+class cbor_indexed_view
+{
+    cbor_view view_;
+    // The elements of an array, or the keys and values of a map in turn
+    std::vector<cbor_view> children_;
+public:
+    explicit cbor_indexed_view(const cbor_view& view)
+        : view_(view)
+    {
+        if (view.is_array())
+        {
+            for (const auto& item : view.array_range())
+            {
+                children_.push_back(item);
+            }
+        }
+        else if (view.is_object())
+        {
+            for (const auto& member : view.object_range())
+            {
+                children_.push_back(member.key());
+                children_.push_back(member.value());
+            }
+        }
+        else
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array or object"));
+        }
+    }
+
+    const cbor_view& view() const noexcept
+    {
+        return view_;
+    }
+
+    // The number of elements of an array or members of a map
+    std::size_t size() const noexcept
+    {
+        return view_.is_array() ? children_.size() : children_.size()/2;
+    }
+
+    bool empty() const noexcept
+    {
+        return children_.empty();
+    }
+
+    cbor_view at(std::size_t index) const
+    {
+        if (!view_.is_array())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
+        }
+        if (index >= children_.size())
+        {
+            JSONCONS_THROW(std::out_of_range("Index out of range"));
+        }
+        return children_[index];
+    }
+
+    bool contains(const jsoncons::string_view& key) const
+    {
+        return find_value(key) != nullptr;
+    }
+
+    cbor_view at(const jsoncons::string_view& key) const
+    {
+        const cbor_view* value = find_value(key);
+        if (value == nullptr)
+        {
+            JSONCONS_THROW(key_not_found(key.data(),key.length()));
+        }
+        return *value;
+    }
+
+    cbor_view operator[](const jsoncons::string_view& key) const
+    {
+        return at(key);
+    }
+private:
+    const cbor_view* find_value(const jsoncons::string_view& key) const
+    {
+        if (!view_.is_object())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object"));
+        }
+        for (std::size_t i = 0; i + 1 < children_.size(); i += 2)
+        {
+            const cbor_view& k = children_[i];
+            if (k.is_string() && !k.is_indefinite() && k.as_string_view() == key)
+            {
+                return &children_[i+1];
+            }
+        }
+        return nullptr;
+    }
+};
+
+inline
+range<cbor_view::array_iterator,cbor_view::array_iterator> cbor_view::array_range() const
+{
+    if (!is_array())
+    {
+        JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
+    }
+    return range<array_iterator,array_iterator>(array_iterator(children(), data_ + length_, child_count()), array_iterator());
+}
+
+inline
+range<cbor_view::object_iterator,cbor_view::object_iterator> cbor_view::object_range() const
+{
+    if (!is_object())
+    {
+        JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object"));
+    }
+    return range<object_iterator,object_iterator>(object_iterator(children(), data_ + length_, child_count()), object_iterator());
+}
+
+inline
+cbor_view::object_iterator cbor_view::find(const jsoncons::string_view& key) const
+{
+    auto members = object_range();
+    for (auto it = members.begin(); it != members.end(); ++it)
+    {
+        const cbor_view& k = it->key();
+        if (k.is_string() && !k.is_indefinite() && k.as_string_view() == key)
+        {
+            return it;
+        }
+    }
+    return members.end();
+}
+
+inline
+bool cbor_view::contains(const jsoncons::string_view& key) const
+{
+    return find(key) != object_iterator();
+}
+
+inline
+cbor_view cbor_view::at(const jsoncons::string_view& key) const
+{
+    auto it = find(key);
+    if (it == object_iterator())
+    {
+        JSONCONS_THROW(key_not_found(key.data(),key.length()));
+    }
+    return it->value();
+}
+
+inline
+cbor_view cbor_view::at(std::size_t index) const
+{
+    auto items = array_range();
+    auto it = items.begin();
+    for (std::size_t i = 0; i < index && it != items.end(); ++i)
+    {
+        ++it;
+    }
+    if (it == items.end())
+    {
+        JSONCONS_THROW(std::out_of_range("Index out of range"));
+    }
+    return *it;
+}
+
+inline
+cbor_indexed_view cbor_view::index() const
+{
+    return cbor_indexed_view(*this);
+}
+
+} // namespace cbor
+} // namespace jsoncons
+
+#endif // JSONCONS_EXT_CBOR_CBOR_VIEW_HPP
@@ -0,0 +1,124 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_EXT_CBOR_DECODE_CBOR_SEQUENCE_HPP
+#define JSONCONS_EXT_CBOR_DECODE_CBOR_SEQUENCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits> // std::enable_if
+#include <utility>
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/detail/parallel_decode.hpp>
+#include <jsoncons/detail/span.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/ser_utils.hpp>
+#include <jsoncons/utility/more_type_traits.hpp>
+
+#include <jsoncons_ext/cbor/cbor_options.hpp>
+#include <jsoncons_ext/cbor/cbor_view.hpp>
+#include <jsoncons_ext/cbor/decode_cbor.hpp>
+
+namespace jsoncons { 
+namespace cbor {
+
+namespace detail {
+
+inline
+read_result<std::vector<jsoncons::span<const uint8_t>>> try_split_cbor_sequence(const uint8_t* data, std::size_t length)
+{
+    using result_type = read_result<std::vector<jsoncons::span<const uint8_t>>>;
+
+    std::vector<jsoncons::span<const uint8_t>> items;
+    const uint8_t* p = data;
+    const uint8_t* last = data + length;
+    while (p != last)
+    {
+        std::error_code ec;
+        auto item = cbor_view(p, static_cast<std::size_t>(last - p)).bytes(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            // Report the position of the item that could not be read
+            return result_type{jsoncons::unexpect, ec, 0, static_cast<std::size_t>(p - data)};
+        }
+        items.push_back(item);
+        p += item.size();
+    }
+    return result_type{std::move(items)};
+}
+
+} // namespace detail
+
+// Splits an RFC 8742 CBOR sequence into its data items by reading their headers,
+// without decoding them
+inline
+std::vector<jsoncons::span<const uint8_t>> split_cbor_sequence(const uint8_t* data, std::size_t length)
+{
+    auto result = detail::try_split_cbor_sequence(data, length);
+    if (JSONCONS_UNLIKELY(!result))
+    {
+        JSONCONS_THROW(ser_error(result.error().code(), result.error().column()));
+    }
+    return std::move(*result);
+}
+
+template <typename BytesViewLike>
+typename std::enable_if<ext_traits::is_bytes_view_like<BytesViewLike>::value,std::vector<jsoncons::span<const uint8_t>>>::type
+split_cbor_sequence(const BytesViewLike& v)
+{
+    return split_cbor_sequence(reinterpret_cast<const uint8_t*>(v.data()), v.size());
+}
+
+// Decodes the data items of a CBOR sequence on up to num_threads threads (by default,
+// the number of hardware threads), returning them in their original order
+template <typename T,typename BytesViewLike>
+typename std::enable_if<ext_traits::is_bytes_view_like<BytesViewLike>::value,read_result<std::vector<T>>>::type 
+try_decode_cbor_sequence(const BytesViewLike& v, 
+    const cbor_decode_options& options = cbor_decode_options(),
+    std::size_t num_threads = 0)
+{
+    using result_type = read_result<std::vector<T>>;
+
+    const uint8_t* first = reinterpret_cast<const uint8_t*>(v.data());
+    auto items = detail::try_split_cbor_sequence(first, v.size());
+    if (JSONCONS_UNLIKELY(!items))
+    {
+        return result_type{jsoncons::unexpect, items.error().code(), items.error().line(), items.error().column()};
+    }
+    return jsoncons::detail::parallel_decode<T>(*items, num_threads,
+        [first,&options](const jsoncons::span<const uint8_t>& item) -> read_result<T>
+        {
+            auto result = try_decode_cbor<T>(item, options);
+            if (JSONCONS_UNLIKELY(!result))
+            {
+                // Report the position of the error in the sequence
+                std::size_t offset = static_cast<std::size_t>(item.data() - first);
+                return read_result<T>{jsoncons::unexpect, result.error().code(), result.error().line(), offset + result.error().column()};
+            }
+            return result;
+        });
+}
+
+template <typename T,typename BytesViewLike>
+typename std::enable_if<ext_traits::is_bytes_view_like<BytesViewLike>::value,std::vector<T>>::type 
+decode_cbor_sequence(const BytesViewLike& v, 
+    const cbor_decode_options& options = cbor_decode_options(),
+    std::size_t num_threads = 0)
+{
+    auto result = try_decode_cbor_sequence<T>(v, options, num_threads);
+    if (!result)
+    {
+        JSONCONS_THROW(ser_error(result.error().code(), result.error().line(), result.error().column()));
+    }
+    return std::move(*result);
+}
+
+} // namespace cbor
+} // namespace jsoncons
+
+#endif // JSONCONS_EXT_CBOR_DECODE_CBOR_SEQUENCE_HPP
@@ -7,6 +7,7 @@
 #ifndef JSONCONS_EXT_CSV_CSV_ENCODER_HPP
 #define JSONCONS_EXT_CSV_CSV_ENCODER_HPP
 
+#include <algorithm> // std::find_if
 #include <array> // std::array
 #include <limits> // std::numeric_limits
 #include <memory> // std::allocator
@@ -64,6 +65,7 @@ private:
         flat_row_mapping,
         row_mapping,
         flat_object,
+        fixed_flat_object,
         flat_row,
         stream_flat_row,
         unmapped,
@@ -137,6 +139,17 @@ private:
 
     std::size_t column_index_{0};
     string_type value_buffer_;
+
+    // The column layout of the rows of an array of flat objects, fixed from column_names or 
+    // the first row, so that later rows are written by slot rather than through column_path_value_map_
+    enum class row_layout_state {unknown, fixed, unavailable};
+    row_layout_state row_layout_state_{row_layout_state::unknown};
+    std::vector<string_type,string_allocator_type> slot_keys_;
+    std::vector<string_type,string_allocator_type> slot_values_;
+    std::size_t current_slot_{0};
+    std::size_t last_slot_{0};
+    std::size_t next_slot_{0};
+    bool buffering_slots_{false};
     typename column_path_column_map_type::iterator column_it_;
 
     // Noncopyable and nonmoveable
@@ -183,6 +196,8 @@ public:
         column_path_value_map_(alloc),
         column_path_column_map_(alloc),
         value_buffer_(alloc),
+        slot_keys_(alloc),
+        slot_values_(alloc),
         column_it_(column_path_column_map_.end())
     {
         if (has_column_mapping_)
@@ -220,6 +235,7 @@ public:
             column_path_value_map_.clear();
         }
         column_index_ = 0;
+        row_layout_state_ = row_layout_state::unknown;
     }
 
     void reset(Sink&& sink)
@@ -303,7 +319,22 @@ private:
         switch (stack_.back().item_kind_)
         {
             case stack_item_kind::flat_row_mapping:
-                stack_.emplace_back(stack_item_kind::flat_object);
+                if (fix_row_layout())
+                {
+                    if (stack_[0].count_ == 0)
+                    {
+                        write_header();
+                    }
+                    current_slot_ = slot_keys_.size();
+                    last_slot_ = slot_keys_.size();
+                    next_slot_ = 0;
+                    buffering_slots_ = false;
+                    stack_.emplace_back(stack_item_kind::fixed_flat_object);
+                }
+                else
+                {
+                    stack_.emplace_back(stack_item_kind::flat_object);
+                }
                 break;
             case stack_item_kind::row_mapping:
                 stack_.emplace_back(stack_item_kind::object);
@@ -311,6 +342,17 @@ private:
             case stack_item_kind::object:
                 stack_.emplace_back(stack_item_kind::object);
                 break;
+            case stack_item_kind::fixed_flat_object:
+                if (subfield_delimiter_ == char_type())
+                {
+                    stack_.emplace_back(stack_item_kind::unmapped);
+                }
+                else
+                {
+                    value_buffer_.clear();
+                    stack_.emplace_back(stack_item_kind::multivalued_field);
+                }
+                break;
             case stack_item_kind::flat_object:
                 if (subfield_delimiter_ == char_type())
                 {
@@ -348,24 +390,7 @@ private:
                 {
                     if (stack_[0].count_ == 0)
                     {
-                        bool first = true;
-                        for (std::size_t i = 0; i < column_paths_.size(); ++i)
-                        {
-                            auto it = column_path_name_map_.find(column_paths_[i]);
-                            if (it != column_path_name_map_.end())
-                            {
-                                if (!first)
-                                {
-                                    sink_.push_back(field_delimiter_);
-                                }
-                                else
-                                {
-                                    first = false;
-                                }
-                                sink_.append(it->second.data(), it->second.length());
-                            }
-                        }
-                        sink_.append(line_delimiter_.data(), line_delimiter_.length());
+                        write_header();
                     }
                     for (std::size_t i = 0; i < column_paths_.size(); ++i)
                     {
@@ -383,6 +408,21 @@ private:
                     sink_.append(line_delimiter_.data(), line_delimiter_.length());
                 }
                 break;
+            case stack_item_kind::fixed_flat_object:
+                for (std::size_t i = next_slot_; i < slot_values_.size(); ++i)
+                {
+                    if (i > 0)
+                    {
+                        sink_.push_back(field_delimiter_);
+                    }
+                    if (buffering_slots_)
+                    {
+                        sink_.append(slot_values_[i].data(), slot_values_[i].length());
+                        slot_values_[i].clear();
+                    }
+                }
+                sink_.append(line_delimiter_.data(), line_delimiter_.length());
+                break;
             case stack_item_kind::column_mapping:
             {
                 // Write header
@@ -570,6 +610,17 @@ private:
                     stack_.emplace_back(stack_item_kind::stream_multivalued_field);
                 }
                 break;
+            case stack_item_kind::fixed_flat_object:
+                if (subfield_delimiter_ == char_type())
+                {
+                    stack_.emplace_back(stack_item_kind::unmapped);
+                }
+                else
+                {
+                    value_buffer_.clear();
+                    stack_.emplace_back(stack_item_kind::multivalued_field);
+                }
+                break;
             case stack_item_kind::flat_object:
                 if (subfield_delimiter_ == char_type())
                 {
@@ -673,6 +724,11 @@ private:
                 break;
             case stack_item_kind::multivalued_field:
             {
+                if (parent(stack_).item_kind_ == stack_item_kind::fixed_flat_object)
+                {
+                    write_slot_value();
+                    break;
+                }
                 auto it = column_path_value_map_.find(parent(stack_).column_path_);
                 if (it != column_path_value_map_.end())
                 {
@@ -755,6 +811,13 @@ private:
         JSONCONS_ASSERT(!stack_.empty());
         switch (stack_.back().item_kind_)
         {
+            case stack_item_kind::fixed_flat_object:
+                current_slot_ = find_slot(name);
+                if (current_slot_ < slot_keys_.size())
+                {
+                    last_slot_ = current_slot_;
+                }
+                break;
             case stack_item_kind::flat_object:
             {
                 stack_.back().column_path_ = parent(stack_).column_path_;
@@ -823,6 +886,13 @@ private:
         JSONCONS_ASSERT(!stack_.empty());
         switch (stack_.back().item_kind_)
         {
+            case stack_item_kind::fixed_flat_object:
+            {
+                value_buffer_.clear();
+                write_null_value(value_buffer_);
+                write_slot_value();
+                break;
+            }
             case stack_item_kind::flat_object:
             case stack_item_kind::object:
             {
@@ -893,6 +963,13 @@ private:
         JSONCONS_ASSERT(!stack_.empty());
         switch (stack_.back().item_kind_)
         {
+            case stack_item_kind::fixed_flat_object:
+            {
+                value_buffer_.clear();
+                write_string_value(sv, value_buffer_);
+                write_slot_value();
+                break;
+            }
             case stack_item_kind::flat_object:
             case stack_item_kind::object:
             {
@@ -1022,6 +1099,17 @@ private:
         JSONCONS_ASSERT(!stack_.empty());
         switch (stack_.back().item_kind_)
         {
+            case stack_item_kind::fixed_flat_object:
+            {
+                value_buffer_.clear();
+                write_double_value(val, context, value_buffer_, ec);
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    JSONCONS_VISITOR_RETURN;
+                }
+                write_slot_value();
+                break;
+            }
             case stack_item_kind::flat_object:
             case stack_item_kind::object:
             {
@@ -1099,6 +1187,13 @@ private:
         JSONCONS_ASSERT(!stack_.empty());
         switch (stack_.back().item_kind_)
         {
+            case stack_item_kind::fixed_flat_object:
+            {
+                value_buffer_.clear();
+                write_int64_value(val, value_buffer_);
+                write_slot_value();
+                break;
+            }
             case stack_item_kind::flat_object:
             case stack_item_kind::object:
             {
@@ -1172,6 +1267,13 @@ private:
         JSONCONS_ASSERT(!stack_.empty());
         switch (stack_.back().item_kind_)
         {
+            case stack_item_kind::fixed_flat_object:
+            {
+                value_buffer_.clear();
+                write_uint64_value(val, value_buffer_);
+                write_slot_value();
+                break;
+            }
             case stack_item_kind::flat_object:
             case stack_item_kind::object:
             {
@@ -1242,6 +1344,13 @@ private:
         JSONCONS_ASSERT(!stack_.empty());
         switch (stack_.back().item_kind_)
         {
+            case stack_item_kind::fixed_flat_object:
+            {
+                value_buffer_.clear();
+                write_bool_value(val, value_buffer_);
+                write_slot_value();
+                break;
+            }
             case stack_item_kind::flat_object:
             case stack_item_kind::object:
             {
@@ -1307,6 +1416,94 @@ private:
         JSONCONS_VISITOR_RETURN;
     }
 
+    void write_header()
+    {
+        bool first = true;
+        for (std::size_t i = 0; i < column_paths_.size(); ++i)
+        {
+            auto it = column_path_name_map_.find(column_paths_[i]);
+            if (it != column_path_name_map_.end())
+            {
+                if (!first)
+                {
+                    sink_.push_back(field_delimiter_);
+                }
+                else
+                {
+                    first = false;
+                }
+                sink_.append(it->second.data(), it->second.length());
+            }
+        }
+        sink_.append(line_delimiter_.data(), line_delimiter_.length());
+    }
+
+    // Fixes the row layout once the column paths are known, if every path names a top level member
+    bool fix_row_layout()
+    {
+        if (row_layout_state_ == row_layout_state::unknown && (has_column_mapping_ || stack_[0].count_ > 0))
+        {
+            row_layout_state_ = row_layout_state::fixed;
+            slot_keys_.clear();
+            for (const auto& path : column_paths_)
+            {
+                if (path.empty() || path[0] != '/' || 
+                    std::find_if(path.begin() + 1, path.end(), [](CharT c){return c == '/' || c == '~';}) != path.end())
+                {
+                    row_layout_state_ = row_layout_state::unavailable;
+                    break;
+                }
+                slot_keys_.emplace_back(path.data() + 1, path.length() - 1, alloc_);
+            }
+            slot_values_.assign(slot_keys_.size(), string_type{alloc_});
+        }
+        return row_layout_state_ == row_layout_state::fixed;
+    }
+
+    // Members usually arrive in layout order, so try the slot after the last one first
+    std::size_t find_slot(const string_view_type& name) const
+    {
+        std::size_t guess = last_slot_ + 1 < slot_keys_.size() ? last_slot_ + 1 : 0;
+        if (guess < slot_keys_.size() && name == slot_keys_[guess])
+        {
+            return guess;
+        }
+        for (std::size_t i = 0; i < slot_keys_.size(); ++i)
+        {
+            if (name == slot_keys_[i])
+            {
+                return i;
+            }
+        }
+        return slot_keys_.size();
+    }
+
+    // Writes value_buffer_ straight to the sink while the members of the row arrive in layout
+    // order, otherwise holds it in its slot until the end of the row
+    void write_slot_value()
+    {
+        std::size_t slot = current_slot_;
+        if (slot >= slot_keys_.size() || slot < next_slot_)
+        {
+            return;
+        }
+        if (!buffering_slots_ && slot == next_slot_)
+        {
+            if (slot > 0)
+            {
+                sink_.push_back(field_delimiter_);
+            }
+            sink_.append(value_buffer_.data(), value_buffer_.size());
+            ++next_slot_;
+        }
+        else
+        {
+            buffering_slots_ = true;
+            slot_values_[slot] = value_buffer_;
+        }
+        current_slot_ = slot_keys_.size();
+    }
+
     void write_string_value(const string_view_type& value, string_type& str)
     {
         const char* s = value.data();
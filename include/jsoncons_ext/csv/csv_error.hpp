@@ -25,7 +25,8 @@ namespace csv {
         invalid_escaped_char,
         unexpected_char_between_fields,
         max_nesting_depth_exceeded,
-        invalid_number
+        invalid_number,
+        temp_file_error
     };
 
 class csv_error_category_impl
@@ -58,6 +59,8 @@ public:
                 return "Data item nesting exceeds limit in options";
             case csv_errc::invalid_number:
                 return "Invalid number";
+            case csv_errc::temp_file_error:
+                return "Unable to read or write a temporary column file";
             default:
                 return "Unknown CSV parser error";
         }
@@ -488,6 +488,8 @@ private:
     csv_mapping_kind mapping_kind_{};
     std::size_t header_lines_{0};
     std::size_t max_lines_{(std::numeric_limits<std::size_t>::max)()};
+    std::size_t type_sample_rows_{0};
+    bool spill_columns_{false};
     string_type column_types_;
     string_type column_defaults_;
 public:
@@ -522,6 +524,8 @@ public:
           mapping_kind_(other.mapping_kind_),
           header_lines_(other.header_lines_),
           max_lines_(other.max_lines_),
+          type_sample_rows_(other.type_sample_rows_),
+          spill_columns_(other.spill_columns_),
           column_types_(std::move(other.column_types_)),
           column_defaults_(std::move(other.column_defaults_))
     {}
@@ -611,6 +615,16 @@ public:
         return max_lines_;
     }
 
+    std::size_t type_sample_rows() const 
+    {
+        return type_sample_rows_;
+    }
+
+    bool spill_columns() const 
+    {
+        return spill_columns_;
+    }
+
     string_type column_types() const 
     {
         return column_types_;
@@ -718,6 +732,8 @@ public:
     using basic_csv_decode_options<CharT>::comment_starter; 
     using basic_csv_decode_options<CharT>::mapping_kind; 
     using basic_csv_decode_options<CharT>::max_lines; 
+    using basic_csv_decode_options<CharT>::type_sample_rows; 
+    using basic_csv_decode_options<CharT>::spill_columns; 
     using basic_csv_decode_options<CharT>::column_types; 
     using basic_csv_decode_options<CharT>::column_defaults; 
     using basic_csv_encode_options<CharT>::float_format;
@@ -917,6 +933,18 @@ public:
         return *this;
     }
 
+    basic_csv_options& type_sample_rows(std::size_t value)
+    {
+        this->type_sample_rows_ = value;
+        return *this;
+    }
+
+    basic_csv_options& spill_columns(bool value)
+    {
+        this->spill_columns_ = value;
+        return *this;
+    }
+
     basic_csv_options& nan_to_num(const string_type& value)
     {
         this->enable_nan_to_num_ = true;
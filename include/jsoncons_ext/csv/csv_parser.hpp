@@ -7,14 +7,18 @@
 #ifndef JSONCONS_CSV_CSV_PARSER_HPP
 #define JSONCONS_CSV_CSV_PARSER_HPP
 
+#include <algorithm> // std::min
 #include <cctype>
 #include <cstddef>
 #include <cstdint>
+#include <cstdio> // std::tmpfile, std::fpos_t
+#include <cstring> // std::memcpy
 #include <functional>
 #include <memory> // std::allocator
 #include <sstream>
 #include <string>
 #include <system_error>
+#include <type_traits>
 #include <vector>
 
 #include <jsoncons/config/compiler_support.hpp>
@@ -81,6 +85,17 @@ enum class csv_parse_state
     done
 };
 
+// The type learned for a column from the sampled records
+enum class inferred_type : uint8_t
+{
+    unknown,
+    integer,
+    floating,
+    boolean,
+    string,
+    mixed
+};
+
 enum class cached_state
 {
     begin_object,
@@ -184,6 +199,9 @@ namespace detail {
         {
         }
 
+        template <typename C,typename A>
+        friend class spilled_column;
+
         parse_event(const parse_event&) = default;
         parse_event(parse_event&&) = default;
         parse_event& operator=(const parse_event&) = default;
@@ -226,6 +244,286 @@ namespace detail {
         }
     };
 
+    // The temporary file shared by the spilled columns of an m_columns parse. Columns append
+    // fixed size blocks to it, so one file handle serves any number of columns, and read their
+    // blocks back one column at a time through a single block buffer.
+    template <typename TempAlloc>
+    class spill_file
+    {
+    public:
+        static constexpr std::size_t block_size = 4096;
+        using byte_allocator_type = typename std::allocator_traits<TempAlloc>:: template rebind_alloc<uint8_t>;
+    private:
+        std::FILE* file_{nullptr};
+        bool failed_{false};
+        std::vector<uint8_t,byte_allocator_type> block_;
+    public:
+        explicit spill_file(const TempAlloc& alloc)
+            : block_(alloc)
+        {
+        }
+
+        spill_file(const spill_file&) = delete;
+        spill_file& operator=(const spill_file&) = delete;
+
+        ~spill_file() noexcept
+        {
+            close();
+        }
+
+        void close()
+        {
+            if (file_ != nullptr)
+            {
+                std::fclose(file_);
+                file_ = nullptr;
+            }
+            failed_ = false;
+        }
+
+        // Appends a block at the end of the file, opening the file on first use
+        bool append(const uint8_t* data, std::fpos_t& pos)
+        {
+            if (file_ == nullptr && !failed_)
+            {
+                file_ = std::tmpfile();
+                failed_ = file_ == nullptr;
+            }
+            if (failed_ || std::fseek(file_, 0, SEEK_END) != 0 || std::fgetpos(file_, &pos) != 0 ||
+                std::fwrite(data, 1, block_size, file_) != block_size)
+            {
+                failed_ = true;
+                return false;
+            }
+            return true;
+        }
+
+        // Reads the block at pos into the block buffer
+        const uint8_t* read(const std::fpos_t& pos)
+        {
+            block_.resize(std::size_t{block_size});
+            if (file_ == nullptr || std::fflush(file_) != 0 || std::fsetpos(file_, &pos) != 0 ||
+                std::fread(block_.data(), 1, block_size, file_) != block_size)
+            {
+                return nullptr;
+            }
+            return block_.data();
+        }
+    };
+
+    // The events of one m_columns column, held as a chain of blocks in a spill_file
+    // and a partly filled last block in memory
+    template <typename CharT,typename TempAlloc>
+    class spilled_column
+    {
+        using event_type = parse_event<CharT,TempAlloc>;
+        using string_view_type = typename basic_json_visitor<CharT>::string_view_type;
+        using file_type = spill_file<TempAlloc>;
+        using byte_allocator_type = typename std::allocator_traits<TempAlloc>:: template rebind_alloc<uint8_t>;
+        using pos_allocator_type = typename std::allocator_traits<TempAlloc>:: template rebind_alloc<std::fpos_t>;
+
+        std::size_t size_{0};
+        std::vector<std::fpos_t,pos_allocator_type> blocks_;
+        std::vector<uint8_t,byte_allocator_type> tail_;
+        std::vector<uint8_t,byte_allocator_type> bytes_;
+        std::size_t next_block_{0};
+        const uint8_t* read_ptr_{nullptr};
+        const uint8_t* read_end_{nullptr};
+    public:
+        explicit spilled_column(const TempAlloc& alloc)
+            : blocks_(alloc), tail_(alloc), bytes_(alloc)
+        {
+        }
+
+        spilled_column(const spilled_column&) = delete;
+        spilled_column& operator=(const spilled_column&) = delete;
+        spilled_column(spilled_column&&) = default;
+        spilled_column& operator=(spilled_column&&) = default;
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        // Each record is the event type and tag, followed by the value
+        bool write(file_type& file, staj_events event_type, semantic_tag tag)
+        {
+            // staj_events are bit flags below 1 << 16
+            uint64_t type = static_cast<uint64_t>(event_type);
+            uint8_t header[3] = {static_cast<uint8_t>(type), static_cast<uint8_t>(type >> 8), static_cast<uint8_t>(tag)};
+            if (!write_bytes(file, header, sizeof(header)))
+            {
+                return false;
+            }
+            ++size_;
+            return true;
+        }
+
+        bool write(file_type& file, const string_view_type& value, semantic_tag tag)
+        {
+            uint64_t length = value.length();
+            return write(file, staj_events::string_value, tag) &&
+                   write_bytes(file, &length, sizeof(length)) &&
+                   write_bytes(file, value.data(), value.length()*sizeof(CharT));
+        }
+
+        bool write(file_type& file, const byte_string_view& value, semantic_tag tag)
+        {
+            uint64_t length = value.size();
+            return write(file, staj_events::byte_string_value, tag) &&
+                   write_bytes(file, &length, sizeof(length)) &&
+                   write_bytes(file, value.data(), value.size());
+        }
+
+        bool write(file_type& file, bool value, semantic_tag tag)
+        {
+            uint8_t b = value ? 1 : 0;
+            return write(file, staj_events::bool_value, tag) && write_bytes(file, &b, 1);
+        }
+
+        bool write(file_type& file, int64_t value, semantic_tag tag)
+        {
+            return write(file, staj_events::int64_value, tag) && write_bytes(file, &value, sizeof(value));
+        }
+
+        bool write(file_type& file, uint64_t value, semantic_tag tag)
+        {
+            return write(file, staj_events::uint64_value, tag) && write_bytes(file, &value, sizeof(value));
+        }
+
+        bool write(file_type& file, double value, semantic_tag tag)
+        {
+            return write(file, staj_events::double_value, tag) && write_bytes(file, &value, sizeof(value));
+        }
+
+        // Positions the column at its first record
+        bool rewind()
+        {
+            next_block_ = 0;
+            read_ptr_ = nullptr;
+            read_end_ = nullptr;
+            return true;
+        }
+
+        // Reads the next record into event
+        bool read(file_type& file, event_type& event)
+        {
+            uint8_t header[3];
+            if (!read_bytes(file, header, sizeof(header)))
+            {
+                return false;
+            }
+            event.event_type = static_cast<staj_events>(header[0] | (static_cast<uint64_t>(header[1]) << 8));
+            event.tag = static_cast<semantic_tag>(header[2]);
+            switch (event.event_type)
+            {
+                case staj_events::string_value:
+                {
+                    uint64_t length;
+                    if (!read_bytes(file, &length, sizeof(length)))
+                    {
+                        return false;
+                    }
+                    event.string_value.resize(static_cast<std::size_t>(length));
+                    return read_bytes(file, &event.string_value[0], event.string_value.length()*sizeof(CharT));
+                }
+                case staj_events::byte_string_value:
+                {
+                    uint64_t length;
+                    if (!read_bytes(file, &length, sizeof(length)))
+                    {
+                        return false;
+                    }
+                    bytes_.resize(static_cast<std::size_t>(length));
+                    if (!read_bytes(file, bytes_.data(), bytes_.size()))
+                    {
+                        return false;
+                    }
+                    event.byte_string_value.assign(bytes_.data(), bytes_.size());
+                    break;
+                }
+                case staj_events::bool_value:
+                {
+                    uint8_t value;
+                    if (!read_bytes(file, &value, 1))
+                    {
+                        return false;
+                    }
+                    event.bool_value = value != 0;
+                    break;
+                }
+                case staj_events::int64_value:
+                    return read_bytes(file, &event.int64_value, sizeof(int64_t));
+                case staj_events::uint64_value:
+                    return read_bytes(file, &event.uint64_value, sizeof(uint64_t));
+                case staj_events::double_value:
+                    return read_bytes(file, &event.double_value, sizeof(double));
+                default:
+                    break;
+            }
+            return true;
+        }
+    private:
+        bool write_bytes(file_type& file, const void* data, std::size_t length)
+        {
+            const uint8_t* p = static_cast<const uint8_t*>(data);
+            while (length > 0)
+            {
+                std::size_t n = (std::min)(length, file_type::block_size - tail_.size());
+                tail_.insert(tail_.end(), p, p + n);
+                p += n;
+                length -= n;
+                if (tail_.size() == file_type::block_size)
+                {
+                    std::fpos_t pos;
+                    if (!file.append(tail_.data(), pos))
+                    {
+                        return false;
+                    }
+                    blocks_.push_back(pos);
+                    tail_.clear();
+                }
+            }
+            return true;
+        }
+
+        bool read_bytes(file_type& file, void* data, std::size_t length)
+        {
+            uint8_t* p = static_cast<uint8_t*>(data);
+            while (length > 0)
+            {
+                if (read_ptr_ == read_end_)
+                {
+                    if (next_block_ < blocks_.size())
+                    {
+                        read_ptr_ = file.read(blocks_[next_block_]);
+                        if (read_ptr_ == nullptr)
+                        {
+                            return false;
+                        }
+                        read_end_ = read_ptr_ + file_type::block_size;
+                    }
+                    else if (next_block_ == blocks_.size() && !tail_.empty())
+                    {
+                        read_ptr_ = tail_.data();
+                        read_end_ = read_ptr_ + tail_.size();
+                    }
+                    else
+                    {
+                        return false;
+                    }
+                    ++next_block_;
+                }
+                std::size_t n = (std::min)(length, static_cast<std::size_t>(read_end_ - read_ptr_));
+                std::memcpy(p, read_ptr_, n);
+                read_ptr_ += n;
+                p += n;
+                length -= n;
+            }
+            return true;
+        }
+    };
+
     template <typename CharT,typename TempAlloc >
     class m_columns_filter : public basic_json_visitor<CharT>
     {
@@ -241,6 +539,7 @@ namespace detail {
         using parse_event_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<parse_event<CharT,TempAlloc>>;
         using parse_event_vector_type = std::vector<parse_event<CharT,TempAlloc>, parse_event_allocator_type>;
         using parse_event_vector_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<parse_event_vector_type>;
+        using spilled_column_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<spilled_column<CharT,TempAlloc>>;
     private:
         TempAlloc alloc_;
         std::size_t name_index_{0};
@@ -252,15 +551,28 @@ namespace detail {
 
         std::vector<string_type, string_allocator_type> column_names_;
         std::vector<parse_event_vector_type,parse_event_vector_allocator_type> cached_events_;
+        bool spill_{false};
+        spill_file<TempAlloc> spill_file_;
+        std::vector<spilled_column<CharT,TempAlloc>,spilled_column_allocator_type> spilled_columns_;
+        parse_event<CharT,TempAlloc> spilled_event_;
     public:
 
         m_columns_filter(const TempAlloc& alloc)
             : alloc_(alloc),
               column_names_(alloc),
-              cached_events_(alloc)
+              cached_events_(alloc),
+              spill_file_(alloc),
+              spilled_columns_(alloc),
+              spilled_event_(staj_events::null_value, semantic_tag::none, alloc)
         {
         }
 
+        // Holds the columns in a temporary file rather than in memory
+        void spill_columns(bool value)
+        {
+            spill_ = value;
+        }
+
         void reset()
         {
             name_index_ = 0;
@@ -271,6 +583,8 @@ namespace detail {
             row_index_ = 0;
             column_names_.clear();
             cached_events_.clear();
+            spilled_columns_.clear();
+            spill_file_.close();
         }
 
         bool done() const
@@ -283,7 +597,14 @@ namespace detail {
             for (const auto& name : column_names)
             {
                 column_names_.push_back(name);
-                cached_events_.emplace_back(alloc_);
+                if (spill_)
+                {
+                    spilled_columns_.emplace_back(alloc_);
+                }
+                else
+                {
+                    cached_events_.emplace_back(alloc_);
+                }
             }
             name_index_ = 0;
             level_ = 0;
@@ -303,7 +624,7 @@ namespace detail {
             return static_cast<int>(level_);
         }
 
-        bool replay_parse_events(basic_json_visitor<CharT>& visitor, bool cursor_mode, int mark_level)
+        bool replay_parse_events(basic_json_visitor<CharT>& visitor, bool cursor_mode, int mark_level, std::error_code& ec)
         {
             bool more = true;
             while (more)
@@ -340,6 +661,11 @@ namespace detail {
                         }
                         break;
                     case cached_state::begin_array:
+                        if (spill_ && JSONCONS_UNLIKELY(!spilled_columns_[column_index_].rewind()))
+                        {
+                            ec = csv_errc::temp_file_error;
+                            return false;
+                        }
                         visitor.begin_array(semantic_tag::none, ser_context());
                         ++level_;
                         more = !cursor_mode;
@@ -358,7 +684,25 @@ namespace detail {
                         state_ = cached_state::name;
                         break;
                     case cached_state::item:
-                        if (row_index_ < cached_events_[column_index_].size())
+                        if (spill_)
+                        {
+                            if (row_index_ < spilled_columns_[column_index_].size())
+                            {
+                                if (JSONCONS_UNLIKELY(!spilled_columns_[column_index_].read(spill_file_, spilled_event_)))
+                                {
+                                    ec = csv_errc::temp_file_error;
+                                    return false;
+                                }
+                                spilled_event_.replay(visitor);
+                                more = !cursor_mode;
+                                ++row_index_;
+                            }
+                            else
+                            {
+                                state_ = cached_state::end_array;
+                            }
+                        }
+                        else if (row_index_ < cached_events_[column_index_].size())
                         {
                             cached_events_[column_index_][row_index_].replay(visitor);
                             more = !cursor_mode;
@@ -377,6 +721,17 @@ namespace detail {
             return more;
         }
 
+        template <typename... Args>
+        bool cache_event(Args&&... args)
+        {
+            if (spill_)
+            {
+                return spilled_columns_[name_index_].write(spill_file_, std::forward<Args>(args)...);
+            }
+            cached_events_[name_index_].emplace_back(std::forward<Args>(args)..., alloc_);
+            return true;
+        }
+
         void visit_flush() override
         {
         }
@@ -393,22 +748,30 @@ namespace detail {
             JSONCONS_VISITOR_RETURN;
         }
 
-        JSONCONS_VISITOR_RETURN_TYPE visit_begin_array(semantic_tag tag, const ser_context&, std::error_code&) override
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_array(semantic_tag tag, const ser_context&, std::error_code& ec) override
         {
             if (name_index_ < column_names_.size())
             {
-                cached_events_[name_index_].emplace_back(staj_events::begin_array, tag, alloc_);
+                if (JSONCONS_UNLIKELY(!cache_event(staj_events::begin_array, tag)))
+                {
+                    ec = csv_errc::temp_file_error;
+                    JSONCONS_VISITOR_RETURN;
+                }
                 
                 ++level2_;
             }
             JSONCONS_VISITOR_RETURN;
         }
 
-        JSONCONS_VISITOR_RETURN_TYPE visit_end_array(const ser_context&, std::error_code&) override
+        JSONCONS_VISITOR_RETURN_TYPE visit_end_array(const ser_context&, std::error_code& ec) override
         {
             if (level2_ > 0)
             {
-                cached_events_[name_index_].emplace_back(staj_events::end_array, semantic_tag::none, alloc_);
+                if (JSONCONS_UNLIKELY(!cache_event(staj_events::end_array, semantic_tag::none)))
+                {
+                    ec = csv_errc::temp_file_error;
+                    JSONCONS_VISITOR_RETURN;
+                }
                 ++name_index_;
                 --level2_;
             }
@@ -425,11 +788,15 @@ namespace detail {
             JSONCONS_VISITOR_RETURN;
         }
 
-        JSONCONS_VISITOR_RETURN_TYPE visit_null(semantic_tag tag, const ser_context&, std::error_code&) override
+        JSONCONS_VISITOR_RETURN_TYPE visit_null(semantic_tag tag, const ser_context&, std::error_code& ec) override
         {
             if (name_index_ < column_names_.size())
             {
-                cached_events_[name_index_].emplace_back(staj_events::null_value, tag, alloc_);
+                if (JSONCONS_UNLIKELY(!cache_event(staj_events::null_value, tag)))
+                {
+                    ec = csv_errc::temp_file_error;
+                    JSONCONS_VISITOR_RETURN;
+                }
                 if (level2_ == 0)
                 {
                     ++name_index_;
@@ -438,11 +805,15 @@ namespace detail {
             JSONCONS_VISITOR_RETURN;
         }
 
-        JSONCONS_VISITOR_RETURN_TYPE visit_string(const string_view_type& value, semantic_tag tag, const ser_context&, std::error_code&) override
+        JSONCONS_VISITOR_RETURN_TYPE visit_string(const string_view_type& value, semantic_tag tag, const ser_context&, std::error_code& ec) override
         {
             if (name_index_ < column_names_.size())
             {
-                cached_events_[name_index_].emplace_back(value, tag, alloc_);
+                if (JSONCONS_UNLIKELY(!cache_event(value, tag)))
+                {
+                    ec = csv_errc::temp_file_error;
+                    JSONCONS_VISITOR_RETURN;
+                }
 
                 if (level2_ == 0)
                 {
@@ -455,11 +826,15 @@ namespace detail {
         JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view& value,
                                   semantic_tag tag,
                                   const ser_context&,
-                                  std::error_code&) override
+                                  std::error_code& ec) override
         {
             if (name_index_ < column_names_.size())
             {
-                cached_events_[name_index_].emplace_back(value, tag, alloc_);
+                if (JSONCONS_UNLIKELY(!cache_event(value, tag)))
+                {
+                    ec = csv_errc::temp_file_error;
+                    JSONCONS_VISITOR_RETURN;
+                }
                 if (level2_ == 0)
                 {
                     ++name_index_;
@@ -471,11 +846,15 @@ namespace detail {
         JSONCONS_VISITOR_RETURN_TYPE visit_double(double value,
                              semantic_tag tag, 
                              const ser_context&,
-                             std::error_code&) override
+                             std::error_code& ec) override
         {
             if (name_index_ < column_names_.size())
             {
-                cached_events_[name_index_].emplace_back(value, tag, alloc_);
+                if (JSONCONS_UNLIKELY(!cache_event(value, tag)))
+                {
+                    ec = csv_errc::temp_file_error;
+                    JSONCONS_VISITOR_RETURN;
+                }
                 if (level2_ == 0)
                 {
                     ++name_index_;
@@ -487,11 +866,15 @@ namespace detail {
         JSONCONS_VISITOR_RETURN_TYPE visit_int64(int64_t value,
                             semantic_tag tag,
                             const ser_context&,
-                            std::error_code&) override
+                            std::error_code& ec) override
         {
             if (name_index_ < column_names_.size())
             {
-                cached_events_[name_index_].emplace_back(value, tag, alloc_);
+                if (JSONCONS_UNLIKELY(!cache_event(value, tag)))
+                {
+                    ec = csv_errc::temp_file_error;
+                    JSONCONS_VISITOR_RETURN;
+                }
                 if (level2_ == 0)
                 {
                     ++name_index_;
@@ -503,11 +886,15 @@ namespace detail {
         JSONCONS_VISITOR_RETURN_TYPE visit_uint64(uint64_t value,
                              semantic_tag tag,
                              const ser_context&,
-                             std::error_code&) override
+                             std::error_code& ec) override
         {
             if (name_index_ < column_names_.size())
             {
-                cached_events_[name_index_].emplace_back(value, tag, alloc_);
+                if (JSONCONS_UNLIKELY(!cache_event(value, tag)))
+                {
+                    ec = csv_errc::temp_file_error;
+                    JSONCONS_VISITOR_RETURN;
+                }
                 if (level2_ == 0)
                 {
                     ++name_index_;
@@ -516,11 +903,15 @@ namespace detail {
             JSONCONS_VISITOR_RETURN;
         }
 
-        JSONCONS_VISITOR_RETURN_TYPE visit_bool(bool value, semantic_tag tag, const ser_context&, std::error_code&) override
+        JSONCONS_VISITOR_RETURN_TYPE visit_bool(bool value, semantic_tag tag, const ser_context&, std::error_code& ec) override
         {
             if (name_index_ < column_names_.size())
             {
-                cached_events_[name_index_].emplace_back(value, tag, alloc_);
+                if (JSONCONS_UNLIKELY(!cache_event(value, tag)))
+                {
+                    ec = csv_errc::temp_file_error;
+                    JSONCONS_VISITOR_RETURN;
+                }
                 if (level2_ == 0)
                 {
                     ++name_index_;
@@ -530,6 +921,91 @@ namespace detail {
         }
     };
 
+    // Finds the first occurrence of any of a small set of characters that end a run of plain
+    // field content. Narrow characters are tested eight at a time.
+    template <typename CharT>
+    class special_char_scanner
+    {
+        static constexpr std::size_t max_chars = 6;
+        static constexpr uint64_t low_bits = 0x0101010101010101ULL;
+        static constexpr uint64_t high_bits = 0x8080808080808080ULL;
+
+        CharT chars_[max_chars];
+        uint64_t patterns_[max_chars];
+        std::size_t count_{0};
+    public:
+        special_char_scanner() = default;
+
+        void clear()
+        {
+            count_ = 0;
+        }
+
+        void add(CharT c)
+        {
+            for (std::size_t i = 0; i < count_; ++i)
+            {
+                if (chars_[i] == c)
+                {
+                    return;
+                }
+            }
+            JSONCONS_ASSERT(count_ < max_chars);
+            chars_[count_] = c;
+            patterns_[count_] = low_bits * static_cast<uint8_t>(c);
+            ++count_;
+        }
+
+        bool is_special(CharT c) const
+        {
+            for (std::size_t i = 0; i < count_; ++i)
+            {
+                if (chars_[i] == c)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Returns a pointer to the first special character in [first,last), or last
+        const CharT* scan(const CharT* first, const CharT* last) const
+        {
+            return scan(first, last, std::integral_constant<bool,sizeof(CharT) == sizeof(uint8_t)>());
+        }
+    private:
+        const CharT* scan(const CharT* first, const CharT* last, std::true_type) const
+        {
+            while (last - first >= static_cast<std::ptrdiff_t>(sizeof(uint64_t)))
+            {
+                uint64_t word;
+                std::memcpy(&word, first, sizeof(uint64_t));
+                uint64_t found = 0;
+                for (std::size_t i = 0; i < count_; ++i)
+                {
+                    // nonzero iff some byte of word equals chars_[i]
+                    uint64_t v = word ^ patterns_[i];
+                    found |= (v - low_bits) & ~v & high_bits;
+                }
+                if (found != 0)
+                {
+                    break;
+                }
+                first += sizeof(uint64_t);
+            }
+            return scan(first, last, std::false_type());
+        }
+
+        const CharT* scan(const CharT* first, const CharT* last, std::false_type) const
+        {
+            while (first != last && !is_special(*first))
+            {
+                ++first;
+            }
+            return first;
+        }
+    };
+
 } // namespace detail
 
 template <typename CharT,typename TempAlloc =std::allocator<char>>
@@ -557,6 +1033,7 @@ private:
     typedef typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<csv_type_info> csv_type_info_allocator_type;
     typedef typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<std::vector<string_type,string_allocator_type>> string_vector_allocator_type;
     typedef typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<csv_parse_state> csv_parse_state_allocator_type;
+    typedef typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<inferred_type> inferred_type_allocator_type;
 
     static constexpr int default_depth = 3;
 
@@ -576,6 +1053,8 @@ private:
     bool lossless_number_; 
     csv_mapping_kind mapping_kind_;
     std::size_t max_lines_;
+    std::size_t type_sample_rows_;
+    std::size_t sampled_rows_{0};
     char_type quote_char_;
     char_type quote_escape_char_;
     char_type subfield_delimiter_;
@@ -598,6 +1077,7 @@ private:
     bool actual_cursor_mode_{false};
     int mark_level_{0};
     std::size_t header_line_offset_{0};
+    bool cache_columns_{true};
 
     detail::m_columns_filter<CharT,TempAlloc> m_columns_filter_;
     std::vector<csv_mode,csv_mode_allocator_type> stack_;
@@ -605,8 +1085,12 @@ private:
     std::vector<csv_type_info,csv_type_info_allocator_type> column_types_;
     std::vector<string_type,string_allocator_type> column_defaults_;
     std::vector<csv_parse_state,csv_parse_state_allocator_type> state_stack_;
+    std::vector<inferred_type,inferred_type_allocator_type> inferred_types_;
     string_type buffer_;
     std::vector<std::pair<std::basic_string<char_type>,double>> string_double_map_;
+    detail::special_char_scanner<CharT> unquoted_scanner_;
+    detail::special_char_scanner<CharT> quoted_scanner_;
+    detail::special_char_scanner<CharT> comment_scanner_;
 
 public:
     basic_csv_parser()
@@ -641,6 +1125,7 @@ public:
          lossless_number_(options.lossless_number()), 
          mapping_kind_(options.mapping_kind()),
          max_lines_(options.max_lines()),
+         type_sample_rows_(options.type_sample_rows()),
          quote_char_(options.quote_char()),
          quote_escape_char_(options.quote_escape_char()),
          subfield_delimiter_(options.subfield_delimiter()),
@@ -655,6 +1140,7 @@ public:
          column_types_(alloc),
          column_defaults_(alloc),
          state_stack_(alloc),
+         inferred_types_(alloc),
          buffer_(alloc)
     {
         if (options.enable_str_to_nan())
@@ -674,6 +1160,7 @@ public:
         jsoncons::csv::detail::parse_column_names(options.column_defaults(), column_defaults_);
         jsoncons::csv::detail::parse_column_names(options.column_names(), column_names_);
         min_column_names_ = column_names_.size();
+        m_columns_filter_.spill_columns(options.spill_columns());
         initialize();
     }
 
@@ -702,6 +1189,7 @@ public:
          lossless_number_(options.lossless_number()), 
          mapping_kind_(options.mapping_kind()),
          max_lines_(options.max_lines()),
+         type_sample_rows_(options.type_sample_rows()),
          quote_char_(options.quote_char()),
          quote_escape_char_(options.quote_escape_char()),
          subfield_delimiter_(options.subfield_delimiter()),
@@ -716,6 +1204,7 @@ public:
          column_types_(alloc),
          column_defaults_(alloc),
          state_stack_(alloc),
+         inferred_types_(alloc),
          buffer_(alloc)
     {
         if (options.enable_str_to_nan())
@@ -735,6 +1224,7 @@ public:
         jsoncons::csv::detail::parse_column_names(options.column_defaults(), column_defaults_);
         jsoncons::csv::detail::parse_column_names(options.column_names(), column_names_);
         min_column_names_ = column_names_.size();
+        m_columns_filter_.spill_columns(options.spill_columns());
         initialize();
     }
 #endif
@@ -749,6 +1239,15 @@ public:
         cursor_mode_ = (mapping_kind_ == csv_mapping_kind::m_columns) ? false : value;
     }
 
+    // Parses with the m_columns mapping, but reports the values of each record to the visitor
+    // as they are parsed, each record followed by end_array, rather than caching the columns
+    // and replaying them as an object of arrays. Empty values that would be ignored are reported as null.
+    void stream_columns()
+    {
+        mapping_kind_ = csv_mapping_kind::m_columns;
+        cache_columns_ = false;
+    }
+
     int level() const
     {
         return level_;
@@ -808,6 +1307,8 @@ public:
         stack_.clear();
         column_names_.erase(column_names_.begin() + min_column_names_, column_names_.end());
         state_stack_.clear();
+        sampled_rows_ = 0;
+        inferred_types_.clear();
         buffer_.clear();
 
         initialize();
@@ -830,7 +1331,7 @@ public:
 
     void parse_some(basic_json_visitor<CharT>& visitor, std::error_code& ec)
     {
-        basic_json_visitor<CharT>& local_visitor = (mapping_kind_ == csv_mapping_kind::m_columns) 
+        basic_json_visitor<CharT>& local_visitor = (mapping_kind_ == csv_mapping_kind::m_columns && cache_columns_) 
             ? m_columns_filter_ : visitor;
 
         switch (mapping_kind_)
@@ -949,11 +1450,11 @@ public:
                     }
                     --level_;
                     
-                    if (mapping_kind_ == csv_mapping_kind::m_columns)
+                    if (mapping_kind_ == csv_mapping_kind::m_columns && cache_columns_)
                     {
                         if (!m_columns_filter_.done())
                         {
-                            more_ = m_columns_filter_.replay_parse_events(visitor, actual_cursor_mode_, mark_level_);
+                            more_ = m_columns_filter_.replay_parse_events(visitor, actual_cursor_mode_, mark_level_, ec);
                         }
                         else
                         {
@@ -1050,8 +1551,12 @@ public:
                             state_ = csv_parse_state::cr;
                             break;
                         default:
-                            ++column_;
-                            break;
+                        {
+                            const CharT* run_end = comment_scanner_.scan(input_ptr_ + 1, local_input_end);
+                            column_ += static_cast<std::size_t>(run_end - input_ptr_);
+                            input_ptr_ = run_end;
+                            continue;
+                        }
                     }
                     ++input_ptr_;
                     break;
@@ -1081,7 +1586,12 @@ public:
                         }
                         else
                         {
-                            buffer_.push_back(static_cast<CharT>(curr_char));
+                            // Take the run of plain characters up to the next quote or escape at once
+                            const CharT* run_end = quoted_scanner_.scan(input_ptr_ + 1, local_input_end);
+                            buffer_.append(input_ptr_, run_end);
+                            column_ += static_cast<std::size_t>(run_end - input_ptr_);
+                            input_ptr_ = run_end;
+                            break;
                         }
                     }
                     ++column_;
@@ -1348,9 +1858,11 @@ public:
                             }
                             else
                             {
-                                buffer_.push_back(static_cast<CharT>(curr_char));
-                                ++column_;
-                                ++input_ptr_;
+                                // Take the run of plain characters up to the next delimiter, quote or newline at once
+                                const CharT* run_end = unquoted_scanner_.scan(input_ptr_ + 1, local_input_end);
+                                buffer_.append(input_ptr_, run_end);
+                                column_ += static_cast<std::size_t>(run_end - input_ptr_);
+                                input_ptr_ = run_end;
                             }
                             break;
                     }
@@ -1517,6 +2029,22 @@ private:
         stack_.reserve(default_depth);
         stack_.push_back(csv_mode::initial);
         stack_.push_back((header_lines_ > 0) ? csv_mode::header : csv_mode::data);
+
+        unquoted_scanner_.clear();
+        unquoted_scanner_.add('\n');
+        unquoted_scanner_.add('\r');
+        unquoted_scanner_.add(field_delimiter_);
+        unquoted_scanner_.add(quote_char_);
+        if (subfield_delimiter_ != char_type())
+        {
+            unquoted_scanner_.add(subfield_delimiter_);
+        }
+        quoted_scanner_.clear();
+        quoted_scanner_.add(quote_char_);
+        quoted_scanner_.add(quote_escape_char_);
+        comment_scanner_.clear();
+        comment_scanner_.add('\n');
+        comment_scanner_.add('\r');
     }
 
     // name
@@ -1673,6 +2201,10 @@ private:
             case csv_mode::data:
             case csv_mode::subfields:
             {
+                if (sampled_rows_ < type_sample_rows_)
+                {
+                    ++sampled_rows_;
+                }
                 switch (mapping_kind_)
                 {
                     case csv_mapping_kind::n_rows:
@@ -1805,6 +2337,10 @@ private:
                     {
                         end_value(visitor, infer_types_, ec);
                     }
+                    else if (!cache_columns_)
+                    {
+                        visitor.null_value(semantic_tag::none, *this, ec);
+                    }
                     else
                     {
                         m_columns_filter_.skip_column();
@@ -1867,6 +2403,10 @@ private:
                     {
                         end_value(visitor, false, ec);
                     }
+                    else if (!cache_columns_)
+                    {
+                        visitor.null_value(semantic_tag::none, *this, ec);
+                    }
                     else
                     {
                         m_columns_filter_.skip_column();
@@ -2063,7 +2603,14 @@ private:
         {
             if (infer_types)
             {
-                end_value_with_numeric_check(visitor, ec);
+                if (type_sample_rows_ > 0 && sampled_rows_ == type_sample_rows_ && column_index_ < inferred_types_.size())
+                {
+                    end_value_with_inferred_type(visitor, ec);
+                }
+                else
+                {
+                    end_value_with_numeric_check(visitor, ec);
+                }
             }
             else
             {
@@ -2296,6 +2843,11 @@ private:
             }
         }
 
+        if (sampled_rows_ < type_sample_rows_)
+        {
+            learn_type(state);
+        }
+
         switch (state)
         {
             case numeric_check_state::null:
@@ -2387,6 +2939,208 @@ private:
         }
     } 
 
+    void learn_type(numeric_check_state state)
+    {
+        inferred_type type;
+        switch (state)
+        {
+            case numeric_check_state::null:
+                return;
+            case numeric_check_state::boolean_true:
+            case numeric_check_state::boolean_false:
+                type = inferred_type::boolean;
+                break;
+            case numeric_check_state::zero:
+            case numeric_check_state::integer:
+                type = inferred_type::integer;
+                break;
+            case numeric_check_state::fraction:
+            case numeric_check_state::exp:
+                type = inferred_type::floating;
+                break;
+            default:
+                type = inferred_type::string;
+                break;
+        }
+        if (column_index_ >= inferred_types_.size())
+        {
+            inferred_types_.resize(column_index_ + 1, inferred_type::unknown);
+        }
+        inferred_type& current = inferred_types_[column_index_];
+        if (current == inferred_type::unknown || current == type)
+        {
+            current = type;
+        }
+        else if ((current == inferred_type::integer && type == inferred_type::floating) ||
+                 (current == inferred_type::floating && type == inferred_type::integer))
+        {
+            current = inferred_type::floating;
+        }
+        else
+        {
+            current = inferred_type::mixed;
+        }
+    }
+
+    /*
+        xxx_value, using the type learned for the column and falling back 
+        to end_value_with_numeric_check for fields that do not match it 
+    */
+    void end_value_with_inferred_type(basic_json_visitor<CharT>& visitor, 
+        std::error_code& ec)
+    {
+        switch (inferred_types_[column_index_])
+        {
+            case inferred_type::integer:
+                if (try_integer_value(visitor, ec))
+                {
+                    return;
+                }
+                break;
+            case inferred_type::floating:
+                if (!lossless_number_ && try_double_value(visitor, ec))
+                {
+                    return;
+                }
+                break;
+            case inferred_type::string:
+                // Only null, true, false and numbers need a closer look
+                if (buffer_.empty())
+                {
+                    break;
+                }
+                switch (buffer_[0])
+                {
+                    case 'n':case 'N':case 't':case 'T':case 'f':case 'F':case '-':
+                    case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
+                        break;
+                    default:
+                        visitor.string_value(buffer_, semantic_tag::none, *this, ec);
+                        more_ = !cursor_mode_;
+                        return;
+                }
+                break;
+            default:
+                break;
+        }
+        end_value_with_numeric_check(visitor, ec);
+    }
+
+    static bool is_digit(CharT c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    // -?(0|[1-9][0-9]*)
+    bool try_integer_value(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        const CharT* first = buffer_.data();
+        const CharT* last = first + buffer_.length();
+        const CharT* p = first;
+        bool is_negative = p != last && *p == '-';
+        if (is_negative)
+        {
+            ++p;
+        }
+        if (p == last || (*p == '0' && last - p > 1))
+        {
+            return false;
+        }
+        for (; p != last; ++p)
+        {
+            if (!is_digit(*p))
+            {
+                return false;
+            }
+        }
+        if (is_negative)
+        {
+            int64_t val{0};
+            if (!jsoncons::dec_to_integer(first, buffer_.length(), val))
+            {
+                return false;
+            }
+            visitor.int64_value(val, semantic_tag::none, *this, ec);
+        }
+        else
+        {
+            uint64_t val{0};
+            if (!jsoncons::dec_to_integer(first, buffer_.length(), val))
+            {
+                return false;
+            }
+            visitor.uint64_value(val, semantic_tag::none, *this, ec);
+        }
+        more_ = !cursor_mode_;
+        return true;
+    }
+
+    // -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?, integers included
+    bool try_double_value(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        const CharT* first = buffer_.data();
+        const CharT* last = first + buffer_.length();
+        const CharT* p = first;
+        if (p != last && *p == '-')
+        {
+            ++p;
+        }
+        if (p == last || !is_digit(*p) || (*p == '0' && p + 1 != last && is_digit(p[1])))
+        {
+            return false;
+        }
+        while (p != last && is_digit(*p))
+        {
+            ++p;
+        }
+        if (p != last && *p == '.')
+        {
+            ++p;
+            if (p == last || !is_digit(*p))
+            {
+                return false;
+            }
+            while (p != last && is_digit(*p))
+            {
+                ++p;
+            }
+        }
+        if (p != last && (*p == 'e' || *p == 'E'))
+        {
+            ++p;
+            if (p != last && (*p == '+' || *p == '-'))
+            {
+                ++p;
+            }
+            if (p == last || !is_digit(*p))
+            {
+                return false;
+            }
+            while (p != last && is_digit(*p))
+            {
+                ++p;
+            }
+        }
+        if (p != last)
+        {
+            return false;
+        }
+
+        double d{0};
+        auto result = jsoncons::decstr_to_double(buffer_.c_str(), buffer_.length(), d);
+        if (result.ec == std::errc::result_out_of_range)
+        {
+            d = *first == '-' ? -HUGE_VAL : HUGE_VAL;
+        }
+        else if (result.ec == std::errc::invalid_argument)
+        {
+            return false;
+        }
+        visitor.double_value(d, semantic_tag::none, *this, ec);
+        more_ = !cursor_mode_;
+        return true;
+    }
+
     void push_state(csv_parse_state state)
     {
         state_stack_.push_back(state);
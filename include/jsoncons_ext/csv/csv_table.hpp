@@ -0,0 +1,588 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_EXT_CSV_CSV_TABLE_HPP
+#define JSONCONS_EXT_CSV_CSV_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/conv_error.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/semantic_tag.hpp>
+#include <jsoncons/ser_utils.hpp>
+#include <jsoncons/source_adaptor.hpp>
+#include <jsoncons/utility/write_number.hpp>
+
+#include <jsoncons_ext/csv/csv_options.hpp>
+#include <jsoncons_ext/csv/csv_parser.hpp>
+
+namespace jsoncons {
+namespace csv {
+
+// A column of values of one type, int64 (integer_t), double (float_t), bool (boolean_t)
+// or string (string_t), with nulls marked separately
+template <typename CharT>
+class basic_csv_column
+{
+public:
+    using char_type = CharT;
+    using string_type = std::basic_string<CharT>;
+    using string_view_type = jsoncons::basic_string_view<CharT>;
+private:
+    string_type name_;
+    csv_column_type type_{csv_column_type::string_t};
+    bool typed_{false};
+    // An integer column holds a value that a double cannot represent exactly
+    bool inexact_as_double_{false};
+    std::size_t size_{0};
+    std::vector<int64_t> integers_;
+    std::vector<double> floats_;
+    std::vector<bool> booleans_;
+    std::vector<string_type> strings_;
+    std::vector<bool> nulls_;
+public:
+    basic_csv_column() = default;
+
+    explicit basic_csv_column(const string_view_type& name)
+        : name_(name)
+    {
+    }
+
+    const string_type& name() const
+    {
+        return name_;
+    }
+
+    void name(const string_view_type& value)
+    {
+        name_ = string_type(value);
+    }
+
+    // string_t for a column without values
+    csv_column_type type() const
+    {
+        return type_;
+    }
+
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+    bool is_null(std::size_t index) const
+    {
+        return !nulls_.empty() && nulls_[index];
+    }
+
+    // Null entries hold 0, 0.0, false or an empty string
+    const std::vector<int64_t>& integers() const
+    {
+        return integers_;
+    }
+
+    const std::vector<double>& floats() const
+    {
+        return floats_;
+    }
+
+    const std::vector<bool>& booleans() const
+    {
+        return booleans_;
+    }
+
+    const std::vector<string_type>& strings() const
+    {
+        return strings_;
+    }
+
+    void push_back_null()
+    {
+        if (nulls_.empty())
+        {
+            nulls_.resize(size_, false);
+        }
+        nulls_.push_back(true);
+        if (typed_)
+        {
+            switch (type_)
+            {
+                case csv_column_type::integer_t:
+                    integers_.push_back(0);
+                    break;
+                case csv_column_type::float_t:
+                    floats_.push_back(0.0);
+                    break;
+                case csv_column_type::boolean_t:
+                    booleans_.push_back(false);
+                    break;
+                default:
+                    strings_.emplace_back();
+                    break;
+            }
+        }
+        ++size_;
+    }
+
+    void push_back(int64_t value)
+    {
+        if (!typed_)
+        {
+            assign_type(csv_column_type::integer_t);
+        }
+        if (type_ == csv_column_type::integer_t)
+        {
+            integers_.push_back(value);
+            if (!is_exact_as_double(value))
+            {
+                inexact_as_double_ = true;
+            }
+        }
+        else if (type_ == csv_column_type::float_t && is_exact_as_double(value))
+        {
+            floats_.push_back(static_cast<double>(value));
+        }
+        else
+        {
+            string_type s;
+            jsoncons::from_integer(value, s);
+            push_back_text(std::move(s));
+            return;
+        }
+        value_added();
+    }
+
+    void push_back(double value)
+    {
+        if (!typed_)
+        {
+            assign_type(csv_column_type::float_t);
+        }
+        else if (type_ == csv_column_type::integer_t && !inexact_as_double_)
+        {
+            promote_to_float();
+        }
+        if (type_ != csv_column_type::float_t)
+        {
+            string_type s;
+            jsoncons::write_double f{float_chars_format::general,0};
+            f(value, s);
+            push_back_text(std::move(s));
+            return;
+        }
+        floats_.push_back(value);
+        value_added();
+    }
+
+    void push_back(bool value)
+    {
+        if (!typed_)
+        {
+            assign_type(csv_column_type::boolean_t);
+        }
+        if (type_ != csv_column_type::boolean_t)
+        {
+            push_back_text(bool_text(value));
+            return;
+        }
+        booleans_.push_back(value);
+        value_added();
+    }
+
+    void push_back(const string_view_type& value)
+    {
+        push_back_text(string_type(value));
+    }
+
+private:
+    void value_added()
+    {
+        if (!nulls_.empty())
+        {
+            nulls_.push_back(false);
+        }
+        ++size_;
+    }
+
+    void push_back_text(string_type&& value)
+    {
+        if (!typed_)
+        {
+            assign_type(csv_column_type::string_t);
+        }
+        else if (type_ != csv_column_type::string_t)
+        {
+            promote_to_string();
+        }
+        strings_.push_back(std::move(value));
+        value_added();
+    }
+
+    // Earlier rows were all null
+    void assign_type(csv_column_type type)
+    {
+        typed_ = true;
+        type_ = type;
+        switch (type_)
+        {
+            case csv_column_type::integer_t:
+                integers_.resize(size_, 0);
+                break;
+            case csv_column_type::float_t:
+                floats_.resize(size_, 0.0);
+                break;
+            case csv_column_type::boolean_t:
+                booleans_.resize(size_, false);
+                break;
+            default:
+                strings_.resize(size_);
+                break;
+        }
+    }
+
+    // Integers beyond 2^53 in magnitude may have no exact double
+    static bool is_exact_as_double(int64_t value)
+    {
+        const int64_t limit = int64_t(1) << 53;
+        return value >= -limit && value <= limit;
+    }
+
+    // All integers are exact as doubles
+    void promote_to_float()
+    {
+        floats_.reserve(integers_.size() + 1);
+        for (auto val : integers_)
+        {
+            floats_.push_back(static_cast<double>(val));
+        }
+        integers_.clear();
+        integers_.shrink_to_fit();
+        type_ = csv_column_type::float_t;
+    }
+
+    void promote_to_string()
+    {
+        strings_.reserve(size_ + 1);
+        jsoncons::write_double f{float_chars_format::general,0};
+        for (std::size_t i = 0; i < size_; ++i)
+        {
+            string_type s;
+            if (!is_null(i))
+            {
+                switch (type_)
+                {
+                    case csv_column_type::integer_t:
+                        jsoncons::from_integer(integers_[i], s);
+                        break;
+                    case csv_column_type::float_t:
+                        f(floats_[i], s);
+                        break;
+                    case csv_column_type::boolean_t:
+                        s = bool_text(booleans_[i]);
+                        break;
+                    default:
+                        break;
+                }
+            }
+            strings_.push_back(std::move(s));
+        }
+        integers_.clear();
+        integers_.shrink_to_fit();
+        floats_.clear();
+        floats_.shrink_to_fit();
+        booleans_.clear();
+        booleans_.shrink_to_fit();
+        inexact_as_double_ = false;
+        type_ = csv_column_type::string_t;
+    }
+
+    static string_type bool_text(bool value)
+    {
+        static const CharT true_text[] = {'t','r','u','e'};
+        static const CharT false_text[] = {'f','a','l','s','e'};
+        return value ? string_type(true_text, 4) : string_type(false_text, 5);
+    }
+};
+
+// CSV data held as columns rather than rows
+template <typename CharT>
+class basic_csv_table
+{
+public:
+    using char_type = CharT;
+    using column_type = basic_csv_column<CharT>;
+    using string_view_type = jsoncons::basic_string_view<CharT>;
+private:
+    std::size_t rows_{0};
+    std::vector<column_type> columns_;
+public:
+    basic_csv_table() = default;
+
+    std::size_t rows() const
+    {
+        return rows_;
+    }
+
+    const std::vector<column_type>& columns() const
+    {
+        return columns_;
+    }
+
+    std::vector<column_type>& columns()
+    {
+        return columns_;
+    }
+
+    const column_type& operator[](std::size_t index) const
+    {
+        return columns_[index];
+    }
+
+    const column_type* find(const string_view_type& name) const
+    {
+        for (const auto& column : columns_)
+        {
+            if (column.name() == name)
+            {
+                return &column;
+            }
+        }
+        return nullptr;
+    }
+
+    const column_type& at(const string_view_type& name) const
+    {
+        const column_type* column = find(name);
+        if (column == nullptr)
+        {
+            JSONCONS_THROW(key_not_found(name.data(),name.length()));
+        }
+        return *column;
+    }
+
+    column_type& column(std::size_t index)
+    {
+        while (index >= columns_.size())
+        {
+            columns_.emplace_back();
+            for (std::size_t i = 0; i < rows_; ++i)
+            {
+                columns_.back().push_back_null();
+            }
+        }
+        return columns_[index];
+    }
+
+    // Pads the columns that had no value in the current row with nulls
+    void end_row()
+    {
+        ++rows_;
+        for (auto& column : columns_)
+        {
+            while (column.size() < rows_)
+            {
+                column.push_back_null();
+            }
+        }
+    }
+
+    void clear()
+    {
+        rows_ = 0;
+        columns_.clear();
+    }
+};
+
+using csv_table = basic_csv_table<char>;
+using wcsv_table = basic_csv_table<wchar_t>;
+
+template <typename T>
+struct is_basic_csv_table : std::false_type
+{};
+
+template <typename CharT>
+struct is_basic_csv_table<basic_csv_table<CharT>> : std::true_type
+{};
+
+namespace detail {
+
+    // Fills a basic_csv_table from the events of a basic_csv_parser in stream_columns mode.
+    // The parser reports each value through its visitor, one call per cell, as it does for
+    // every other target, so that typed values, column_types and infer_types apply unchanged.
+    template <typename CharT>
+    class csv_table_decoder final : public basic_json_visitor<CharT>
+    {
+    public:
+        using string_view_type = typename basic_json_visitor<CharT>::string_view_type;
+        using table_type = basic_csv_table<CharT>;
+    private:
+        table_type& table_;
+        std::size_t column_index_{0};
+    public:
+        explicit csv_table_decoder(table_type& table)
+            : table_(table)
+        {
+        }
+
+    private:
+        void visit_flush() override
+        {
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_object(semantic_tag, const ser_context&, std::error_code& ec) override
+        {
+            ec = csv_errc::invalid_parse_state;
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_end_object(const ser_context&, std::error_code& ec) override
+        {
+            ec = csv_errc::invalid_parse_state;
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        // Subfields have no columnar representation
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_array(semantic_tag, const ser_context&, std::error_code& ec) override
+        {
+            ec = conv_errc::conversion_failed;
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_end_array(const ser_context&, std::error_code&) override
+        {
+            if (column_index_ > 0)
+            {
+                table_.end_row();
+                column_index_ = 0;
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_key(const string_view_type&, const ser_context&, std::error_code& ec) override
+        {
+            ec = csv_errc::invalid_parse_state;
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_null(semantic_tag, const ser_context&, std::error_code&) override
+        {
+            table_.column(column_index_++).push_back_null();
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_string(const string_view_type& value, semantic_tag, const ser_context&, std::error_code&) override
+        {
+            table_.column(column_index_++).push_back(value);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view&, semantic_tag, const ser_context&, std::error_code& ec) override
+        {
+            ec = conv_errc::conversion_failed;
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_int64(int64_t value, semantic_tag, const ser_context&, std::error_code&) override
+        {
+            table_.column(column_index_++).push_back(value);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_uint64(uint64_t value, semantic_tag, const ser_context&, std::error_code&) override
+        {
+            if (value <= static_cast<uint64_t>((std::numeric_limits<int64_t>::max)()))
+            {
+                table_.column(column_index_++).push_back(static_cast<int64_t>(value));
+            }
+            else
+            {
+                // Kept as text rather than rounded to a double
+                std::basic_string<CharT> s;
+                jsoncons::from_integer(value, s);
+                table_.column(column_index_++).push_back(string_view_type(s));
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_half(uint16_t value, semantic_tag, const ser_context&, std::error_code&) override
+        {
+            table_.column(column_index_++).push_back(binary::decode_half(value));
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_double(double value, semantic_tag, const ser_context&, std::error_code&) override
+        {
+            table_.column(column_index_++).push_back(value);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_bool(bool value, semantic_tag, const ser_context&, std::error_code&) override
+        {
+            table_.column(column_index_++).push_back(value);
+            JSONCONS_VISITOR_RETURN;
+        }
+    };
+
+    template <typename CharT,typename Source,typename Sourceable>
+    read_result<basic_csv_table<CharT>> try_decode_csv_table(Sourceable&& source,
+        const basic_csv_decode_options<CharT>& options)
+    {
+        using result_type = read_result<basic_csv_table<CharT>>;
+
+        basic_csv_table<CharT> table;
+        csv_table_decoder<CharT> decoder(table);
+        text_source_adaptor<Source> src(std::forward<Sourceable>(source));
+        basic_csv_parser<CharT> parser(options);
+        parser.stream_columns();
+
+        std::error_code ec;
+        if (src.is_error())
+        {
+            return result_type{jsoncons::unexpect, csv_errc::source_error, parser.line(), parser.column()};
+        }
+        while (!parser.stopped())
+        {
+            if (parser.source_exhausted())
+            {
+                auto s = src.read_buffer(ec);
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    return result_type{jsoncons::unexpect, ec, parser.line(), parser.column()};
+                }
+                if (s.size() > 0)
+                {
+                    parser.update(s.data(),s.size());
+                }
+            }
+            parser.parse_some(decoder, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return result_type{jsoncons::unexpect, ec, parser.line(), parser.column()};
+            }
+        }
+
+        const auto& names = parser.column_labels();
+        for (std::size_t i = 0; i < names.size(); ++i)
+        {
+            table.column(i).name(jsoncons::basic_string_view<CharT>(names[i].data(), names[i].size()));
+        }
+        return result_type{std::move(table)};
+    }
+
+} // namespace detail
+
+} // namespace csv
+} // namespace jsoncons
+
+#endif // JSONCONS_EXT_CSV_CSV_TABLE_HPP
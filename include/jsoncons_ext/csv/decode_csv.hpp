@@ -22,6 +22,7 @@
 #include <jsoncons_ext/csv/csv_encoder.hpp>
 #include <jsoncons_ext/csv/csv_options.hpp>
 #include <jsoncons_ext/csv/csv_reader.hpp>
+#include <jsoncons_ext/csv/csv_table.hpp>
 
 namespace jsoncons { 
 namespace csv {
@@ -53,7 +54,16 @@ try_decode_csv(const StringViewLike& s, const basic_csv_decode_options<typename
 }
 
 template <typename T,typename StringViewLike>
-typename std::enable_if<!ext_traits::is_basic_json<T>::value &&
+typename std::enable_if<is_basic_csv_table<T>::value &&
+                        ext_traits::is_sequence_of<StringViewLike,typename T::char_type>::value,read_result<T>>::type 
+try_decode_csv(const StringViewLike& s, const basic_csv_decode_options<typename StringViewLike::value_type>& options = basic_csv_decode_options<typename StringViewLike::value_type>())
+{
+    using char_type = typename StringViewLike::value_type;
+    return detail::try_decode_csv_table<char_type,jsoncons::string_source<char_type>>(s, options);
+}
+
+template <typename T,typename StringViewLike>
+typename std::enable_if<!ext_traits::is_basic_json<T>::value && !is_basic_csv_table<T>::value &&
                         ext_traits::is_string_view_like<StringViewLike>::value,read_result<T>>::type 
 try_decode_csv(const StringViewLike& s, const basic_csv_decode_options<typename StringViewLike::value_type>& options = basic_csv_decode_options<typename StringViewLike::value_type>())
 {
@@ -98,7 +108,14 @@ try_decode_csv(std::basic_istream<CharT>& is, const basic_csv_decode_options<Cha
 }
 
 template <typename T,typename CharT>
-typename std::enable_if<!ext_traits::is_basic_json<T>::value,read_result<T>>::type 
+typename std::enable_if<is_basic_csv_table<T>::value,read_result<T>>::type 
+try_decode_csv(std::basic_istream<CharT>& is, const basic_csv_decode_options<CharT>& options = basic_csv_decode_options<CharT>())
+{
+    return detail::try_decode_csv_table<CharT,jsoncons::stream_source<CharT>>(is, options);
+}
+
+template <typename T,typename CharT>
+typename std::enable_if<!ext_traits::is_basic_json<T>::value && !is_basic_csv_table<T>::value,read_result<T>>::type 
 try_decode_csv(std::basic_istream<CharT>& is, const basic_csv_decode_options<CharT>& options = basic_csv_decode_options<CharT>())
 {
     using value_type = T;
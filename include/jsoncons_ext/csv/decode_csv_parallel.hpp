@@ -0,0 +1,415 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_EXT_CSV_DECODE_CSV_PARALLEL_HPP
+#define JSONCONS_EXT_CSV_DECODE_CSV_PARALLEL_HPP
+
+#include <algorithm> // std::min
+#include <cstddef>
+#include <iterator> // std::advance, std::make_move_iterator
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/detail/parallel_decode.hpp>
+#include <jsoncons/detail/span.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/reflect/decode_traits.hpp>
+#include <jsoncons/ser_utils.hpp>
+#include <jsoncons/utility/more_type_traits.hpp>
+
+#include <jsoncons_ext/csv/csv_cursor.hpp>
+#include <jsoncons_ext/csv/csv_options.hpp>
+#include <jsoncons_ext/csv/csv_reader.hpp>
+#include <jsoncons_ext/csv/decode_csv.hpp>
+
+namespace jsoncons {
+namespace csv {
+namespace detail {
+
+    // Whether the character at p ends a record: a newline, or a carriage return not followed by one
+    template <typename CharT>
+    bool is_record_end(const CharT* p, const CharT* last)
+    {
+        return *p == '\n' || (*p == '\r' && (p + 1 == last || *(p + 1) != '\n'));
+    }
+
+    // The record boundary found in a chunk of input, and the quote parity and number of
+    // record ends of the chunk, computed for both possible quote states at its start
+    template <typename CharT>
+    struct csv_chunk_scan
+    {
+        const CharT* first;
+        const CharT* last;
+        // [0]: assuming the chunk starts outside quotes, [1]: inside
+        const CharT* boundary[2];
+        std::size_t lines[2];
+        bool odd_quotes{false};
+
+        csv_chunk_scan(const CharT* first, const CharT* last)
+            : first(first), last(last), boundary{nullptr,nullptr}, lines{0,0}
+        {
+        }
+
+        // input_end is the end of the whole input, so that a carriage return at the end
+        // of the chunk can be told apart from one that starts a CRLF
+        void scan(CharT quote_char, const CharT* input_end)
+        {
+            bool inside[2] = {false, true};
+            for (const CharT* p = first; p != last; ++p)
+            {
+                if (*p == quote_char)
+                {
+                    inside[0] = !inside[0];
+                    inside[1] = !inside[1];
+                    odd_quotes = !odd_quotes;
+                }
+                else if (is_record_end(p, input_end))
+                {
+                    for (int k = 0; k < 2; ++k)
+                    {
+                        if (!inside[k])
+                        {
+                            ++lines[k];
+                            if (boundary[k] == nullptr)
+                            {
+                                boundary[k] = p + 1;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    // Advances past up to count records that start outside quotes, adding the number of record ends
+    // passed to lines and the number of records to records. Empty records are passed over without
+    // being counted when skip_empty is set.
+    template <typename CharT>
+    const CharT* skip_csv_records(const CharT* p, const CharT* last, CharT quote_char, bool skip_empty,
+        std::size_t count, std::size_t& records, std::size_t& lines)
+    {
+        bool inside = false;
+        const CharT* record = p;
+        std::size_t n = 0;
+        while (n < count && p != last)
+        {
+            if (*p == quote_char)
+            {
+                inside = !inside;
+            }
+            else if (!inside && is_record_end(p, last))
+            {
+                ++lines;
+                // A CRLF record ends at its newline
+                bool empty = p == record || (p == record + 1 && *record == '\r');
+                if (!(empty && skip_empty))
+                {
+                    ++n;
+                }
+                record = p + 1;
+            }
+            ++p;
+        }
+        records += n;
+        return p;
+    }
+
+    // A run of complete records, and the number of record ends that precede it
+    template <typename CharT>
+    struct csv_piece
+    {
+        const CharT* first;
+        const CharT* last;
+        std::size_t line_offset;
+
+        std::size_t size() const
+        {
+            return static_cast<std::size_t>(last - first);
+        }
+    };
+
+    // A source that reads the text ahead of a piece, the header lines and the records sampled for
+    // types, and then the piece, so that the piece is parsed in place with the same column names
+    // and learned types as the records that precede it
+    template <typename CharT>
+    class csv_piece_source
+    {
+    public:
+        using value_type = CharT;
+    private:
+        span<const CharT> parts_[2];
+        std::size_t index_{0};
+    public:
+        csv_piece_source(span<const CharT> prefix, span<const CharT> piece)
+            : parts_{prefix, piece}
+        {
+            skip_empty_parts();
+        }
+
+        csv_piece_source(const csv_piece_source&) = delete;
+        csv_piece_source(csv_piece_source&&) = default;
+
+        csv_piece_source& operator=(const csv_piece_source&) = delete;
+        csv_piece_source& operator=(csv_piece_source&&) = default;
+
+        bool eof() const
+        {
+            return index_ == 2;
+        }
+
+        bool is_error() const
+        {
+            return false;
+        }
+
+        span<const CharT> read_buffer()
+        {
+            if (index_ == 2)
+            {
+                return span<const CharT>();
+            }
+            span<const CharT> s = parts_[index_++];
+            skip_empty_parts();
+            return s;
+        }
+    private:
+        void skip_empty_parts()
+        {
+            while (index_ < 2 && parts_[index_].empty())
+            {
+                ++index_;
+            }
+        }
+    };
+
+    template <typename T,typename CharT>
+    typename std::enable_if<ext_traits::is_basic_json<T>::value,read_result<T>>::type
+    try_decode_csv_piece(csv_piece_source<CharT>&& source, const basic_csv_decode_options<CharT>& options)
+    {
+        using result_type = read_result<T>;
+
+        std::error_code ec;
+        json_decoder<T> decoder;
+        basic_csv_reader<CharT,csv_piece_source<CharT>> reader(std::move(source), decoder, options);
+        reader.read(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            return result_type{jsoncons::unexpect, ec, reader.line(), reader.column()};
+        }
+        if (JSONCONS_UNLIKELY(!decoder.is_valid()))
+        {
+            return result_type{jsoncons::unexpect, conv_errc::conversion_failed, reader.line(), reader.column()};
+        }
+        return result_type{decoder.get_result()};
+    }
+
+    template <typename T,typename CharT>
+    typename std::enable_if<!ext_traits::is_basic_json<T>::value,read_result<T>>::type
+    try_decode_csv_piece(csv_piece_source<CharT>&& source, const basic_csv_decode_options<CharT>& options)
+    {
+        using result_type = read_result<T>;
+
+        std::error_code ec;
+        basic_csv_cursor<CharT,csv_piece_source<CharT>> cursor(std::move(source), options, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            return result_type{jsoncons::unexpect, ec, cursor.line(), cursor.column()};
+        }
+        return reflect::decode_traits<T>::try_decode(make_alloc_set(), cursor);
+    }
+
+    template <typename T>
+    typename std::enable_if<ext_traits::is_basic_json<T>::value>::type
+    append_rows(T& to, T&& from, std::size_t skip)
+    {
+        auto rows = from.array_range();
+        auto first = rows.begin();
+        std::advance(first, (std::min)(skip, from.size()));
+        for (; first != rows.end(); ++first)
+        {
+            to.push_back(std::move(*first));
+        }
+    }
+
+    template <typename T>
+    typename std::enable_if<!ext_traits::is_basic_json<T>::value>::type
+    append_rows(T& to, T&& from, std::size_t skip)
+    {
+        auto first = from.begin();
+        std::advance(first, (std::min)(skip, static_cast<std::size_t>(from.size())));
+        to.insert(to.end(), std::make_move_iterator(first), std::make_move_iterator(from.end()));
+    }
+
+    template <typename CharT>
+    bool can_decode_csv_in_parallel(const basic_csv_decode_options<CharT>& options)
+    {
+        switch (options.mapping_kind())
+        {
+            case csv_mapping_kind::n_objects:
+                break;
+            case csv_mapping_kind::n_rows:
+                if (options.header_lines() > 0)
+                {
+                    return false;
+                }
+                break;
+            default:
+                return false;
+        }
+        // Quote parity identifies quoted regions only when quotes are escaped by doubling,
+        // and comments may contain unbalanced quotes
+        return options.quote_escape_char() == options.quote_char() &&
+               options.comment_starter() == CharT() &&
+               options.max_lines() == (std::numeric_limits<std::size_t>::max)();
+    }
+
+} // namespace detail
+
+// Decodes CSV text into a basic_json array or a sequence container of rows, parsing chunks of
+// the input on up to num_threads threads (by default, the number of hardware threads). Each chunk
+// starts at the first record boundary after an evenly spaced split point, which is resolved
+// by tracking quote parity over the preceding chunks. Every chunk is parsed in place after the
+// header lines and the records sampled for types, so all chunks share the column names and the
+// learned column types. Rows are returned in their original order.
+template <typename T,typename StringViewLike>
+typename std::enable_if<ext_traits::is_string_view_like<StringViewLike>::value,read_result<T>>::type
+try_decode_csv_parallel(const StringViewLike& s,
+    const basic_csv_decode_options<typename StringViewLike::value_type>& options = basic_csv_decode_options<typename StringViewLike::value_type>(),
+    std::size_t num_threads = 0)
+{
+    using char_type = typename StringViewLike::value_type;
+    using result_type = read_result<T>;
+
+    if (num_threads == 0)
+    {
+        num_threads = jsoncons::detail::default_thread_count();
+    }
+
+    const char_type* first = s.data();
+    const char_type* last = s.data() + s.size();
+    if (num_threads <= 1 || !detail::can_decode_csv_in_parallel(options))
+    {
+        return try_decode_csv<T>(s, options);
+    }
+
+    // The header lines, and the records sampled for types, which are parsed ahead of every chunk
+    const char_type quote_char = options.quote_char();
+    std::size_t header_records = 0;
+    std::size_t prefix_lines = 0;
+    const char_type* body = detail::skip_csv_records(first, last, quote_char, options.ignore_empty_lines(),
+        options.header_lines(), header_records, prefix_lines);
+    if (header_records < options.header_lines())
+    {
+        return try_decode_csv<T>(s, options);
+    }
+    std::size_t sampled_records = 0;
+    if (options.infer_types() && options.type_sample_rows() > 0)
+    {
+        body = detail::skip_csv_records(body, last, quote_char, options.ignore_empty_lines(),
+            options.type_sample_rows(), sampled_records, prefix_lines);
+    }
+    if (body == last)
+    {
+        return try_decode_csv<T>(s, options);
+    }
+    const span<const char_type> prefix(first, static_cast<std::size_t>(body - first));
+
+    // Count the rows that the prefix decodes to; header lines after the first become data rows
+    std::size_t prefix_rows = 0;
+    if (!prefix.empty())
+    {
+        auto rows = detail::try_decode_csv_piece<T>(detail::csv_piece_source<char_type>(span<const char_type>(), prefix), options);
+        if (JSONCONS_UNLIKELY(!rows))
+        {
+            return try_decode_csv<T>(s, options);
+        }
+        prefix_rows = static_cast<std::size_t>(rows->size());
+    }
+
+    // Scan evenly sized chunks of the body for record boundaries under both quote states
+    std::size_t length = static_cast<std::size_t>(last - body);
+    std::vector<detail::csv_chunk_scan<char_type>> chunks;
+    chunks.reserve(num_threads);
+    for (std::size_t i = 0; i < num_threads; ++i)
+    {
+        chunks.emplace_back(body + length*i/num_threads, body + length*(i+1)/num_threads);
+    }
+    jsoncons::detail::parallel_for(chunks.size(), num_threads, [&](std::size_t i)
+    {
+        chunks[i].scan(quote_char, last);
+    });
+
+    // Resolve the actual quote state at the start of each chunk and cut at its first record boundary.
+    // The first piece starts at the beginning of the input and is parsed as it is.
+    std::vector<detail::csv_piece<char_type>> pieces;
+    pieces.push_back(detail::csv_piece<char_type>{first, last, prefix_lines});
+    bool inside = chunks[0].odd_quotes;
+    std::size_t lines = prefix_lines + chunks[0].lines[0];
+    for (std::size_t i = 1; i < chunks.size(); ++i)
+    {
+        const auto& chunk = chunks[i];
+        int k = inside ? 1 : 0;
+        if (chunk.boundary[k] != nullptr && chunk.boundary[k] != last)
+        {
+            pieces.back().last = chunk.boundary[k];
+            pieces.push_back(detail::csv_piece<char_type>{chunk.boundary[k], last, lines + 1});
+        }
+        lines += chunk.lines[k];
+        inside = (inside != chunk.odd_quotes);
+    }
+
+    auto results = jsoncons::detail::parallel_decode<T>(pieces, num_threads,
+        [&](const detail::csv_piece<char_type>& piece) -> result_type
+        {
+            detail::csv_piece_source<char_type> source(piece.first == first ? span<const char_type>() : prefix,
+                span<const char_type>(piece.first, piece.size()));
+            auto result = detail::try_decode_csv_piece<T>(std::move(source), options);
+            if (JSONCONS_UNLIKELY(!result))
+            {
+                // Report the line in the whole input
+                std::size_t line = result.error().line() + piece.line_offset - prefix_lines;
+                return result_type{jsoncons::unexpect, result.error().code(), line, result.error().column()};
+            }
+            return result;
+        });
+    if (JSONCONS_UNLIKELY(!results))
+    {
+        return result_type{jsoncons::unexpect, results.error()};
+    }
+
+    // Rows decoded from the prefix ahead of the later pieces are dropped
+    T value = std::move(results->front());
+    for (std::size_t i = 1; i < results->size(); ++i)
+    {
+        detail::append_rows(value, std::move((*results)[i]), prefix_rows);
+    }
+    return result_type{std::move(value)};
+}
+
+template <typename T,typename StringViewLike>
+typename std::enable_if<ext_traits::is_string_view_like<StringViewLike>::value,T>::type
+decode_csv_parallel(const StringViewLike& s,
+    const basic_csv_decode_options<typename StringViewLike::value_type>& options = basic_csv_decode_options<typename StringViewLike::value_type>(),
+    std::size_t num_threads = 0)
+{
+    auto result = try_decode_csv_parallel<T>(s, options, num_threads);
+    if (!result)
+    {
+        JSONCONS_THROW(ser_error(result.error().code(), result.error().line(), result.error().column()));
+    }
+    return std::move(*result);
+}
+
+} // namespace csv
+} // namespace jsoncons
+
+#endif // JSONCONS_EXT_CSV_DECODE_CSV_PARALLEL_HPP
@@ -0,0 +1,796 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_EXT_JSONPATH_STREAMING_EXPRESSION_HPP
+#define JSONCONS_EXT_JSONPATH_STREAMING_EXPRESSION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/staj_cursor.hpp>
+#include <jsoncons/staj_event.hpp>
+#include <jsoncons/utility/unicode_traits.hpp>
+
+#include <jsoncons_ext/jsonpath/json_location.hpp>
+#include <jsoncons_ext/jsonpath/jsonpath_error.hpp>
+#include <jsoncons_ext/jsonpath/jsonpath_expression.hpp>
+
+namespace jsoncons {
+namespace jsonpath {
+
+namespace detail {
+
+    enum class stream_selector_kind {name, index, wildcard, slice, filter};
+
+    template <typename StringT>
+    struct stream_selector
+    {
+        stream_selector_kind kind;
+        StringT name;
+        std::size_t start{0};
+        std::size_t stop{(std::numeric_limits<std::size_t>::max)()};
+        std::size_t step{1};
+        std::size_t filter{0};
+
+        explicit stream_selector(stream_selector_kind kind)
+            : kind(kind)
+        {
+        }
+    };
+
+    template <typename StringT>
+    struct stream_step
+    {
+        bool recursive{false};
+        std::vector<stream_selector<StringT>> selectors;
+    };
+
+} // namespace detail
+
+    // Evaluates a forward-only subset of JSONPath against a basic_staj_cursor
+    // without building a document. Subtrees that the path can not match are
+    // skipped, only matching nodes (and the children tested by filters) are
+    // materialized.
+    template <typename Json>
+    class streaming_expression
+    {
+    public:
+        using value_type = Json;
+        using char_type = typename Json::char_type;
+        using string_type = std::basic_string<char_type>;
+        using string_view_type = typename Json::string_view_type;
+        using path_element_type = basic_path_element<char_type,std::allocator<char_type>>;
+        using location_type = basic_json_location<char_type>;
+    private:
+        using selector_type = detail::stream_selector<string_type>;
+        using step_type = detail::stream_step<string_type>;
+
+        struct frame
+        {
+            std::vector<std::size_t> states;
+            bool is_object;
+            std::size_t index{0};
+
+            frame(std::vector<std::size_t>&& states, bool is_object)
+                : states(std::move(states)), is_object(is_object)
+            {
+            }
+        };
+
+        std::vector<step_type> steps_;
+        std::vector<jsonpath_expression<Json>> filters_;
+    public:
+        streaming_expression(std::vector<step_type>&& steps, std::vector<jsonpath_expression<Json>>&& filters)
+            : steps_(std::move(steps)), filters_(std::move(filters))
+        {
+        }
+
+        streaming_expression(const streaming_expression&) = delete;
+        streaming_expression(streaming_expression&&) = default;
+
+        ~streaming_expression() = default;
+
+        streaming_expression& operator=(const streaming_expression&) = delete;
+        streaming_expression& operator=(streaming_expression&&) = default;
+
+        // Reads one value from the cursor, calling callback(location, value)
+        // for each match in document order. On return the cursor is positioned
+        // on the last event of the value.
+        template <typename BinaryCallback>
+        void evaluate(basic_staj_cursor<char_type>& cursor, BinaryCallback callback) const
+        {
+            std::error_code ec;
+            evaluate(cursor, callback, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                JSONCONS_THROW(ser_error(ec, cursor.line(), cursor.column()));
+            }
+        }
+
+        template <typename BinaryCallback>
+        void evaluate(basic_staj_cursor<char_type>& cursor, BinaryCallback callback, std::error_code& ec) const
+        {
+            std::vector<path_element_type> path;
+
+            if (steps_.empty())
+            {
+                Json root = materialize(cursor, ec);
+                if (JSONCONS_UNLIKELY(ec)) {return;}
+                callback(location_type{}, root);
+                return;
+            }
+            if (!is_begin_container(cursor.current().event_type()))
+            {
+                return;
+            }
+
+            std::vector<frame> stack;
+            stack.emplace_back(std::vector<std::size_t>{0}, cursor.current().event_type() == staj_event_type::begin_object);
+            cursor.next(ec);
+            if (JSONCONS_UNLIKELY(ec)) {return;}
+
+            std::vector<std::size_t> states;
+            while (!stack.empty())
+            {
+                const staj_event_type event_type = cursor.current().event_type();
+                if (event_type == staj_event_type::end_object || event_type == staj_event_type::end_array)
+                {
+                    stack.pop_back();
+                    if (stack.empty())
+                    {
+                        break;
+                    }
+                    path.pop_back();
+                    cursor.next(ec);
+                    if (JSONCONS_UNLIKELY(ec)) {return;}
+                    continue;
+                }
+
+                frame& top = stack.back();
+                if (top.is_object)
+                {
+                    auto key = cursor.current().template get<string_view_type>();
+                    path.emplace_back(string_type(key.data(), key.size()));
+                    cursor.next(ec);
+                    if (JSONCONS_UNLIKELY(ec)) {return;}
+                }
+                else
+                {
+                    path.emplace_back(top.index++);
+                }
+
+                bool need_value = false;
+                states.clear();
+                transition(top.states, path.back(), nullptr, states, need_value);
+
+                if (need_value || contains_final(states))
+                {
+                    Json value = materialize(cursor, ec);
+                    if (JSONCONS_UNLIKELY(ec)) {return;}
+                    visit(stack.back().states, path, value, callback);
+                    path.pop_back();
+                }
+                else if (!states.empty() && is_begin_container(cursor.current().event_type()))
+                {
+                    stack.emplace_back(std::move(states), cursor.current().event_type() == staj_event_type::begin_object);
+                    states = std::vector<std::size_t>{};
+                }
+                else
+                {
+                    cursor.skip(ec);
+                    if (JSONCONS_UNLIKELY(ec)) {return;}
+                    path.pop_back();
+                }
+                cursor.next(ec);
+                if (JSONCONS_UNLIKELY(ec)) {return;}
+            }
+        }
+
+    private:
+        static bool is_begin_container(staj_event_type event_type)
+        {
+            return event_type == staj_event_type::begin_object || event_type == staj_event_type::begin_array;
+        }
+
+        bool contains_final(const std::vector<std::size_t>& states) const
+        {
+            return !states.empty() && states.back() == steps_.size();
+        }
+
+        static Json materialize(basic_staj_cursor<char_type>& cursor, std::error_code& ec)
+        {
+            json_decoder<Json> decoder;
+            cursor.read_to(decoder, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return Json{};
+            }
+            return decoder.get_result();
+        }
+
+        bool test_filter(std::size_t filter, Json& value) const
+        {
+            // Filters apply to the current element, so evaluate "$[?...]"
+            // against a one element array holding it
+            Json wrapper(json_array_arg);
+            wrapper.emplace_back(std::move(value));
+            bool matched = !filters_[filter].evaluate(wrapper).empty();
+            value = std::move(wrapper[0]);
+            return matched;
+        }
+
+        static bool matches(const selector_type& sel, const path_element_type& element)
+        {
+            switch (sel.kind)
+            {
+                case detail::stream_selector_kind::name:
+                    return element.has_name() && element.name() == sel.name;
+                case detail::stream_selector_kind::index:
+                    return element.has_index() && element.index() == sel.start;
+                case detail::stream_selector_kind::wildcard:
+                    return true;
+                case detail::stream_selector_kind::slice:
+                    return element.has_index() && element.index() >= sel.start && element.index() < sel.stop
+                        && (element.index() - sel.start) % sel.step == 0;
+                default:
+                    return false;
+            }
+        }
+
+        // Computes the states reached by stepping from a node in states into
+        // its child element. A null value defers filter selectors by setting
+        // need_value.
+        void transition(const std::vector<std::size_t>& states, const path_element_type& element,
+            Json* value, std::vector<std::size_t>& result, bool& need_value) const
+        {
+            for (std::size_t i : states)
+            {
+                if (i == steps_.size())
+                {
+                    continue;
+                }
+                const step_type& step = steps_[i];
+                if (step.recursive)
+                {
+                    result.push_back(i);
+                }
+                for (const auto& sel : step.selectors)
+                {
+                    bool matched;
+                    if (sel.kind == detail::stream_selector_kind::filter)
+                    {
+                        if (value == nullptr)
+                        {
+                            need_value = true;
+                            continue;
+                        }
+                        matched = test_filter(sel.filter, *value);
+                    }
+                    else
+                    {
+                        matched = matches(sel, element);
+                    }
+                    if (matched)
+                    {
+                        result.push_back(i+1);
+                        break;
+                    }
+                }
+            }
+            std::sort(result.begin(), result.end());
+            result.erase(std::unique(result.begin(), result.end()), result.end());
+        }
+
+        template <typename BinaryCallback>
+        void visit(const std::vector<std::size_t>& parent_states, std::vector<path_element_type>& path,
+            Json& value, BinaryCallback& callback) const
+        {
+            std::vector<std::size_t> states;
+            bool need_value = false;
+            transition(parent_states, path.back(), &value, states, need_value);
+            if (states.empty())
+            {
+                return;
+            }
+            if (contains_final(states))
+            {
+                std::vector<path_element_type> elements(path);
+                callback(location_type(std::move(elements)), static_cast<const Json&>(value));
+            }
+            if (value.is_object())
+            {
+                for (auto& member : value.object_range())
+                {
+                    path.emplace_back(string_type(member.key().data(), member.key().size()));
+                    visit(states, path, member.value(), callback);
+                    path.pop_back();
+                }
+            }
+            else if (value.is_array())
+            {
+                std::size_t index = 0;
+                for (auto& item : value.array_range())
+                {
+                    path.emplace_back(index++);
+                    visit(states, path, item, callback);
+                    path.pop_back();
+                }
+            }
+        }
+    };
+
+namespace detail {
+
+    template <typename Json>
+    class streaming_expression_parser
+    {
+    public:
+        using char_type = typename Json::char_type;
+        using string_type = std::basic_string<char_type>;
+        using string_view_type = typename Json::string_view_type;
+        using selector_type = stream_selector<string_type>;
+        using step_type = stream_step<string_type>;
+    private:
+        const char_type* begin_input_{nullptr};
+        const char_type* end_input_{nullptr};
+        const char_type* p_{nullptr};
+        std::vector<step_type> steps_;
+        std::vector<jsonpath_expression<Json>> filters_;
+    public:
+        std::size_t line() const
+        {
+            return 1;
+        }
+
+        std::size_t column() const
+        {
+            return static_cast<std::size_t>(p_ - begin_input_) + 1;
+        }
+
+        streaming_expression<Json> parse(const string_view_type& path, std::error_code& ec)
+        {
+            begin_input_ = path.data();
+            end_input_ = path.data() + path.size();
+            p_ = begin_input_;
+            steps_.clear();
+            filters_.clear();
+
+            skip_whitespace();
+            if (p_ == end_input_ || *p_ != '$')
+            {
+                ec = jsonpath_errc::expected_root_or_current_node;
+                return streaming_expression<Json>({}, {});
+            }
+            ++p_;
+            skip_whitespace();
+            while (p_ < end_input_)
+            {
+                step_type step;
+                if (*p_ == '.')
+                {
+                    ++p_;
+                    if (p_ < end_input_ && *p_ == '.')
+                    {
+                        step.recursive = true;
+                        ++p_;
+                    }
+                    if (p_ == end_input_)
+                    {
+                        ec = jsonpath_errc::unexpected_eof;
+                        return streaming_expression<Json>({}, {});
+                    }
+                    if (*p_ == '[' && step.recursive)
+                    {
+                        ++p_;
+                        parse_bracket(step, ec);
+                    }
+                    else if (*p_ == '*')
+                    {
+                        ++p_;
+                        step.selectors.emplace_back(stream_selector_kind::wildcard);
+                    }
+                    else
+                    {
+                        parse_identifier(step, ec);
+                    }
+                }
+                else if (*p_ == '[')
+                {
+                    ++p_;
+                    parse_bracket(step, ec);
+                }
+                else
+                {
+                    ec = jsonpath_errc::expected_lbracket_or_dot;
+                }
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    return streaming_expression<Json>({}, {});
+                }
+                steps_.push_back(std::move(step));
+                skip_whitespace();
+            }
+            return streaming_expression<Json>(std::move(steps_), std::move(filters_));
+        }
+
+    private:
+        void skip_whitespace()
+        {
+            while (p_ < end_input_ && (*p_ == ' ' || *p_ == '\t' || *p_ == '\r' || *p_ == '\n'))
+            {
+                ++p_;
+            }
+        }
+
+        void parse_identifier(step_type& step, std::error_code& ec)
+        {
+            const char_type* start = p_;
+            while (p_ < end_input_ && *p_ != '.' && *p_ != '[' && *p_ != ' ' && *p_ != '\t' && *p_ != '\r' && *p_ != '\n')
+            {
+                ++p_;
+            }
+            if (p_ == start)
+            {
+                ec = jsonpath_errc::expected_relative_path;
+                return;
+            }
+            selector_type sel{stream_selector_kind::name};
+            sel.name.assign(start, p_);
+            step.selectors.push_back(std::move(sel));
+        }
+
+        void parse_bracket(step_type& step, std::error_code& ec)
+        {
+            skip_whitespace();
+            if (p_ < end_input_ && *p_ == '?')
+            {
+                parse_filter(step, ec);
+                return;
+            }
+            while (true)
+            {
+                skip_whitespace();
+                if (p_ == end_input_)
+                {
+                    ec = jsonpath_errc::unexpected_eof;
+                    return;
+                }
+                if (*p_ == '*')
+                {
+                    ++p_;
+                    step.selectors.emplace_back(stream_selector_kind::wildcard);
+                }
+                else if (*p_ == '\'' || *p_ == '\"')
+                {
+                    selector_type sel{stream_selector_kind::name};
+                    parse_quoted_string(sel.name, ec);
+                    if (JSONCONS_UNLIKELY(ec)) {return;}
+                    step.selectors.push_back(std::move(sel));
+                }
+                else if (*p_ == '-')
+                {
+                    // Negative indices and steps count from the end of an
+                    // array, which a forward-only stream does not know
+                    ec = jsonpath_errc::unsupported_streaming_selector;
+                    return;
+                }
+                else if (*p_ == ':' || (*p_ >= '0' && *p_ <= '9'))
+                {
+                    parse_index_or_slice(step, ec);
+                    if (JSONCONS_UNLIKELY(ec)) {return;}
+                }
+                else
+                {
+                    ec = jsonpath_errc::unsupported_streaming_selector;
+                    return;
+                }
+                skip_whitespace();
+                if (p_ == end_input_)
+                {
+                    ec = jsonpath_errc::unexpected_eof;
+                    return;
+                }
+                if (*p_ == ']')
+                {
+                    ++p_;
+                    return;
+                }
+                if (*p_ != ',')
+                {
+                    ec = jsonpath_errc::expected_comma_or_rbracket;
+                    return;
+                }
+                ++p_;
+            }
+        }
+
+        bool parse_number(std::size_t& n, std::error_code& ec)
+        {
+            skip_whitespace();
+            if (p_ < end_input_ && *p_ == '-')
+            {
+                ec = jsonpath_errc::unsupported_streaming_selector;
+                return false;
+            }
+            if (p_ == end_input_ || *p_ < '0' || *p_ > '9')
+            {
+                return false;
+            }
+            n = 0;
+            while (p_ < end_input_ && *p_ >= '0' && *p_ <= '9')
+            {
+                std::size_t digit = static_cast<std::size_t>(*p_ - '0');
+                if (n > ((std::numeric_limits<std::size_t>::max)() - digit) / 10)
+                {
+                    ec = jsonpath_errc::invalid_number;
+                    return false;
+                }
+                n = n*10 + digit;
+                ++p_;
+            }
+            skip_whitespace();
+            return true;
+        }
+
+        void parse_index_or_slice(step_type& step, std::error_code& ec)
+        {
+            selector_type sel{stream_selector_kind::index};
+            bool has_start = parse_number(sel.start, ec);
+            if (JSONCONS_UNLIKELY(ec)) {return;}
+            if (p_ == end_input_ || *p_ != ':')
+            {
+                if (!has_start)
+                {
+                    ec = jsonpath_errc::expected_slice_start;
+                    return;
+                }
+                step.selectors.push_back(std::move(sel));
+                return;
+            }
+            sel.kind = stream_selector_kind::slice;
+            ++p_;
+            parse_number(sel.stop, ec);
+            if (JSONCONS_UNLIKELY(ec)) {return;}
+            if (p_ < end_input_ && *p_ == ':')
+            {
+                ++p_;
+                parse_number(sel.step, ec);
+                if (JSONCONS_UNLIKELY(ec)) {return;}
+                if (sel.step == 0)
+                {
+                    ec = jsonpath_errc::step_cannot_be_zero;
+                    return;
+                }
+            }
+            step.selectors.push_back(std::move(sel));
+        }
+
+        void parse_filter(step_type& step, std::error_code& ec)
+        {
+            // Find the closing bracket, respecting nesting, quoted strings and regex literals
+            const char_type* start = p_;
+            std::size_t depth = 0;
+            char_type quote = 0;
+            char_type prev = 0;
+            while (p_ < end_input_)
+            {
+                char_type c = *p_;
+                if (quote != 0)
+                {
+                    if (c == '\\')
+                    {
+                        ++p_;
+                    }
+                    else if (c == quote)
+                    {
+                        quote = 0;
+                    }
+                }
+                else if (c == '\'' || c == '\"' || (c == '/' && prev == '~'))
+                {
+                    quote = c;
+                }
+                else if (c == '$')
+                {
+                    // A filter is tested against the current element alone, the root
+                    // is not available while streaming
+                    ec = jsonpath_errc::unsupported_streaming_selector;
+                    return;
+                }
+                else if (c == '(' || c == '[')
+                {
+                    ++depth;
+                }
+                else if (c == ')')
+                {
+                    if (depth == 0)
+                    {
+                        ec = jsonpath_errc::unbalanced_parentheses;
+                        return;
+                    }
+                    --depth;
+                }
+                else if (c == ']')
+                {
+                    if (depth == 0)
+                    {
+                        break;
+                    }
+                    --depth;
+                }
+                if (quote == 0 && c != ' ' && c != '\t')
+                {
+                    prev = c;
+                }
+                if (p_ < end_input_)
+                {
+                    ++p_;
+                }
+            }
+            if (p_ >= end_input_)
+            {
+                ec = jsonpath_errc::expected_rbracket;
+                return;
+            }
+
+            string_type filter_path;
+            filter_path.push_back('$');
+            filter_path.push_back('[');
+            filter_path.append(start, p_);
+            filter_path.push_back(']');
+            ++p_;
+
+            auto expr = make_expression<Json>(string_view_type(filter_path.data(), filter_path.size()), ec);
+            if (JSONCONS_UNLIKELY(ec)) {return;}
+
+            selector_type sel{stream_selector_kind::filter};
+            sel.filter = filters_.size();
+            filters_.push_back(std::move(expr));
+            step.selectors.push_back(std::move(sel));
+        }
+
+        bool parse_hex4(uint32_t& cp, std::error_code& ec)
+        {
+            cp = 0;
+            for (int i = 0; i < 4; ++i)
+            {
+                if (p_ == end_input_)
+                {
+                    ec = jsonpath_errc::unexpected_eof;
+                    return false;
+                }
+                char_type c = *p_++;
+                if (c >= '0' && c <= '9')
+                {
+                    cp = (cp << 4) + static_cast<uint32_t>(c - '0');
+                }
+                else if (c >= 'a' && c <= 'f')
+                {
+                    cp = (cp << 4) + static_cast<uint32_t>(c - 'a' + 10);
+                }
+                else if (c >= 'A' && c <= 'F')
+                {
+                    cp = (cp << 4) + static_cast<uint32_t>(c - 'A' + 10);
+                }
+                else
+                {
+                    ec = jsonpath_errc::invalid_codepoint;
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void parse_quoted_string(string_type& buffer, std::error_code& ec)
+        {
+            const char_type quote = *p_++;
+            while (p_ < end_input_)
+            {
+                char_type c = *p_++;
+                if (c == quote)
+                {
+                    return;
+                }
+                if (c != '\\')
+                {
+                    buffer.push_back(c);
+                    continue;
+                }
+                if (p_ == end_input_)
+                {
+                    break;
+                }
+                c = *p_++;
+                switch (c)
+                {
+                    case '\'': case '\"': case '\\': case '/':
+                        buffer.push_back(c);
+                        break;
+                    case 'b':
+                        buffer.push_back('\b');
+                        break;
+                    case 'f':
+                        buffer.push_back('\f');
+                        break;
+                    case 'n':
+                        buffer.push_back('\n');
+                        break;
+                    case 'r':
+                        buffer.push_back('\r');
+                        break;
+                    case 't':
+                        buffer.push_back('\t');
+                        break;
+                    case 'u':
+                    {
+                        uint32_t cp;
+                        if (!parse_hex4(cp, ec)) {return;}
+                        if (unicode_traits::is_high_surrogate(cp))
+                        {
+                            uint32_t cp2;
+                            if (end_input_ - p_ < 2 || *p_ != '\\' || *(p_+1) != 'u')
+                            {
+                                ec = jsonpath_errc::invalid_codepoint;
+                                return;
+                            }
+                            p_ += 2;
+                            if (!parse_hex4(cp2, ec)) {return;}
+                            cp = 0x10000 + ((cp & 0x3FF) << 10) + (cp2 & 0x3FF);
+                        }
+                        unicode_traits::convert(&cp, 1, buffer);
+                        break;
+                    }
+                    default:
+                        ec = jsonpath_errc::illegal_escaped_character;
+                        return;
+                }
+            }
+            ec = jsonpath_errc::unexpected_eof;
+        }
+    };
+
+} // namespace detail
+
+    template <typename Json>
+    streaming_expression<Json> make_streaming_expression(const typename Json::string_view_type& path)
+    {
+        detail::streaming_expression_parser<Json> parser;
+        std::error_code ec;
+        auto expr = parser.parse(path, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(jsonpath_error(ec, parser.line(), parser.column()));
+        }
+        return expr;
+    }
+
+    template <typename Json>
+    streaming_expression<Json> make_streaming_expression(const typename Json::string_view_type& path, std::error_code& ec)
+    {
+        detail::streaming_expression_parser<Json> parser;
+        return parser.parse(path, ec);
+    }
+
+    template <typename Json,typename BinaryCallback>
+    void stream_query(basic_staj_cursor<typename Json::char_type>& cursor,
+        const typename Json::string_view_type& path, BinaryCallback callback)
+    {
+        auto expr = make_streaming_expression<Json>(path);
+        expr.evaluate(cursor, callback);
+    }
+
+} // namespace jsonpath
+} // namespace jsoncons
+
+#endif // JSONCONS_EXT_JSONPATH_STREAMING_EXPRESSION_HPP
@@ -926,6 +926,11 @@ namespace jsonschema {
         {
         }
 
+        const schema_validator<Json>* items_schema() const
+        {
+            return schema_val_.get();
+        }
+
     private:
 
         walk_state do_validate(const eval_context<Json>& context, const Json& instance, 
@@ -2566,6 +2571,11 @@ namespace jsonschema {
         {
         }
 
+        const std::map<std::string, schema_validator_ptr_type,transparent_string_less<std::string>>& properties() const
+        {
+            return properties_;
+        }
+
         walk_state validate(const eval_context<Json>& context, const Json& instance, 
             const jsonpointer::json_pointer& instance_location,
             evaluation_results& results, 
@@ -2726,6 +2736,11 @@ namespace jsonschema {
         {
         }
 
+        const std::vector<std::pair<std::regex, schema_validator_ptr_type>>& pattern_properties() const
+        {
+            return pattern_properties_;
+        }
+
         walk_state validate(const eval_context<Json>& context, const Json& instance, 
             const jsonpointer::json_pointer& instance_location, 
             evaluation_results& results, 
@@ -2863,6 +2878,21 @@ namespace jsonschema {
         {
         }
 
+        const properties_validator<Json>* properties() const
+        {
+            return properties_.get();
+        }
+
+        const pattern_properties_validator<Json>* pattern_properties() const
+        {
+            return pattern_properties_.get();
+        }
+
+        const schema_validator<Json>* additional_properties() const
+        {
+            return additional_properties_.get();
+        }
+
     private:
 
         walk_state do_validate(const eval_context<Json>& context, const Json& instance, 
@@ -3648,6 +3678,11 @@ namespace jsonschema {
         {
         }
 
+        const schema_validator<Json>* items_schema() const
+        {
+            return items_val_.get();
+        }
+
         walk_state validate(const eval_context<Json>& context, const Json& instance, 
             const jsonpointer::json_pointer& instance_location,
             evaluation_results& results, 
@@ -3771,6 +3806,16 @@ namespace jsonschema {
         {
         }
 
+        const std::vector<schema_validator_ptr_type>& prefix_items() const
+        {
+            return prefix_item_validators_;
+        }
+
+        const items_keyword<Json>* items() const
+        {
+            return items_val_.get();
+        }
+
     private:
 
         walk_state do_validate(const eval_context<Json>& context, const Json& instance, 
@@ -64,6 +64,11 @@ namespace jsonschema {
         document_schema_validator& operator=(const document_schema_validator&) = delete;
         document_schema_validator& operator=(document_schema_validator&&) = default;      
 
+        const schema_validator<Json>* root_schema_validator() const
+        {
+            return schema_val_.get();
+        }
+
         jsoncons::optional<Json> get_default_value() const final
         {
             return schema_val_->get_default_value();
@@ -189,9 +189,14 @@ private:
     }
 };
 
+template <typename Json>
+class streaming_validator;
+
 template <typename Json>
 class json_schema
 {
+    friend class streaming_validator<Json>;
+
     using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
     using document_schema_validator_type = std::unique_ptr<document_schema_validator<Json>>;
 
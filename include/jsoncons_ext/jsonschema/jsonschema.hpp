@@ -8,5 +8,6 @@
 #define JSONCONS_EXT_JSONSCHEMA_JSONSCHEMA_HPP
 
 #include <jsoncons_ext/jsonschema/json_schema_factory.hpp>
+#include <jsoncons_ext/jsonschema/streaming_validator.hpp>
 
 #endif // JSONCONS_EXT_JSONSCHEMA_JSONSCHEMA_HPP
@@ -0,0 +1,752 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_EXT_JSONSCHEMA_STREAMING_VALIDATOR_HPP
+#define JSONCONS_EXT_JSONSCHEMA_STREAMING_VALIDATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_visitor.hpp>
+
+#include <jsoncons_ext/jsonpointer/jsonpointer.hpp>
+#include <jsoncons_ext/jsonschema/common/keyword_validator.hpp>
+#include <jsoncons_ext/jsonschema/common/schema_validator.hpp>
+#include <jsoncons_ext/jsonschema/json_schema.hpp>
+
+namespace jsoncons {
+namespace jsonschema {
+
+    // A json visitor that validates the events it receives against a json_schema,
+    // so that an instance can be validated while it is being parsed.
+    //
+    // Keywords that can be decided from the events seen so far (type, properties,
+    // patternProperties, additionalProperties, items, prefixItems, required,
+    // min/max*, pattern, format, enum and const on scalars, $ref) are evaluated
+    // incrementally. A value whose schema has keywords that need to look at the
+    // whole value, such as allOf, oneOf, uniqueItems or unevaluatedProperties,
+    // is buffered and validated when it is complete.
+    template <typename Json>
+    class streaming_validator : public basic_json_visitor<typename Json::char_type>
+    {
+    public:
+        using char_type = typename Json::char_type;
+        using typename basic_json_visitor<char_type>::string_view_type;
+    private:
+        struct applicator
+        {
+            const schema_validator<Json>* schema;
+            eval_context<Json> context;
+            error_reporter<Json>* reporter;
+        };
+
+        struct route
+        {
+            const keyword_validator<Json>* keyword;
+            eval_context<Json> context;
+            error_reporter<Json>* reporter;
+        };
+
+        struct shape
+        {
+            const validator_base<Json>* validator;
+            eval_context<Json> context;
+            error_reporter<Json>* reporter;
+        };
+
+        // additionalProperties reports one error on the parent object if a
+        // property fails its subschema
+        struct additional_check
+        {
+            collecting_error_listener<Json> listener;
+            const additional_properties_validator<Json>* keyword;
+            jsonpointer::json_pointer eval_path;
+            jsonpointer::json_pointer instance_location;
+            std::string name;
+            error_reporter<Json>* reporter;
+
+            additional_check(const additional_properties_validator<Json>* keyword,
+                const jsonpointer::json_pointer& eval_path,
+                const jsonpointer::json_pointer& instance_location,
+                const std::string& name, error_reporter<Json>* reporter)
+                : keyword(keyword), eval_path(eval_path), instance_location(instance_location),
+                  name(name), reporter(reporter)
+            {
+            }
+        };
+
+        struct pending_value
+        {
+            std::vector<applicator> applicators;
+            std::vector<std::unique_ptr<additional_check>> checks;
+            jsonpointer::json_pointer location;
+        };
+
+        struct frame
+        {
+            pending_value value;
+            bool is_object;
+            std::vector<route> routes;
+            std::vector<shape> shapes;
+            bool count_items{false};
+            std::size_t size{0};
+            Json skeleton;
+            std::string key;
+
+            frame(pending_value&& value, bool is_object)
+                : value(std::move(value)), is_object(is_object)
+            {
+            }
+        };
+
+        static constexpr int max_ref_depth = 64;
+
+        const json_schema<Json>* schema_;
+        std::unique_ptr<error_reporter<Json>> reporter_;
+        std::vector<frame> stack_;
+        json_decoder<Json> decoder_;
+        std::size_t buffer_level_{0};
+        pending_value buffered_;
+        bool aborted_{false};
+        jsoncons::optional<Json> patch_;
+    public:
+        // Throws a validation_error on the first error, like json_schema::validate
+        explicit streaming_validator(const json_schema<Json>& schema)
+            : schema_(std::addressof(schema)),
+              reporter_(jsoncons::make_unique<throwing_error_listener<Json>>())
+        {
+        }
+
+        // Reports errors to a function object with the same signature as
+        // the one passed to json_schema::validate
+        template <typename Reporter>
+        streaming_validator(const json_schema<Json>& schema, Reporter&& reporter)
+            : schema_(std::addressof(schema)),
+              reporter_(jsoncons::make_unique<error_reporter_adaptor<Json,typename std::decay<Reporter>::type>>(std::forward<Reporter>(reporter)))
+        {
+        }
+
+        streaming_validator(const streaming_validator&) = delete;
+        streaming_validator& operator=(const streaming_validator&) = delete;
+
+        std::size_t error_count() const
+        {
+            return reporter_->error_count();
+        }
+
+        bool is_valid() const
+        {
+            return reporter_->error_count() == 0;
+        }
+
+        // True if the reporter returned walk_state::abort
+        bool aborted() const
+        {
+            return aborted_;
+        }
+
+        void reset()
+        {
+            stack_.clear();
+            decoder_.reset();
+            buffer_level_ = 0;
+            buffered_ = pending_value{};
+            aborted_ = false;
+        }
+
+    private:
+        void visit_flush() override
+        {
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_object(semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            begin_container(true, tag, context, ec);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_end_object(const ser_context& context, std::error_code& ec) override
+        {
+            end_container(true, context, ec);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_array(semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            begin_container(false, tag, context, ec);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_end_array(const ser_context& context, std::error_code& ec) override
+        {
+            end_container(false, context, ec);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_key(const string_view_type& name, const ser_context& context, std::error_code& ec) override
+        {
+            if (aborted_)
+            {
+                JSONCONS_VISITOR_RETURN;
+            }
+            if (buffer_level_ > 0)
+            {
+                decoder_.key(name, context, ec);
+                JSONCONS_VISITOR_RETURN;
+            }
+            if (!stack_.empty())
+            {
+                frame& top = stack_.back();
+                top.key.assign(name.data(), name.size());
+                ++top.size;
+                if (!top.shapes.empty())
+                {
+                    top.skeleton.try_emplace(top.key, Json::null());
+                }
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_null(semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (begin_scalar())
+            {
+                decoder_.null_value(tag, context, ec);
+                end_scalar();
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_bool(bool value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (begin_scalar())
+            {
+                decoder_.bool_value(value, tag, context, ec);
+                end_scalar();
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_string(const string_view_type& value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (begin_scalar())
+            {
+                decoder_.string_value(value, tag, context, ec);
+                end_scalar();
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view& value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (begin_scalar())
+            {
+                decoder_.byte_string_value(value, tag, context, ec);
+                end_scalar();
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view& value, uint64_t ext_tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (begin_scalar())
+            {
+                decoder_.byte_string_value(value, ext_tag, context, ec);
+                end_scalar();
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_uint64(uint64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (begin_scalar())
+            {
+                decoder_.uint64_value(value, tag, context, ec);
+                end_scalar();
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_int64(int64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (begin_scalar())
+            {
+                decoder_.int64_value(value, tag, context, ec);
+                end_scalar();
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_half(uint16_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (begin_scalar())
+            {
+                decoder_.half_value(value, tag, context, ec);
+                end_scalar();
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_double(double value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (begin_scalar())
+            {
+                decoder_.double_value(value, tag, context, ec);
+                end_scalar();
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        void begin_container(bool is_object, semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            if (aborted_)
+            {
+                return;
+            }
+            if (buffer_level_ == 0)
+            {
+                pending_value value = next_value();
+                frame f(std::move(value), is_object);
+                if (expand(f))
+                {
+                    if (is_object && !f.shapes.empty())
+                    {
+                        f.skeleton = Json(json_object_arg);
+                    }
+                    stack_.push_back(std::move(f));
+                    return;
+                }
+                // Some keyword needs the whole value
+                buffered_ = std::move(f.value);
+            }
+            ++buffer_level_;
+            if (is_object)
+            {
+                decoder_.begin_object(tag, context, ec);
+            }
+            else
+            {
+                decoder_.begin_array(tag, context, ec);
+            }
+        }
+
+        void end_container(bool is_object, const ser_context& context, std::error_code& ec)
+        {
+            if (aborted_)
+            {
+                return;
+            }
+            if (buffer_level_ > 0)
+            {
+                if (is_object)
+                {
+                    decoder_.end_object(context, ec);
+                }
+                else
+                {
+                    decoder_.end_array(context, ec);
+                }
+                if (--buffer_level_ == 0 && decoder_.is_valid())
+                {
+                    Json instance = decoder_.get_result();
+                    pending_value value = std::move(buffered_);
+                    buffered_ = pending_value{};
+                    complete(value, instance);
+                }
+                return;
+            }
+            if (stack_.empty())
+            {
+                return;
+            }
+            frame f = std::move(stack_.back());
+            stack_.pop_back();
+
+            if (!f.shapes.empty())
+            {
+                if (!f.is_object)
+                {
+                    f.skeleton = Json(json_array_arg);
+                    if (f.count_items)
+                    {
+                        f.skeleton.resize(f.size);
+                    }
+                }
+                evaluation_results results;
+                for (const auto& item : f.shapes)
+                {
+                    if (aborted_)
+                    {
+                        break;
+                    }
+                    check(item.validator->validate(item.context, f.skeleton, f.value.location, results, *item.reporter, patch_));
+                }
+            }
+            resolve_checks(f.value);
+        }
+
+        // Returns true if the scalar should be decoded and validated
+        bool begin_scalar()
+        {
+            if (aborted_)
+            {
+                return false;
+            }
+            if (buffer_level_ > 0)
+            {
+                return true;
+            }
+            buffered_ = next_value();
+            if (buffered_.applicators.empty() && buffered_.checks.empty())
+            {
+                return false;
+            }
+            return true;
+        }
+
+        void end_scalar()
+        {
+            if (buffer_level_ > 0 || !decoder_.is_valid())
+            {
+                return;
+            }
+            Json instance = decoder_.get_result();
+            pending_value value = std::move(buffered_);
+            buffered_ = pending_value{};
+            complete(value, instance);
+        }
+
+        void check(walk_state state)
+        {
+            if (state == walk_state::abort)
+            {
+                aborted_ = true;
+            }
+        }
+
+        void complete(pending_value& value, const Json& instance)
+        {
+            evaluation_results results;
+            for (const auto& item : value.applicators)
+            {
+                if (aborted_)
+                {
+                    return;
+                }
+                check(item.schema->validate(item.context, instance, value.location, results, *item.reporter, patch_));
+            }
+            resolve_checks(value);
+        }
+
+        void resolve_checks(pending_value& value)
+        {
+            for (const auto& item : value.checks)
+            {
+                if (aborted_)
+                {
+                    return;
+                }
+                if (!item->listener.errors.empty())
+                {
+                    std::string message{"Additional property '"};
+                    message.append(item->name);
+                    message.append("' found but was invalid.");
+                    check(item->reporter->error(item->keyword->make_validation_message(
+                        item->eval_path, item->instance_location, message), patch_));
+                }
+            }
+        }
+
+        // The schemas that apply to the value that is about to start
+        pending_value next_value()
+        {
+            pending_value value;
+            if (stack_.empty())
+            {
+                value.applicators.push_back(applicator{schema_->root_.get(), eval_context<Json>{}, reporter_.get()});
+                return value;
+            }
+            frame& parent = stack_.back();
+            if (parent.is_object)
+            {
+                value.location = parent.value.location / parent.key;
+                for (const auto& item : parent.routes)
+                {
+                    route_property(item, parent, value);
+                }
+            }
+            else
+            {
+                std::size_t index = parent.size++;
+                value.location = parent.value.location / index;
+                for (const auto& item : parent.routes)
+                {
+                    route_item(item, index, value);
+                }
+            }
+            return value;
+        }
+
+        bool route_properties(const properties_validator<Json>& keyword, const eval_context<Json>& context,
+            error_reporter<Json>* reporter, const std::string& name, pending_value& value)
+        {
+            auto it = keyword.properties().find(name);
+            if (it == keyword.properties().end())
+            {
+                return false;
+            }
+            eval_context<Json> this_context(context, keyword.keyword());
+            value.applicators.push_back(applicator{(*it).second.get(),
+                eval_context<Json>{this_context, name, evaluation_flags{}}, reporter});
+            return true;
+        }
+
+        bool route_pattern_properties(const pattern_properties_validator<Json>& keyword, const eval_context<Json>& context,
+            error_reporter<Json>* reporter, const std::string& name, pending_value& value)
+        {
+            bool matched = false;
+#if defined(JSONCONS_HAS_STD_REGEX)
+            eval_context<Json> this_context(context, keyword.keyword());
+            for (const auto& item : keyword.pattern_properties())
+            {
+                if (std::regex_search(name, item.first))
+                {
+                    matched = true;
+                    value.applicators.push_back(applicator{item.second.get(),
+                        eval_context<Json>{this_context, name, evaluation_flags{}}, reporter});
+                }
+            }
+#else
+            (void)keyword; (void)context; (void)reporter; (void)name; (void)value;
+#endif
+            return matched;
+        }
+
+        void route_property(const route& item, const frame& parent, pending_value& value)
+        {
+            const std::string& name = parent.key;
+            if (auto properties = dynamic_cast<const properties_validator<Json>*>(item.keyword))
+            {
+                route_properties(*properties, item.context, item.reporter, name, value);
+            }
+            else if (auto pattern_properties = dynamic_cast<const pattern_properties_validator<Json>*>(item.keyword))
+            {
+                route_pattern_properties(*pattern_properties, item.context, item.reporter, name, value);
+            }
+            else if (auto additional = dynamic_cast<const additional_properties_validator<Json>*>(item.keyword))
+            {
+                bool allowed = false;
+                if (additional->properties() != nullptr)
+                {
+                    allowed = route_properties(*additional->properties(), item.context, item.reporter, name, value);
+                }
+                if (additional->pattern_properties() != nullptr)
+                {
+                    allowed = route_pattern_properties(*additional->pattern_properties(), item.context, item.reporter, name, value) || allowed;
+                }
+                const schema_validator<Json>* schema = additional->additional_properties();
+                if (allowed || schema == nullptr || schema->always_succeeds())
+                {
+                    return;
+                }
+                eval_context<Json> this_context(item.context, additional->keyword());
+                eval_context<Json> prop_context{this_context, name, evaluation_flags{}};
+                if (schema->always_fails())
+                {
+                    std::string message{"Additional property '"};
+                    message.append(name);
+                    message.append("' not allowed by schema.");
+                    check(item.reporter->error(additional->make_validation_message(
+                        prop_context.eval_path(), value.location, message), patch_));
+                }
+                else
+                {
+                    auto pending = jsoncons::make_unique<additional_check>(additional, this_context.eval_path(),
+                        parent.value.location, name, item.reporter);
+                    value.applicators.push_back(applicator{schema, std::move(prop_context), std::addressof(pending->listener)});
+                    value.checks.push_back(std::move(pending));
+                }
+            }
+        }
+
+        void route_item(const route& item, std::size_t index, pending_value& value)
+        {
+            if (auto items = dynamic_cast<const items_validator<Json>*>(item.keyword))
+            {
+                const schema_validator<Json>* schema = items->items_schema();
+                if (schema == nullptr || schema->always_succeeds())
+                {
+                    return;
+                }
+                eval_context<Json> this_context(item.context, items->keyword());
+                if (schema->always_fails())
+                {
+                    if (index == 0)
+                    {
+                        check(item.reporter->error(items->make_validation_message(this_context.eval_path(),
+                            value.location, "Item at index '0' but the schema does not allow any items."), patch_));
+                    }
+                }
+                else
+                {
+                    value.applicators.push_back(applicator{schema, std::move(this_context), item.reporter});
+                }
+            }
+            else if (auto prefix_items = dynamic_cast<const prefix_items_validator<Json>*>(item.keyword))
+            {
+                const auto& prefix = prefix_items->prefix_items();
+                if (index < prefix.size())
+                {
+                    eval_context<Json> this_context(item.context, prefix_items->keyword());
+                    value.applicators.push_back(applicator{prefix[index].get(),
+                        eval_context<Json>{this_context, index, evaluation_flags{}}, item.reporter});
+                    return;
+                }
+                const items_keyword<Json>* extra = prefix_items->items();
+                if (extra == nullptr || extra->items_schema() == nullptr || extra->items_schema()->always_succeeds())
+                {
+                    return;
+                }
+                eval_context<Json> this_context(item.context, extra->keyword());
+                if (extra->items_schema()->always_fails())
+                {
+                    if (index == prefix.size())
+                    {
+                        check(item.reporter->error(extra->make_validation_message(this_context.eval_path(), value.location,
+                            "Extra item at index '" + std::to_string(index) + "' but the schema does not allow extra items."), patch_));
+                    }
+                }
+                else
+                {
+                    value.applicators.push_back(applicator{extra->items_schema(), std::move(this_context), item.reporter});
+                }
+            }
+        }
+
+        // Splits the schemas that apply to a container into keywords that route
+        // members to subschemas and keywords that only depend on its keys or size.
+        // Returns false if some keyword needs the whole value.
+        bool expand(frame& f)
+        {
+            for (const auto& item : f.value.applicators)
+            {
+                if (!expand(f, item.schema, item.context, item.reporter, 0))
+                {
+                    f.routes.clear();
+                    f.shapes.clear();
+                    f.count_items = false;
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool expand(frame& f, const schema_validator<Json>* schema, const eval_context<Json>& context,
+            error_reporter<Json>* reporter, int depth)
+        {
+            if (depth > max_ref_depth)
+            {
+                return false;
+            }
+            if (schema->always_succeeds())
+            {
+                return true;
+            }
+            if (auto document = dynamic_cast<const document_schema_validator<Json>*>(schema))
+            {
+                return expand(f, document->root_schema_validator(), context, reporter, depth);
+            }
+            auto object_schema = dynamic_cast<const object_schema_validator<Json>*>(schema);
+            if (object_schema == nullptr)
+            {
+                // false schema, the error does not depend on the content
+                f.shapes.push_back(shape{schema, context, reporter});
+                return true;
+            }
+            if (object_schema->unevaluated_properties_val_ || object_schema->unevaluated_items_val_)
+            {
+                return false;
+            }
+
+            eval_context<Json> this_context{context, object_schema, context.eval_flags()};
+            for (const auto& val : object_schema->validators_)
+            {
+                const keyword_validator<Json>* keyword = val.get();
+                if (auto ref = dynamic_cast<const ref_validator<Json>*>(keyword))
+                {
+                    if (ref->referred_schema() == nullptr ||
+                        !expand(f, ref->referred_schema(), eval_context<Json>(this_context, ref->keyword()), reporter, depth+1))
+                    {
+                        return false;
+                    }
+                }
+                else if (is_route(keyword))
+                {
+                    f.routes.push_back(route{keyword, this_context, reporter});
+                }
+                else if (is_shape(keyword))
+                {
+                    if (dynamic_cast<const max_items_validator<Json>*>(keyword) != nullptr ||
+                        dynamic_cast<const min_items_validator<Json>*>(keyword) != nullptr)
+                    {
+                        f.count_items = true;
+                    }
+                    f.shapes.push_back(shape{keyword, this_context, reporter});
+                }
+                else
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static bool is_route(const keyword_validator<Json>* keyword)
+        {
+            return dynamic_cast<const properties_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const pattern_properties_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const additional_properties_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const items_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const prefix_items_validator<Json>*>(keyword) != nullptr;
+        }
+
+        // Keywords whose result for an object or array depends only on its
+        // keys or size, or that do not apply to objects and arrays
+        static bool is_shape(const keyword_validator<Json>* keyword)
+        {
+            return dynamic_cast<const type_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const required_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const max_properties_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const min_properties_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const dependent_required_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const property_names_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const max_items_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const min_items_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const maximum_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const exclusive_maximum_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const minimum_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const exclusive_minimum_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const multiple_of_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const max_length_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const min_length_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const pattern_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const format_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const content_encoding_validator<Json>*>(keyword) != nullptr ||
+                dynamic_cast<const content_media_type_validator<Json>*>(keyword) != nullptr;
+        }
+    };
+
+} // namespace jsonschema
+} // namespace jsoncons
+
+#endif // JSONCONS_EXT_JSONSCHEMA_STREAMING_VALIDATOR_HPP
@@ -0,0 +1,124 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_EXT_MSGPACK_DECODE_MSGPACK_SEQUENCE_HPP
+#define JSONCONS_EXT_MSGPACK_DECODE_MSGPACK_SEQUENCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits> // std::enable_if
+#include <utility>
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/detail/parallel_decode.hpp>
+#include <jsoncons/detail/span.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/ser_utils.hpp>
+#include <jsoncons/utility/more_type_traits.hpp>
+
+#include <jsoncons_ext/msgpack/msgpack_options.hpp>
+#include <jsoncons_ext/msgpack/msgpack_view.hpp>
+#include <jsoncons_ext/msgpack/decode_msgpack.hpp>
+
+namespace jsoncons { 
+namespace msgpack {
+
+namespace detail {
+
+inline
+read_result<std::vector<jsoncons::span<const uint8_t>>> try_split_msgpack_sequence(const uint8_t* data, std::size_t length)
+{
+    using result_type = read_result<std::vector<jsoncons::span<const uint8_t>>>;
+
+    std::vector<jsoncons::span<const uint8_t>> items;
+    const uint8_t* p = data;
+    const uint8_t* last = data + length;
+    while (p != last)
+    {
+        std::error_code ec;
+        auto item = msgpack_view(p, static_cast<std::size_t>(last - p)).bytes(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            // Report the position of the value that could not be read
+            return result_type{jsoncons::unexpect, ec, 0, static_cast<std::size_t>(p - data)};
+        }
+        items.push_back(item);
+        p += item.size();
+    }
+    return result_type{std::move(items)};
+}
+
+} // namespace detail
+
+// Splits a stream of concatenated MessagePack values into its values by reading their headers,
+// without decoding them
+inline
+std::vector<jsoncons::span<const uint8_t>> split_msgpack_sequence(const uint8_t* data, std::size_t length)
+{
+    auto result = detail::try_split_msgpack_sequence(data, length);
+    if (JSONCONS_UNLIKELY(!result))
+    {
+        JSONCONS_THROW(ser_error(result.error().code(), result.error().column()));
+    }
+    return std::move(*result);
+}
+
+template <typename BytesViewLike>
+typename std::enable_if<ext_traits::is_bytes_view_like<BytesViewLike>::value,std::vector<jsoncons::span<const uint8_t>>>::type
+split_msgpack_sequence(const BytesViewLike& v)
+{
+    return split_msgpack_sequence(reinterpret_cast<const uint8_t*>(v.data()), v.size());
+}
+
+// Decodes the values of a concatenated MessagePack stream on up to num_threads threads (by default,
+// the number of hardware threads), returning them in their original order
+template <typename T,typename BytesViewLike>
+typename std::enable_if<ext_traits::is_bytes_view_like<BytesViewLike>::value,read_result<std::vector<T>>>::type 
+try_decode_msgpack_sequence(const BytesViewLike& v, 
+    const msgpack_decode_options& options = msgpack_decode_options(),
+    std::size_t num_threads = 0)
+{
+    using result_type = read_result<std::vector<T>>;
+
+    const uint8_t* first = reinterpret_cast<const uint8_t*>(v.data());
+    auto items = detail::try_split_msgpack_sequence(first, v.size());
+    if (JSONCONS_UNLIKELY(!items))
+    {
+        return result_type{jsoncons::unexpect, items.error().code(), items.error().line(), items.error().column()};
+    }
+    return jsoncons::detail::parallel_decode<T>(*items, num_threads,
+        [first,&options](const jsoncons::span<const uint8_t>& item) -> read_result<T>
+        {
+            auto result = try_decode_msgpack<T>(item, options);
+            if (JSONCONS_UNLIKELY(!result))
+            {
+                // Report the position of the error in the sequence
+                std::size_t offset = static_cast<std::size_t>(item.data() - first);
+                return read_result<T>{jsoncons::unexpect, result.error().code(), result.error().line(), offset + result.error().column()};
+            }
+            return result;
+        });
+}
+
+template <typename T,typename BytesViewLike>
+typename std::enable_if<ext_traits::is_bytes_view_like<BytesViewLike>::value,std::vector<T>>::type 
+decode_msgpack_sequence(const BytesViewLike& v, 
+    const msgpack_decode_options& options = msgpack_decode_options(),
+    std::size_t num_threads = 0)
+{
+    auto result = try_decode_msgpack_sequence<T>(v, options, num_threads);
+    if (!result)
+    {
+        JSONCONS_THROW(ser_error(result.error().code(), result.error().line(), result.error().column()));
+    }
+    return std::move(*result);
+}
+
+} // namespace msgpack
+} // namespace jsoncons
+
+#endif // JSONCONS_EXT_MSGPACK_DECODE_MSGPACK_SEQUENCE_HPP
@@ -7,6 +7,9 @@
 #ifndef JSONCONS_EXT_MSGPACK_ENCODE_MSGPACK_HPP
 #define JSONCONS_EXT_MSGPACK_ENCODE_MSGPACK_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <ostream> // std::basic_ostream
 #include <system_error> 
 #include <type_traits> 
@@ -14,6 +17,8 @@
 #include <jsoncons/allocator_set.hpp>
 #include <jsoncons/basic_json.hpp>
 #include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/detail/fixed_buffer_visitor.hpp>
+#include <jsoncons/detail/span.hpp>
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_visitor.hpp>
 #include <jsoncons/reflect/encode_traits.hpp>
@@ -22,11 +27,173 @@
 #include <jsoncons/utility/more_type_traits.hpp>
 
 #include <jsoncons_ext/msgpack/msgpack_encoder.hpp>
+#include <jsoncons_ext/msgpack/msgpack_error.hpp>
 #include <jsoncons_ext/msgpack/msgpack_options.hpp>
 
 namespace jsoncons { 
 namespace msgpack {
 
+namespace detail {
+
+inline std::size_t msgpack_uint_size(uint64_t value)
+{
+    return value <= 0x7f ? 1 : value <= 0xff ? 2 : value <= 0xffff ? 3 : value <= 0xffffffff ? 5 : 9;
+}
+
+inline std::size_t msgpack_int_size(int64_t value)
+{
+    if (value >= 0)
+    {
+        return msgpack_uint_size(static_cast<uint64_t>(value));
+    }
+    return value >= -32 ? 1 : value >= (std::numeric_limits<int8_t>::lowest)() ? 2 : 
+        value >= (std::numeric_limits<int16_t>::lowest)() ? 3 : value >= (std::numeric_limits<int32_t>::lowest)() ? 5 : 9;
+}
+
+// Adds the length of the encoding of j to length, computed from the structure of j.
+// Returns false if j has semantic tags other than noesc, or half precision values, or would exceed
+// max_nesting_depth, leaving the length to be found by encoding j.
+template <typename Json>
+bool add_structural_msgpack_size(const Json& j, const msgpack_encode_options& options, int depth, std::size_t& length)
+{
+    if (j.tag() != semantic_tag::none && j.tag() != semantic_tag::noesc)
+    {
+        return false;
+    }
+    switch (j.type())
+    {
+        case json_type::null:
+        case json_type::boolean:
+            length += 1;
+            return true;
+        case json_type::int64:
+            length += msgpack_int_size(j.template as<int64_t>());
+            return true;
+        case json_type::uint64:
+            length += msgpack_uint_size(j.template as<uint64_t>());
+            return true;
+        case json_type::float64:
+        {
+            double val = j.as_double();
+            length += (double)(float)val == val ? 5 : 9;
+            return true;
+        }
+        case json_type::string:
+        {
+            auto sv = j.as_string_view();
+            length += (sv.size() <= 31 ? 1 : sv.size() <= 0xff ? 2 : sv.size() <= 0xffff ? 3 : 5) + sv.size();
+            return true;
+        }
+        case json_type::byte_string:
+        {
+            auto bytes = j.as_byte_string_view();
+            length += (bytes.size() <= 0xff ? 2 : bytes.size() <= 0xffff ? 3 : 5) + bytes.size();
+            return true;
+        }
+        case json_type::array:
+            if (depth >= options.max_nesting_depth())
+            {
+                return false;
+            }
+            length += j.size() <= 15 ? 1 : j.size() <= 0xffff ? 3 : 5;
+            for (const auto& item : j.array_range())
+            {
+                if (!add_structural_msgpack_size(item, options, depth+1, length))
+                {
+                    return false;
+                }
+            }
+            return true;
+        case json_type::object:
+            if (depth >= options.max_nesting_depth())
+            {
+                return false;
+            }
+            length += j.size() <= 15 ? 1 : j.size() <= 0xffff ? 3 : 5;
+            for (const auto& member : j.object_range())
+            {
+                const auto& key = member.key();
+                length += (key.size() <= 31 ? 1 : key.size() <= 0xff ? 2 : key.size() <= 0xffff ? 3 : 5) + key.size();
+                if (!add_structural_msgpack_size(member.value(), options, depth+1, length))
+                {
+                    return false;
+                }
+            }
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Computes the encoded length of a basic_json without encoding it, if it is a
+// char based value with no semantic tags other than noesc and no registered extension encoders
+template <typename T>
+typename std::enable_if<ext_traits::is_basic_json<T>::value,bool>::type 
+structural_msgpack_size(const T& j, const msgpack_encode_options& options, std::size_t& length)
+{
+    if (!std::is_same<typename T::char_type,char>::value || options.ext_registry().has_encoders())
+    {
+        return false;
+    }
+    std::size_t n = 0;
+    if (!add_structural_msgpack_size(j, options, 0, n))
+    {
+        return false;
+    }
+    length = n;
+    return true;
+}
+
+template <typename T>
+typename std::enable_if<!ext_traits::is_basic_json<T>::value,bool>::type 
+structural_msgpack_size(const T&, const msgpack_encode_options&, std::size_t&)
+{
+    return false;
+}
+
+template <typename T,typename Sink>
+typename std::enable_if<ext_traits::is_basic_json<T>::value,write_result>::type 
+try_encode_msgpack_to_sink(const T& j, Sink&& sink, const msgpack_encode_options& options)
+{
+    using char_type = typename T::char_type;
+    basic_msgpack_encoder<Sink> encoder(std::forward<Sink>(sink), options);
+    auto adaptor = make_json_visitor_adaptor<basic_json_visitor<char_type>>(encoder);
+    return j.try_dump(adaptor);
+}
+
+template <typename T,typename Sink>
+typename std::enable_if<!ext_traits::is_basic_json<T>::value,write_result>::type 
+try_encode_msgpack_to_sink(const T& val, Sink&& sink, const msgpack_encode_options& options)
+{
+    basic_msgpack_encoder<Sink> encoder(std::forward<Sink>(sink), options);
+    return reflect::encode_traits<T>::try_encode(make_alloc_set(), val, encoder);
+}
+
+// Encodes into buffer, stopping at the first event that overflows it
+template <typename T>
+typename std::enable_if<ext_traits::is_basic_json<T>::value,write_result>::type 
+try_encode_msgpack_to_buffer(const T& j, jsoncons::span<uint8_t> buffer, std::size_t& length, 
+    const msgpack_encode_options& options)
+{
+    using char_type = typename T::char_type;
+    basic_msgpack_encoder<fixed_bytes_sink> encoder(fixed_bytes_sink(buffer.data(), buffer.size(), length), options);
+    jsoncons::detail::fixed_buffer_visitor<char> visitor(encoder, length, buffer.size(), msgpack_errc::buffer_too_small);
+    auto adaptor = make_json_visitor_adaptor<basic_json_visitor<char_type>>(visitor);
+    return j.try_dump(adaptor);
+}
+
+template <typename T>
+typename std::enable_if<!ext_traits::is_basic_json<T>::value,write_result>::type 
+try_encode_msgpack_to_buffer(const T& val, jsoncons::span<uint8_t> buffer, std::size_t& length, 
+    const msgpack_encode_options& options)
+{
+    basic_msgpack_encoder<fixed_bytes_sink> encoder(fixed_bytes_sink(buffer.data(), buffer.size(), length), options);
+    jsoncons::detail::fixed_buffer_visitor<char> visitor(encoder, length, buffer.size(), msgpack_errc::buffer_too_small);
+    return reflect::encode_traits<T>::try_encode(make_alloc_set(), val, visitor);
+}
+
+} // namespace detail
+
     template <typename T,typename BytesLike>
     typename std::enable_if<ext_traits::is_basic_json<T>::value &&
     ext_traits::is_back_insertable_byte_container<BytesLike>::value,write_result>::type 
@@ -35,6 +202,11 @@ namespace msgpack {
         const msgpack_encode_options& options = msgpack_encode_options())
     {
         using char_type = typename T::char_type;
+        std::size_t length = 0;
+        if (detail::structural_msgpack_size(j, options, length))
+        {
+            jsoncons::detail::reserve_if_empty(cont, length);
+        }
         basic_msgpack_encoder<jsoncons::bytes_sink<BytesLike>> encoder(cont, options);
         auto adaptor = make_json_visitor_adaptor<basic_json_visitor<char_type>>(encoder);
         return j.try_dump(adaptor);
@@ -83,6 +255,11 @@ namespace msgpack {
         const msgpack_encode_options& options = msgpack_encode_options())
     {
         using char_type = typename T::char_type;
+        std::size_t length = 0;
+        if (detail::structural_msgpack_size(j, options, length))
+        {
+            jsoncons::detail::reserve_if_empty(cont, length);
+        }
         basic_msgpack_encoder<jsoncons::bytes_sink<BytesLike>,TempAlloc> encoder(cont, options, aset.get_temp_allocator());
         auto adaptor = make_json_visitor_adaptor<basic_json_visitor<char_type>>(encoder);
         return j.try_dump(adaptor);
@@ -123,6 +300,59 @@ namespace msgpack {
         return reflect::encode_traits<T>::try_encode(aset, val, encoder);
     }
 
+// exact size and fixed buffers
+
+// Returns the exact length of the encoding of val, without storing it
+template <typename T>
+jsoncons::expected<std::size_t,std::error_code> try_encoded_msgpack_size(const T& val, 
+    const msgpack_encode_options& options = msgpack_encode_options())
+{
+    using result_type = jsoncons::expected<std::size_t,std::error_code>;
+
+    std::size_t length = 0;
+    if (detail::structural_msgpack_size(val, options, length))
+    {
+        return result_type{length};
+    }
+    auto r = detail::try_encode_msgpack_to_sink(val, counting_sink(length), options);
+    if (JSONCONS_UNLIKELY(!r))
+    {
+        return result_type{jsoncons::unexpect, r.error()};
+    }
+    return result_type{length};
+}
+
+// Encodes val into buffer without growing it, returning the encoded length
+template <typename T>
+jsoncons::expected<std::size_t,std::error_code> try_encode_msgpack_to_buffer(const T& val, 
+    jsoncons::span<uint8_t> buffer,
+    const msgpack_encode_options& options = msgpack_encode_options())
+{
+    using result_type = jsoncons::expected<std::size_t,std::error_code>;
+
+    std::size_t length = 0;
+    if (detail::structural_msgpack_size(val, options, length))
+    {
+        if (JSONCONS_UNLIKELY(length > buffer.size()))
+        {
+            return result_type{jsoncons::unexpect, msgpack_errc::buffer_too_small};
+        }
+        length = 0;
+        auto r = detail::try_encode_msgpack_to_sink(val, fixed_bytes_sink(buffer.data(), buffer.size(), length), options);
+        if (JSONCONS_UNLIKELY(!r))
+        {
+            return result_type{jsoncons::unexpect, r.error()};
+        }
+        return result_type{length};
+    }
+    auto r = detail::try_encode_msgpack_to_buffer(val, buffer, length, options);
+    if (JSONCONS_UNLIKELY(!r))
+    {
+        return result_type{jsoncons::unexpect, r.error()};
+    }
+    return result_type{length};
+}
+
 template <typename... Args>
 void encode_msgpack(Args&& ... args)
 {
@@ -133,6 +363,28 @@ void encode_msgpack(Args&& ... args)
     }
 }
 
+template <typename... Args>
+std::size_t encoded_msgpack_size(Args&& ... args)
+{
+    auto r = try_encoded_msgpack_size(std::forward<Args>(args)...); 
+    if (!r)
+    {
+        JSONCONS_THROW(ser_error(r.error()));
+    }
+    return *r;
+}
+
+template <typename... Args>
+std::size_t encode_msgpack_to_buffer(Args&& ... args)
+{
+    auto r = try_encode_msgpack_to_buffer(std::forward<Args>(args)...); 
+    if (!r)
+    {
+        JSONCONS_THROW(ser_error(r.error()));
+    }
+    return *r;
+}
+
 } // namespace msgpack
 } // namespace jsoncons
 
@@ -12,6 +12,7 @@
 #include <jsoncons_ext/msgpack/msgpack_cursor.hpp>
 #include <jsoncons_ext/msgpack/msgpack_encoder.hpp>
 #include <jsoncons_ext/msgpack/msgpack_reader.hpp>
+#include <jsoncons_ext/msgpack/msgpack_view.hpp>
 
 #endif // JSONCONS_EXT_MSGPACK_MSGPACK_HPP
 
@@ -11,6 +11,7 @@
 #include <functional>
 #include <memory> // std::allocator
 #include <system_error>
+#include <vector>
 
 #include <jsoncons/config/compiler_support.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
@@ -214,6 +215,29 @@ public:
         read_next(ec);
     }
 
+    void skip() final
+    {
+        std::error_code ec;
+        skip(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    void skip(std::error_code& ec) final
+    {
+        if (is_begin_container(current().event_type()))
+        {
+            parser_.skip_container(ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+            read_next(ec);
+        }
+    }
+
     const ser_context& context() const final
     {
         return *this;
@@ -298,8 +322,426 @@ private:
     }
 };
 
+namespace detail {
+
+// Finds the end of the first complete item in a buffer that may be cut off anywhere.
+// Scanning resumes where the previous call stopped, so feeding an item in pieces costs 
+// time proportional to its size.
+class msgpack_item_scanner
+{
+    int max_nesting_depth_;
+    std::size_t offset_{0};
+    std::vector<uint64_t> counts_; // items remaining in each open container
+
+public:
+    explicit msgpack_item_scanner(int max_nesting_depth)
+        : max_nesting_depth_(max_nesting_depth)
+    {
+    }
+
+    void reset()
+    {
+        offset_ = 0;
+        counts_.clear();
+    }
+
+    // Returns the size of the item that starts at data, or 0 if more bytes are needed.
+    // Malformed input is left for the parser to report.
+    std::size_t scan(const uint8_t* data, std::size_t length, std::error_code& ec)
+    {
+        while (offset_ < length)
+        {
+            const uint8_t* p = data + offset_;
+            std::size_t available = length - offset_;
+            uint8_t type = *p;
+
+            std::size_t head = 1;     // type byte and fixed size fields
+            std::size_t size_len = 0; // length of the size field that follows the type byte
+            uint64_t count = 0;       // nested items
+            bool payload = false;     // the size field counts payload bytes
+            if (type <= 0x7f || type >= 0xe0)
+            {
+            }
+            else if (type <= 0x8f)
+            {
+                count = 2*static_cast<uint64_t>(type & 0x0f);
+            }
+            else if (type <= 0x9f)
+            {
+                count = type & 0x0f;
+            }
+            else if (type <= 0xbf)
+            {
+                head += type & 0x1f;
+            }
+            else
+            {
+                switch (type)
+                {
+                    case msgpack_type::uint8_type: 
+                    case msgpack_type::int8_type: 
+                        head += 1;
+                        break;
+                    case msgpack_type::uint16_type: 
+                    case msgpack_type::int16_type: 
+                        head += 2;
+                        break;
+                    case msgpack_type::uint32_type: 
+                    case msgpack_type::int32_type: 
+                    case msgpack_type::float32_type: 
+                        head += 4;
+                        break;
+                    case msgpack_type::uint64_type: 
+                    case msgpack_type::int64_type: 
+                    case msgpack_type::float64_type: 
+                        head += 8;
+                        break;
+                    case msgpack_type::fixext1_type: 
+                        head += 2;
+                        break;
+                    case msgpack_type::fixext2_type: 
+                        head += 3;
+                        break;
+                    case msgpack_type::fixext4_type: 
+                        head += 5;
+                        break;
+                    case msgpack_type::fixext8_type: 
+                        head += 9;
+                        break;
+                    case msgpack_type::fixext16_type: 
+                        head += 17;
+                        break;
+                    case msgpack_type::str8_type: 
+                    case msgpack_type::bin8_type: 
+                        size_len = 1;
+                        payload = true;
+                        break;
+                    case msgpack_type::str16_type: 
+                    case msgpack_type::bin16_type: 
+                        size_len = 2;
+                        payload = true;
+                        break;
+                    case msgpack_type::str32_type: 
+                    case msgpack_type::bin32_type: 
+                        size_len = 4;
+                        payload = true;
+                        break;
+                    case msgpack_type::ext8_type: 
+                        size_len = 1;
+                        payload = true;
+                        head += 1; // ext type
+                        break;
+                    case msgpack_type::ext16_type: 
+                        size_len = 2;
+                        payload = true;
+                        head += 1;
+                        break;
+                    case msgpack_type::ext32_type: 
+                        size_len = 4;
+                        payload = true;
+                        head += 1;
+                        break;
+                    case msgpack_type::array16_type: 
+                    case msgpack_type::map16_type: 
+                        size_len = 2;
+                        break;
+                    case msgpack_type::array32_type: 
+                    case msgpack_type::map32_type: 
+                        size_len = 4;
+                        break;
+                    default:
+                        break; // nil, false, true, or unknown
+                }
+            }
+            if (size_len > 0)
+            {
+                if (available < 1 + size_len)
+                {
+                    return 0;
+                }
+                uint64_t size;
+                switch (size_len)
+                {
+                    case 1:
+                        size = p[1];
+                        break;
+                    case 2:
+                        size = binary::big_to_native<uint16_t>(p+1, 2);
+                        break;
+                    default:
+                        size = binary::big_to_native<uint32_t>(p+1, 4);
+                        break;
+                }
+                head += size_len;
+                if (available < head)
+                {
+                    return 0;
+                }
+                if (payload)
+                {
+                    if (size > available - head)
+                    {
+                        return 0;
+                    }
+                    head += static_cast<std::size_t>(size);
+                }
+                else
+                {
+                    count = (type == msgpack_type::map16_type || type == msgpack_type::map32_type) ? 2*size : size;
+                }
+            }
+            if (available < head)
+            {
+                return 0;
+            }
+            offset_ += head;
+            if (count > 0)
+            {
+                if (JSONCONS_UNLIKELY(static_cast<int>(counts_.size()) >= max_nesting_depth_))
+                {
+                    ec = msgpack_errc::max_nesting_depth_exceeded;
+                    return 0;
+                }
+                counts_.push_back(count);
+                continue;
+            }
+            if (end_item())
+            {
+                std::size_t size = offset_;
+                offset_ = 0;
+                return size;
+            }
+        }
+        return 0;
+    }
+
+private:
+    bool end_item()
+    {
+        while (!counts_.empty())
+        {
+            if (--counts_.back() > 0)
+            {
+                return false;
+            }
+            counts_.pop_back();
+        }
+        return true;
+    }
+};
+
+} // namespace detail
+
+// A cursor that is fed input with update rather than pulling it from a source.
+// The events of a top level item (e.g. one message of a stream) are reported once
+// all of its bytes have arrived, until then next() returns with need_more_input() true.
+template <typename Allocator=std::allocator<char>>
+class basic_msgpack_push_cursor : public basic_staj_cursor<char>, private virtual ser_context
+{
+public:
+    using char_type = char;
+    using allocator_type = Allocator;
+    using string_view_type = string_view;
+private:
+    using byte_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<uint8_t>;
+    using cursor_type = basic_msgpack_cursor<jsoncons::bytes_source,Allocator>;
+
+    msgpack_decode_options options_;
+    allocator_type alloc_;
+    detail::msgpack_item_scanner scanner_;
+    std::vector<uint8_t,byte_allocator_type> input_;
+    std::size_t input_pos_{0};
+    std::vector<uint8_t,byte_allocator_type> item_;
+    std::size_t item_position_{0};
+    std::unique_ptr<cursor_type> cursor_;
+    basic_staj_event<char_type> empty_event_{staj_events::null_value};
+    bool loaded_{false};
+    bool need_more_input_{true};
+
+public:
+    basic_msgpack_push_cursor(const msgpack_decode_options& options = msgpack_decode_options(),
+        const Allocator& alloc = Allocator())
+        : options_(options), alloc_(alloc), scanner_(options.max_nesting_depth()), 
+          input_(alloc), item_(alloc)
+    {
+    }
+
+    basic_msgpack_push_cursor(const basic_msgpack_push_cursor&) = delete;
+    basic_msgpack_push_cursor(basic_msgpack_push_cursor&&) = default;
+
+    ~basic_msgpack_push_cursor() = default;
+
+    basic_msgpack_push_cursor& operator=(const basic_msgpack_push_cursor&) = delete;
+    basic_msgpack_push_cursor& operator=(basic_msgpack_push_cursor&&) = default;
+
+    // Appends input. The bytes are copied, so the caller may reuse its buffer 
+    // as soon as update returns.
+    void update(const uint8_t* data, std::size_t length)
+    {
+        if (input_pos_ > 0)
+        {
+            input_.erase(input_.begin(), input_.begin() + input_pos_);
+            input_pos_ = 0;
+        }
+        input_.insert(input_.end(), data, data + length);
+    }
+
+    bool need_more_input() const
+    {
+        return need_more_input_;
+    }
+
+    // Moves on to the next top level item
+    void reset()
+    {
+        std::error_code ec;
+        reset(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,line(),column()));
+        }
+    }
+
+    void reset(std::error_code& ec)
+    {
+        loaded_ = false;
+        load_item(ec);
+    }
+
+    bool done() const final
+    {
+        return loaded_ && cursor_->done();
+    }
+
+    const staj_event& current() const final
+    {
+        return cursor_ ? cursor_->current() : empty_event_;
+    }
+
+    void read_to(basic_json_visitor<char_type>& visitor) final
+    {
+        std::error_code ec;
+        read_to(visitor, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,line(),column()));
+        }
+    }
+
+    void read_to(basic_json_visitor<char_type>& visitor,
+        std::error_code& ec) final
+    {
+        if (loaded_)
+        {
+            cursor_->read_to(visitor, ec);
+        }
+    }
+
+    void next() final
+    {
+        std::error_code ec;
+        next(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,line(),column()));
+        }
+    }
+
+    void next(std::error_code& ec) final
+    {
+        if (loaded_)
+        {
+            cursor_->next(ec);
+        }
+        else
+        {
+            load_item(ec);
+        }
+    }
+
+    void skip() final
+    {
+        std::error_code ec;
+        skip(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,line(),column()));
+        }
+    }
+
+    void skip(std::error_code& ec) final
+    {
+        if (loaded_)
+        {
+            cursor_->skip(ec);
+        }
+    }
+
+    const ser_context& context() const final
+    {
+        return *this;
+    }
+
+    std::size_t line() const final
+    {
+        return 0;
+    }
+
+    std::size_t column() const final
+    {
+        return loaded_ ? item_position_ + cursor_->column() : item_position_ + item_.size();
+    }
+
+    friend
+    staj_filter_view operator|(basic_msgpack_push_cursor& cursor, 
+        std::function<bool(const staj_event&, const ser_context&)> pred)
+    {
+        return staj_filter_view(cursor, pred);
+    }
+
+private:
+
+    void load_item(std::error_code& ec)
+    {
+        std::size_t length = scanner_.scan(input_.data() + input_pos_, input_.size() - input_pos_, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            return;
+        }
+        if (length == 0)
+        {
+            need_more_input_ = true;
+            return;
+        }
+        need_more_input_ = false;
+
+        item_position_ += item_.size();
+        if (input_pos_ == 0 && length == input_.size())
+        {
+            item_.swap(input_);
+            input_.clear();
+        }
+        else
+        {
+            item_.assign(input_.begin() + input_pos_, input_.begin() + (input_pos_ + length));
+            input_pos_ += length;
+        }
+
+        if (!cursor_)
+        {
+            cursor_ = std::unique_ptr<cursor_type>(new cursor_type(std::allocator_arg, alloc_, item_, options_, ec));
+        }
+        else
+        {
+            cursor_->reset(item_, ec);
+        }
+        loaded_ = true;
+    }
+};
+
 using msgpack_stream_cursor = basic_msgpack_cursor<jsoncons::binary_stream_source>;
 using msgpack_bytes_cursor = basic_msgpack_cursor<jsoncons::bytes_source>;
+using msgpack_push_cursor = basic_msgpack_push_cursor<>;
 
 } // namespace msgpack
 } // namespace jsoncons
@@ -83,7 +83,9 @@ namespace msgpack {
 
         Sink sink_;
         int max_nesting_depth_;
+        msgpack_ext_registry ext_registry_;
         allocator_type alloc_;
+        std::vector<uint8_t> ext_buffer_;
 
         std::vector<stack_item> stack_;
         int nesting_depth_{0};
@@ -103,6 +105,7 @@ namespace msgpack {
             const Allocator& alloc = Allocator())
            : sink_(std::forward<Sink>(sink)),
              max_nesting_depth_(options.max_nesting_depth()),
+             ext_registry_(options.ext_registry()),
              alloc_(alloc)
         {
         }
@@ -369,6 +372,12 @@ namespace msgpack {
                 }
                 default:
                 {
+                    if (ext_registry_.has_encoders() && 
+                        write_registered_ext(byte_string_view(reinterpret_cast<const uint8_t*>(sv.data()), sv.size()), tag))
+                    {
+                        end_value();
+                        break;
+                    }
                     write_string_value(sv);
                     end_value();
                     break;
@@ -417,10 +426,15 @@ namespace msgpack {
         }
 
         JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view& b, 
-            semantic_tag, 
+            semantic_tag tag, 
             const ser_context&,
             std::error_code&) final
         {
+            if (ext_registry_.has_encoders() && write_registered_ext(b, tag))
+            {
+                end_value();
+                JSONCONS_VISITOR_RETURN;
+            }
 
             const std::size_t length = b.size();
             if (length <= (std::numeric_limits<uint8_t>::max)())
@@ -455,48 +469,72 @@ namespace msgpack {
             uint64_t ext_tag, 
             const ser_context&,
             std::error_code&) final
+        {
+            write_ext(static_cast<uint8_t>(ext_tag), b);
+            end_value();
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        bool write_registered_ext(const byte_string_view& value, semantic_tag tag)
+        {
+            int8_t ext_type = 0;
+            const msgpack_ext_encoder* encoder = ext_registry_.find_encoder(tag, ext_type);
+            if (encoder == nullptr)
+            {
+                return false;
+            }
+            ext_buffer_.clear();
+            if (!(*encoder)(value, ext_buffer_))
+            {
+                return false;
+            }
+            write_ext(static_cast<uint8_t>(ext_type), byte_string_view(ext_buffer_.data(), ext_buffer_.size()));
+            return true;
+        }
+
+        void write_ext(uint8_t ext_tag, const byte_string_view& b)
         {
             const std::size_t length = b.size();
             switch (length)
             {
                 case 1:
                     sink_.push_back(jsoncons::msgpack::msgpack_type::fixext1_type);
-                    sink_.push_back(static_cast<uint8_t>(ext_tag));
+                    sink_.push_back(ext_tag);
                     break;
                 case 2:
                     sink_.push_back(jsoncons::msgpack::msgpack_type::fixext2_type);
-                    sink_.push_back(static_cast<uint8_t>(ext_tag));
+                    sink_.push_back(ext_tag);
                     break;
                 case 4:
                     sink_.push_back(jsoncons::msgpack::msgpack_type::fixext4_type);
-                    sink_.push_back(static_cast<uint8_t>(ext_tag));
+                    sink_.push_back(ext_tag);
                     break;
                 case 8:
                     sink_.push_back(jsoncons::msgpack::msgpack_type::fixext8_type);
-                    sink_.push_back(static_cast<uint8_t>(ext_tag));
+                    sink_.push_back(ext_tag);
                     break;
                 case 16:
                     sink_.push_back(jsoncons::msgpack::msgpack_type::fixext16_type);
-                    sink_.push_back(static_cast<uint8_t>(ext_tag));
+                    sink_.push_back(ext_tag);
                     break;
                 default:
                     if (length <= (std::numeric_limits<uint8_t>::max)())
                     {
                         sink_.push_back(jsoncons::msgpack::msgpack_type::ext8_type);
                         sink_.push_back(static_cast<uint8_t>(length));
-                        sink_.push_back(static_cast<uint8_t>(ext_tag));
+                        sink_.push_back(ext_tag);
                     }
                     else if (length <= (std::numeric_limits<uint16_t>::max)())
                     {
                         sink_.push_back(jsoncons::msgpack::msgpack_type::ext16_type);
                         binary::native_to_big(static_cast<uint16_t>(length), std::back_inserter(sink_));
-                        sink_.push_back(static_cast<uint8_t>(ext_tag));
+                        sink_.push_back(ext_tag);
                     }
                     else if (length <= (std::numeric_limits<uint32_t>::max)())
                     {
                         sink_.push_back(jsoncons::msgpack::msgpack_type::ext32_type);
                         binary::native_to_big(static_cast<uint32_t>(length),std::back_inserter(sink_));
-                        sink_.push_back(static_cast<uint8_t>(ext_tag));
+                        sink_.push_back(ext_tag);
                     }
                     break;
             }
@@ -505,9 +543,6 @@ namespace msgpack {
             {
                 sink_.push_back(c);
             }
-
-            end_value();
-            JSONCONS_VISITOR_RETURN;
         }
 
         JSONCONS_VISITOR_RETURN_TYPE visit_double(double val, 
@@ -27,7 +27,9 @@ enum class msgpack_errc
     max_nesting_depth_exceeded,
     length_is_negative,
     invalid_timestamp,
-    unknown_type
+    unknown_type,
+    buffer_too_small,
+    invalid_ext_value
 };
 
 class msgpack_error_category_impl
@@ -64,6 +66,10 @@ public:
                 return "Invalid timestamp";
             case msgpack_errc::unknown_type:
                 return "An unknown type was found in the stream";
+            case msgpack_errc::buffer_too_small:
+                return "Encoded data exceeds the size of the output buffer";
+            case msgpack_errc::invalid_ext_value:
+                return "An ext decoder must report exactly one scalar value";
             default:
                 return "Unknown MessagePack parser error";
         }
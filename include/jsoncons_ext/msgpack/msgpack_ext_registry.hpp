@@ -0,0 +1,264 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_EXT_MSGPACK_MSGPACK_EXT_REGISTRY_HPP
+#define JSONCONS_EXT_MSGPACK_MSGPACK_EXT_REGISTRY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory> // std::addressof
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/item_event_visitor.hpp>
+#include <jsoncons/semantic_tag.hpp>
+#include <jsoncons/ser_utils.hpp>
+#include <jsoncons/utility/byte_string.hpp>
+
+#include <jsoncons_ext/msgpack/msgpack_error.hpp>
+
+namespace jsoncons {
+namespace msgpack {
+
+// Reports the value of an ext payload to the visitor. The payload is only valid for the
+// duration of the call.
+using msgpack_ext_decoder = std::function<void(const byte_string_view& payload,
+    item_event_visitor& visitor, const ser_context& context, std::error_code& ec)>;
+
+// Writes the ext payload for a text or byte string value, passed as its bytes, returning
+// false to have the value encoded as usual.
+using msgpack_ext_encoder = std::function<bool(const byte_string_view& value,
+    std::vector<uint8_t>& payload)>;
+
+// Handlers for application defined MessagePack extension types
+class msgpack_ext_registry
+{
+    struct encoder_entry
+    {
+        int8_t ext_type;
+        semantic_tag tag;
+        msgpack_ext_encoder encode;
+    };
+
+    std::vector<std::pair<int8_t,msgpack_ext_decoder>> decoders_;
+    std::vector<encoder_entry> encoders_;
+public:
+    // Ext values of type ext_type are reported through decoder rather than as a byte string
+    msgpack_ext_registry& register_decoder(int8_t ext_type, msgpack_ext_decoder decoder)
+    {
+        for (auto& item : decoders_)
+        {
+            if (item.first == ext_type)
+            {
+                item.second = std::move(decoder);
+                return *this;
+            }
+        }
+        decoders_.emplace_back(ext_type, std::move(decoder));
+        return *this;
+    }
+
+    // Text and byte string values with semantic tag tag are encoded as ext values of type ext_type
+    msgpack_ext_registry& register_encoder(int8_t ext_type, semantic_tag tag, msgpack_ext_encoder encoder)
+    {
+        for (auto& item : encoders_)
+        {
+            if (item.ext_type == ext_type)
+            {
+                item.tag = tag;
+                item.encode = std::move(encoder);
+                return *this;
+            }
+        }
+        encoders_.push_back(encoder_entry{ext_type, tag, std::move(encoder)});
+        return *this;
+    }
+
+    bool has_decoders() const noexcept
+    {
+        return !decoders_.empty();
+    }
+
+    bool has_encoders() const noexcept
+    {
+        return !encoders_.empty();
+    }
+
+    const msgpack_ext_decoder* find_decoder(int8_t ext_type) const
+    {
+        for (const auto& item : decoders_)
+        {
+            if (item.first == ext_type)
+            {
+                return &item.second;
+            }
+        }
+        return nullptr;
+    }
+
+    const msgpack_ext_encoder* find_encoder(semantic_tag tag, int8_t& ext_type) const
+    {
+        for (const auto& item : encoders_)
+        {
+            if (item.tag == tag)
+            {
+                ext_type = item.ext_type;
+                return &item.encode;
+            }
+        }
+        return nullptr;
+    }
+};
+
+namespace detail {
+
+    // Forwards the value reported by an ext decoder, setting msgpack_errc::invalid_ext_value
+    // if the decoder reports a container or more than one value
+    class msgpack_ext_value_visitor final : public item_event_visitor
+    {
+        item_event_visitor* destination_;
+        std::size_t count_{0};
+    public:
+        explicit msgpack_ext_value_visitor(item_event_visitor& destination)
+            : destination_(std::addressof(destination))
+        {
+        }
+
+        std::size_t count() const
+        {
+            return count_;
+        }
+
+    private:
+        bool accept(std::error_code& ec)
+        {
+            if (JSONCONS_UNLIKELY(++count_ > 1))
+            {
+                ec = msgpack_errc::invalid_ext_value;
+                return false;
+            }
+            return true;
+        }
+
+        void visit_flush() override
+        {
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_object(semantic_tag, const ser_context&, std::error_code& ec) override
+        {
+            ec = msgpack_errc::invalid_ext_value;
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_end_object(const ser_context&, std::error_code& ec) override
+        {
+            ec = msgpack_errc::invalid_ext_value;
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_array(semantic_tag, const ser_context&, std::error_code& ec) override
+        {
+            ec = msgpack_errc::invalid_ext_value;
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_end_array(const ser_context&, std::error_code& ec) override
+        {
+            ec = msgpack_errc::invalid_ext_value;
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_null(semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (accept(ec))
+            {
+                destination_->null_value(tag, context, ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_bool(bool value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (accept(ec))
+            {
+                destination_->bool_value(value, tag, context, ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_string(const string_view_type& value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (accept(ec))
+            {
+                destination_->string_value(value, tag, context, ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view& value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (accept(ec))
+            {
+                destination_->byte_string_value(value, tag, context, ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view& value, uint64_t ext_tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (accept(ec))
+            {
+                destination_->byte_string_value(value, ext_tag, context, ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_uint64(uint64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (accept(ec))
+            {
+                destination_->uint64_value(value, tag, context, ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_int64(int64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (accept(ec))
+            {
+                destination_->int64_value(value, tag, context, ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_half(uint16_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (accept(ec))
+            {
+                destination_->half_value(value, tag, context, ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_double(double value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            if (accept(ec))
+            {
+                destination_->double_value(value, tag, context, ec);
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+    };
+
+} // namespace detail
+
+} // namespace msgpack
+} // namespace jsoncons
+
+#endif // JSONCONS_EXT_MSGPACK_MSGPACK_EXT_REGISTRY_HPP
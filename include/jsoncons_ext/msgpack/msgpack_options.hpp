@@ -9,6 +9,8 @@
 
 #include <cwchar>
 
+#include <jsoncons_ext/msgpack/msgpack_ext_registry.hpp>
+
 namespace jsoncons { 
 namespace msgpack {
 
@@ -19,6 +21,7 @@ class msgpack_options_common
     friend class msgpack_options;
 
     int max_nesting_depth_{1024};
+    msgpack_ext_registry ext_registry_;
 protected:
     msgpack_options_common() = default;
     msgpack_options_common(const msgpack_options_common&) = default;
@@ -31,6 +34,11 @@ public:
     {
         return max_nesting_depth_;
     }
+
+    const msgpack_ext_registry& ext_registry() const 
+    {
+        return ext_registry_;
+    }
 };
 
 class msgpack_decode_options : public virtual msgpack_options_common
@@ -57,6 +65,7 @@ class msgpack_options final : public msgpack_decode_options, public msgpack_enco
 {
 public:
     using msgpack_options_common::max_nesting_depth;
+    using msgpack_options_common::ext_registry;
 
     msgpack_options() = default;
     msgpack_options(const msgpack_options& other) = default;
@@ -67,6 +76,12 @@ public:
         this->max_nesting_depth_ = value;
         return *this;
     }
+
+    msgpack_options& ext_registry(const msgpack_ext_registry& value)
+    {
+        this->ext_registry_ = value;
+        return *this;
+    }
 };
 
 } // namespace msgpack
@@ -28,6 +28,7 @@
 #include <jsoncons/utility/unicode_traits.hpp>
 
 #include <jsoncons_ext/msgpack/msgpack_error.hpp>
+#include <jsoncons_ext/msgpack/msgpack_ext_registry.hpp>
 #include <jsoncons_ext/msgpack/msgpack_options.hpp>
 #include <jsoncons_ext/msgpack/msgpack_type.hpp>
 
@@ -74,6 +75,7 @@ class basic_msgpack_parser : public ser_context
 
     Source source_;
     int max_nesting_depth_;
+    msgpack_ext_registry ext_registry_;
     std::basic_string<char,std::char_traits<char>,char_allocator_type> text_buffer_;
     std::vector<uint8_t,byte_allocator_type> bytes_buffer_;
     std::vector<parse_state,parse_state_allocator_type> state_stack_;
@@ -85,6 +87,7 @@ public:
                          const Allocator& alloc = Allocator())
        : source_(std::forward<Sourceable>(source)),
          max_nesting_depth_(options.max_nesting_depth()),
+         ext_registry_(options.ext_registry()),
          text_buffer_(alloc),
          bytes_buffer_(alloc),
          state_stack_(alloc)
@@ -228,8 +231,189 @@ public:
             }
         }
     }
+
+    // Consumes the remaining items of the innermost array or map without reporting them,
+    // so that the next call to parse reports the end of the container. Only the type
+    // bytes and length prefixes are examined.
+    void skip_container(std::error_code& ec)
+    {
+        switch (state_stack_.back().mode)
+        {
+            case parse_mode::array:
+                while (state_stack_.back().index < state_stack_.back().length)
+                {
+                    ++state_stack_.back().index;
+                    skip_item(0, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                }
+                break;
+            case parse_mode::map_value:
+            case parse_mode::map_key:
+                if (state_stack_.back().mode == parse_mode::map_value)
+                {
+                    state_stack_.back().mode = parse_mode::map_key;
+                    skip_item(0, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                }
+                while (state_stack_.back().index < state_stack_.back().length)
+                {
+                    ++state_stack_.back().index;
+                    skip_item(0, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                    skip_item(0, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                }
+                break;
+            default:
+                break;
+        }
+    }
 private:
 
+    void skip_bytes(std::size_t length, std::error_code& ec)
+    {
+        std::size_t position = source_.position();
+        source_.ignore(length);
+        if (JSONCONS_UNLIKELY(source_.position() - position != length))
+        {
+            ec = msgpack_errc::unexpected_eof;
+            more_ = false;
+        }
+    }
+
+    void skip_item(int depth, std::error_code& ec)
+    {
+        uint8_t type;
+        if (source_.read(&type, 1) == 0)
+        {
+            ec = msgpack_errc::unexpected_eof;
+            more_ = false;
+            return;
+        }
+
+        if (type <= 0x7f || type >= 0xe0)
+        {
+            return; // positive or negative fixint
+        }
+        if (type >= 0xa0 && type <= 0xbf)
+        {
+            skip_bytes(type & 0x1f, ec); // fixstr
+            return;
+        }
+
+        std::size_t count = 0; // number of nested items
+        switch (type)
+        {
+            case jsoncons::msgpack::msgpack_type::nil_type: 
+            case jsoncons::msgpack::msgpack_type::true_type:
+            case jsoncons::msgpack::msgpack_type::false_type:
+                return;
+            case jsoncons::msgpack::msgpack_type::uint8_type: 
+            case jsoncons::msgpack::msgpack_type::int8_type: 
+                skip_bytes(1, ec);
+                return;
+            case jsoncons::msgpack::msgpack_type::uint16_type: 
+            case jsoncons::msgpack::msgpack_type::int16_type: 
+                skip_bytes(2, ec);
+                return;
+            case jsoncons::msgpack::msgpack_type::uint32_type: 
+            case jsoncons::msgpack::msgpack_type::int32_type: 
+            case jsoncons::msgpack::msgpack_type::float32_type: 
+                skip_bytes(4, ec);
+                return;
+            case jsoncons::msgpack::msgpack_type::uint64_type: 
+            case jsoncons::msgpack::msgpack_type::int64_type: 
+            case jsoncons::msgpack::msgpack_type::float64_type: 
+                skip_bytes(8, ec);
+                return;
+            case jsoncons::msgpack::msgpack_type::str8_type: 
+            case jsoncons::msgpack::msgpack_type::str16_type: 
+            case jsoncons::msgpack::msgpack_type::str32_type: 
+            case jsoncons::msgpack::msgpack_type::bin8_type: 
+            case jsoncons::msgpack::msgpack_type::bin16_type: 
+            case jsoncons::msgpack::msgpack_type::bin32_type: 
+            {
+                std::size_t len = get_size(type, ec);
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    return;
+                }
+                skip_bytes(len, ec);
+                return;
+            }
+            case jsoncons::msgpack::msgpack_type::fixext1_type: 
+            case jsoncons::msgpack::msgpack_type::fixext2_type: 
+            case jsoncons::msgpack::msgpack_type::fixext4_type: 
+            case jsoncons::msgpack::msgpack_type::fixext8_type: 
+            case jsoncons::msgpack::msgpack_type::fixext16_type: 
+            case jsoncons::msgpack::msgpack_type::ext8_type: 
+            case jsoncons::msgpack::msgpack_type::ext16_type: 
+            case jsoncons::msgpack::msgpack_type::ext32_type: 
+            {
+                std::size_t len = get_size(type, ec);
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    return;
+                }
+                skip_bytes(len+1, ec); // ext type byte and payload
+                return;
+            }
+            case jsoncons::msgpack::msgpack_type::array16_type: 
+            case jsoncons::msgpack::msgpack_type::array32_type: 
+                count = get_size(type, ec);
+                break;
+            case jsoncons::msgpack::msgpack_type::map16_type: 
+            case jsoncons::msgpack::msgpack_type::map32_type: 
+                count = 2*get_size(type, ec);
+                break;
+            default:
+                if (type <= 0x8f) 
+                {
+                    count = 2*get_size(type, ec); // fixmap
+                }
+                else if (type <= 0x9f)
+                {
+                    count = get_size(type, ec); // fixarray
+                }
+                else
+                {
+                    ec = msgpack_errc::unknown_type;
+                    more_ = false;
+                }
+                break;
+        }
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            return;
+        }
+        if (JSONCONS_UNLIKELY(nesting_depth_ + (++depth) > max_nesting_depth_))
+        {
+            ec = msgpack_errc::max_nesting_depth_exceeded;
+            more_ = false;
+            return;
+        }
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            skip_item(depth, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+        }
+    }
+
     void read_item(item_event_visitor& visitor, std::error_code& ec)
     {
         if (source_.is_error())
@@ -268,23 +452,22 @@ private:
                 // fixstr
                 const size_t len = type & 0x1f;
 
-                text_buffer_.clear();
-
-                if (source_reader<Source>::read(source_,text_buffer_,len) != static_cast<std::size_t>(len))
+                auto chars = source_reader<Source>::read_view(source_,text_buffer_,len);
+                if (chars.size() != static_cast<std::size_t>(len))
                 {
                     ec = msgpack_errc::unexpected_eof;
                     more_ = false;
                     return;
                 }
 
-                auto result = unicode_traits::validate(text_buffer_.data(),text_buffer_.size());
+                auto result = unicode_traits::validate(chars.data(),chars.size());
                 if (result.ec != unicode_traits::conv_errc())
                 {
                     ec = msgpack_errc::invalid_utf8_text_string;
                     more_ = false;
                     return;
                 }
-                visitor.string_value(jsoncons::basic_string_view<char>(text_buffer_.data(),text_buffer_.length()), semantic_tag::none, *this, ec);
+                visitor.string_value(jsoncons::basic_string_view<char>(chars.data(),chars.size()), semantic_tag::none, *this, ec);
                 more_ = !cursor_mode_;
             }
         }
@@ -475,22 +658,22 @@ private:
                         return;
                     }
 
-                    text_buffer_.clear();
-                    if (source_reader<Source>::read(source_,text_buffer_,len) != static_cast<std::size_t>(len))
+                    auto chars = source_reader<Source>::read_view(source_,text_buffer_,len);
+                    if (chars.size() != static_cast<std::size_t>(len))
                     {
                         ec = msgpack_errc::unexpected_eof;
                         more_ = false;
                         return;
                     }
 
-                    auto result = unicode_traits::validate(text_buffer_.data(),text_buffer_.size());
+                    auto result = unicode_traits::validate(chars.data(),chars.size());
                     if (result.ec != unicode_traits::conv_errc())
                     {
                         ec = msgpack_errc::invalid_utf8_text_string;
                         more_ = false;
                         return;
                     }
-                    visitor.string_value(jsoncons::basic_string_view<char>(text_buffer_.data(),text_buffer_.length()), semantic_tag::none, *this, ec);
+                    visitor.string_value(jsoncons::basic_string_view<char>(chars.data(),chars.size()), semantic_tag::none, *this, ec);
                     more_ = !cursor_mode_;
                     break;
                 }
@@ -504,15 +687,15 @@ private:
                     {
                         return;
                     }
-                    bytes_buffer_.clear();
-                    if (source_reader<Source>::read(source_,bytes_buffer_,len) != static_cast<std::size_t>(len))
+                    auto bytes = source_reader<Source>::read_view(source_,bytes_buffer_,len);
+                    if (bytes.size() != static_cast<std::size_t>(len))
                     {
                         ec = msgpack_errc::unexpected_eof;
                         more_ = false;
                         return;
                     }
 
-                    visitor.byte_string_value(byte_string_view(bytes_buffer_.data(),bytes_buffer_.size()), 
+                    visitor.byte_string_value(byte_string_view(bytes.data(),bytes.size()), 
                                                       semantic_tag::none, 
                                                       *this,
                                                       ec);
@@ -545,14 +728,37 @@ private:
 
                     int8_t ext_type = binary::big_to_native<int8_t>(buf, sizeof(buf));
 
+                    const msgpack_ext_decoder* decoder = ext_registry_.has_decoders() ? ext_registry_.find_decoder(ext_type) : nullptr;
                     bool is_timestamp = false; 
-                    if (ext_type == -1)
+                    if (ext_type == -1 && decoder == nullptr)
                     {
                         is_timestamp = true;;
                     }
 
                     // payload
-                    if (is_timestamp && len == 4)
+                    if (decoder != nullptr)
+                    {
+                        auto bytes = source_reader<Source>::read_view(source_,bytes_buffer_,len);
+                        if (bytes.size() != static_cast<std::size_t>(len))
+                        {
+                            ec = msgpack_errc::unexpected_eof;
+                            more_ = false;
+                            return;
+                        }
+                        jsoncons::msgpack::detail::msgpack_ext_value_visitor ext_visitor(visitor);
+                        (*decoder)(byte_string_view(bytes.data(),bytes.size()), ext_visitor, *this, ec);
+                        if (JSONCONS_UNLIKELY(!ec && ext_visitor.count() != 1))
+                        {
+                            ec = msgpack_errc::invalid_ext_value;
+                        }
+                        if (JSONCONS_UNLIKELY(ec))
+                        {
+                            more_ = false;
+                            return;
+                        }
+                        more_ = !cursor_mode_;
+                    }
+                    else if (is_timestamp && len == 4)
                     {
                         uint8_t buf32[sizeof(uint32_t)];
                         if (source_.read(buf32, sizeof(uint32_t)) != sizeof(uint32_t))
@@ -628,15 +834,15 @@ private:
                     }
                     else
                     {
-                        bytes_buffer_.clear();
-                        if (source_reader<Source>::read(source_,bytes_buffer_,len) != static_cast<std::size_t>(len))
+                        auto bytes = source_reader<Source>::read_view(source_,bytes_buffer_,len);
+                        if (bytes.size() != static_cast<std::size_t>(len))
                         {
                             ec = msgpack_errc::unexpected_eof;
                             more_ = false;
                             return;
                         }
 
-                        visitor.byte_string_value(byte_string_view(bytes_buffer_.data(),bytes_buffer_.size()), 
+                        visitor.byte_string_value(byte_string_view(bytes.data(),bytes.size()), 
                                                           static_cast<uint8_t>(ext_type), 
                                                           *this,
                                                           ec);
@@ -0,0 +1,889 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_EXT_MSGPACK_MSGPACK_VIEW_HPP
+#define JSONCONS_EXT_MSGPACK_MSGPACK_VIEW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits> // std::numeric_limits
+#include <stdexcept>
+#include <vector>
+
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/detail/span.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/utility/binary.hpp>
+#include <jsoncons/utility/byte_string.hpp>
+
+#include <jsoncons_ext/msgpack/msgpack_error.hpp>
+#include <jsoncons_ext/msgpack/msgpack_type.hpp>
+
+namespace jsoncons {
+namespace msgpack {
+
+class msgpack_array_iterator;
+class msgpack_object_iterator;
+class msgpack_indexed_view;
+
+// A read-only view of one encoded MessagePack value. Arrays and maps are navigated
+// by skipping over the values that precede the one requested, and scalar values
+// are decoded from the underlying bytes when requested. A view holds no mutable state,
+// so one view may be read from several threads.
+class msgpack_view
+{
+    static constexpr int max_nesting_depth = 1024;
+
+    enum class item_kind {null_value, bool_value, uint_value, int_value, float_value, string_value, binary_value, ext_value, array_value, map_value};
+
+    struct item_header
+    {
+        item_kind kind;
+        uint8_t type;
+        // Length of the header, including the ext type byte
+        std::size_t length;
+        // The integer value, the payload length of a string, bin or ext,
+        // or the number of elements of an array or members of a map
+        uint64_t value;
+    };
+
+    const uint8_t* data_{nullptr};
+    // The length of the value if sized_, otherwise the number of bytes available to it
+    std::size_t length_{0};
+    bool sized_{false};
+
+    friend class msgpack_array_iterator;
+    friend class msgpack_object_iterator;
+public:
+    using array_iterator = msgpack_array_iterator;
+    using object_iterator = msgpack_object_iterator;
+
+    msgpack_view() = default;
+
+    // Views the first value in [data, data+length). The value is not scanned
+    // until it is read, and only as far as the read requires.
+    msgpack_view(const uint8_t* data, std::size_t length)
+        : data_(data), length_(length)
+    {
+    }
+
+    explicit msgpack_view(const jsoncons::span<const uint8_t>& bytes)
+        : msgpack_view(bytes.data(), bytes.size())
+    {
+    }
+
+    // The encoded value
+    jsoncons::span<const uint8_t> bytes() const
+    {
+        if (sized_ || data_ == nullptr)
+        {
+            return jsoncons::span<const uint8_t>(data_, length_);
+        }
+        return jsoncons::span<const uint8_t>(data_, static_cast<std::size_t>(skip(data_, data_ + length_, 0) - data_));
+    }
+
+    // Sets ec rather than throwing if the value cannot be read
+    jsoncons::span<const uint8_t> bytes(std::error_code& ec) const
+    {
+        if (sized_ || data_ == nullptr)
+        {
+            return jsoncons::span<const uint8_t>(data_, length_);
+        }
+        const uint8_t* last = skip(data_, data_ + length_, 0, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            return jsoncons::span<const uint8_t>();
+        }
+        return jsoncons::span<const uint8_t>(data_, static_cast<std::size_t>(last - data_));
+    }
+
+    bool is_null() const
+    {
+        return header().kind == item_kind::null_value;
+    }
+
+    bool is_bool() const
+    {
+        return header().kind == item_kind::bool_value;
+    }
+
+    bool is_uint64() const
+    {
+        return header().kind == item_kind::uint_value;
+    }
+
+    bool is_int64() const
+    {
+        auto h = header();
+        return h.kind == item_kind::int_value ||
+            (h.kind == item_kind::uint_value && h.value <= static_cast<uint64_t>((std::numeric_limits<int64_t>::max)()));
+    }
+
+    bool is_double() const
+    {
+        return header().kind == item_kind::float_value;
+    }
+
+    bool is_string() const
+    {
+        return header().kind == item_kind::string_value;
+    }
+
+    bool is_byte_string() const
+    {
+        return header().kind == item_kind::binary_value;
+    }
+
+    bool is_ext() const
+    {
+        return header().kind == item_kind::ext_value;
+    }
+
+    bool is_array() const
+    {
+        return header().kind == item_kind::array_value;
+    }
+
+    bool is_object() const
+    {
+        return header().kind == item_kind::map_value;
+    }
+
+    bool as_bool() const
+    {
+        auto h = header();
+        if (h.kind != item_kind::bool_value)
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a bool"));
+        }
+        return h.type == msgpack_type::true_type;
+    }
+
+    uint64_t as_uint64() const
+    {
+        auto h = header();
+        if (h.kind != item_kind::uint_value)
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an unsigned integer"));
+        }
+        return h.value;
+    }
+
+    int64_t as_int64() const
+    {
+        if (!is_int64())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an int64"));
+        }
+        return static_cast<int64_t>(header().value);
+    }
+
+    double as_double() const
+    {
+        auto h = header();
+        switch (h.kind)
+        {
+            case item_kind::float_value:
+                if (h.type == msgpack_type::float32_type)
+                {
+                    return binary::big_to_native<float>(data_ + 1, length_ - 1);
+                }
+                return binary::big_to_native<double>(data_ + 1, length_ - 1);
+            case item_kind::uint_value:
+                return static_cast<double>(h.value);
+            case item_kind::int_value:
+                return static_cast<double>(static_cast<int64_t>(h.value));
+            default:
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a double"));
+        }
+    }
+
+    jsoncons::string_view as_string_view() const
+    {
+        auto h = header();
+        if (h.kind != item_kind::string_value)
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a string"));
+        }
+        return jsoncons::string_view(reinterpret_cast<const char*>(data_ + h.length), static_cast<std::size_t>(h.value));
+    }
+
+    // The payload of a bin or ext value
+    byte_string_view as_byte_string_view() const
+    {
+        auto h = header();
+        if (h.kind != item_kind::binary_value && h.kind != item_kind::ext_value)
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a byte string"));
+        }
+        return byte_string_view(data_ + h.length, static_cast<std::size_t>(h.value));
+    }
+
+    int8_t ext_type() const
+    {
+        auto h = header();
+        if (h.kind != item_kind::ext_value)
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an ext value"));
+        }
+        return static_cast<int8_t>(data_[h.length - 1]);
+    }
+
+    // The number of elements of an array or members of a map
+    std::size_t size() const
+    {
+        auto h = header();
+        return (h.kind == item_kind::array_value || h.kind == item_kind::map_value) ? static_cast<std::size_t>(h.value) : 0;
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    range<array_iterator,array_iterator> array_range() const;
+
+    range<object_iterator,object_iterator> object_range() const;
+
+    // Finds the first member with a string key equal to key
+    object_iterator find(const jsoncons::string_view& key) const;
+
+    bool contains(const jsoncons::string_view& key) const;
+
+    msgpack_view at(const jsoncons::string_view& key) const;
+
+    // The element at position index of an array
+    msgpack_view at(std::size_t index) const;
+
+    msgpack_view operator[](const jsoncons::string_view& key) const
+    {
+        return at(key);
+    }
+
+    // Records the positions of the children of an array or map, for repeated lookups
+    msgpack_indexed_view index() const;
+private:
+    msgpack_view(const uint8_t* data, std::size_t length, int)
+        : data_(data), length_(length), sized_(true)
+    {
+    }
+
+    // A short read yields zero; read_header then rejects the truncated header
+    template <typename T>
+    static uint64_t read_length(const uint8_t* p, std::size_t available)
+    {
+        return binary::big_to_native<T>(p, available);
+    }
+
+    template <typename T>
+    static uint64_t read_signed(const uint8_t* p, std::size_t available)
+    {
+        return static_cast<uint64_t>(static_cast<int64_t>(binary::big_to_native<T>(p, available)));
+    }
+
+    static item_header read_header(const uint8_t* p, const uint8_t* last)
+    {
+        std::error_code ec;
+        auto h = read_header(p, last, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec));
+        }
+        return h;
+    }
+
+    static item_header read_header(const uint8_t* p, const uint8_t* last, std::error_code& ec)
+    {
+        item_header h{item_kind::null_value, 0, 0, 0};
+        if (JSONCONS_UNLIKELY(p >= last))
+        {
+            ec = msgpack_errc::unexpected_eof;
+            return h;
+        }
+        h.type = *p;
+        h.length = 1;
+        h.value = 0;
+        const uint8_t* q = p + 1;
+        std::size_t available = static_cast<std::size_t>(last - q);
+
+        if (h.type <= 0x7f)
+        {
+            h.kind = item_kind::uint_value;
+            h.value = h.type;
+            return h;
+        }
+        if (h.type >= msgpack_type::negative_fixint_base_type)
+        {
+            h.kind = item_kind::int_value;
+            h.value = static_cast<uint64_t>(static_cast<int64_t>(static_cast<int8_t>(h.type)));
+            return h;
+        }
+        if (h.type >= msgpack_type::fixstr_base_type && h.type <= 0xbf)
+        {
+            h.kind = item_kind::string_value;
+            h.value = h.type & 0x1f;
+            return h;
+        }
+        if (h.type >= msgpack_type::fixarray_base_type && h.type <= 0x9f)
+        {
+            h.kind = item_kind::array_value;
+            h.value = h.type & 0x0f;
+            return h;
+        }
+        if (h.type >= msgpack_type::fixmap_base_type && h.type <= 0x8f)
+        {
+            h.kind = item_kind::map_value;
+            h.value = h.type & 0x0f;
+            return h;
+        }
+
+        switch (h.type)
+        {
+            case msgpack_type::nil_type:
+                h.kind = item_kind::null_value;
+                break;
+            case msgpack_type::false_type:
+            case msgpack_type::true_type:
+                h.kind = item_kind::bool_value;
+                break;
+            case msgpack_type::float32_type:
+                h.kind = item_kind::float_value;
+                h.value = read_length<uint32_t>(q, available);
+                h.length += sizeof(uint32_t);
+                break;
+            case msgpack_type::float64_type:
+                h.kind = item_kind::float_value;
+                h.value = read_length<uint64_t>(q, available);
+                h.length += sizeof(uint64_t);
+                break;
+            case msgpack_type::uint8_type:
+                h.kind = item_kind::uint_value;
+                h.value = read_length<uint8_t>(q, available);
+                h.length += sizeof(uint8_t);
+                break;
+            case msgpack_type::uint16_type:
+                h.kind = item_kind::uint_value;
+                h.value = read_length<uint16_t>(q, available);
+                h.length += sizeof(uint16_t);
+                break;
+            case msgpack_type::uint32_type:
+                h.kind = item_kind::uint_value;
+                h.value = read_length<uint32_t>(q, available);
+                h.length += sizeof(uint32_t);
+                break;
+            case msgpack_type::uint64_type:
+                h.kind = item_kind::uint_value;
+                h.value = read_length<uint64_t>(q, available);
+                h.length += sizeof(uint64_t);
+                break;
+            case msgpack_type::int8_type:
+                h.kind = item_kind::int_value;
+                h.value = read_signed<int8_t>(q, available);
+                h.length += sizeof(int8_t);
+                break;
+            case msgpack_type::int16_type:
+                h.kind = item_kind::int_value;
+                h.value = read_signed<int16_t>(q, available);
+                h.length += sizeof(int16_t);
+                break;
+            case msgpack_type::int32_type:
+                h.kind = item_kind::int_value;
+                h.value = read_signed<int32_t>(q, available);
+                h.length += sizeof(int32_t);
+                break;
+            case msgpack_type::int64_type:
+                h.kind = item_kind::int_value;
+                h.value = read_signed<int64_t>(q, available);
+                h.length += sizeof(int64_t);
+                break;
+            case msgpack_type::str8_type:
+            case msgpack_type::bin8_type:
+                h.kind = h.type == msgpack_type::str8_type ? item_kind::string_value : item_kind::binary_value;
+                h.value = read_length<uint8_t>(q, available);
+                h.length += sizeof(uint8_t);
+                break;
+            case msgpack_type::str16_type:
+            case msgpack_type::bin16_type:
+                h.kind = h.type == msgpack_type::str16_type ? item_kind::string_value : item_kind::binary_value;
+                h.value = read_length<uint16_t>(q, available);
+                h.length += sizeof(uint16_t);
+                break;
+            case msgpack_type::str32_type:
+            case msgpack_type::bin32_type:
+                h.kind = h.type == msgpack_type::str32_type ? item_kind::string_value : item_kind::binary_value;
+                h.value = read_length<uint32_t>(q, available);
+                h.length += sizeof(uint32_t);
+                break;
+            case msgpack_type::array16_type:
+            case msgpack_type::map16_type:
+                h.kind = h.type == msgpack_type::array16_type ? item_kind::array_value : item_kind::map_value;
+                h.value = read_length<uint16_t>(q, available);
+                h.length += sizeof(uint16_t);
+                break;
+            case msgpack_type::array32_type:
+            case msgpack_type::map32_type:
+                h.kind = h.type == msgpack_type::array32_type ? item_kind::array_value : item_kind::map_value;
+                h.value = read_length<uint32_t>(q, available);
+                h.length += sizeof(uint32_t);
+                break;
+            case msgpack_type::fixext1_type:
+            case msgpack_type::fixext2_type:
+            case msgpack_type::fixext4_type:
+            case msgpack_type::fixext8_type:
+            case msgpack_type::fixext16_type:
+                h.kind = item_kind::ext_value;
+                h.value = uint64_t(1) << (h.type - msgpack_type::fixext1_type);
+                h.length += 1;
+                break;
+            case msgpack_type::ext8_type:
+                h.kind = item_kind::ext_value;
+                h.value = read_length<uint8_t>(q, available);
+                h.length += sizeof(uint8_t) + 1;
+                break;
+            case msgpack_type::ext16_type:
+                h.kind = item_kind::ext_value;
+                h.value = read_length<uint16_t>(q, available);
+                h.length += sizeof(uint16_t) + 1;
+                break;
+            case msgpack_type::ext32_type:
+                h.kind = item_kind::ext_value;
+                h.value = read_length<uint32_t>(q, available);
+                h.length += sizeof(uint32_t) + 1;
+                break;
+            default:
+                ec = msgpack_errc::unknown_type;
+                return h;
+        }
+        if (JSONCONS_UNLIKELY(h.length > static_cast<std::size_t>(last - p)))
+        {
+            ec = msgpack_errc::unexpected_eof;
+            return h;
+        }
+        return h;
+    }
+
+    // Returns a pointer past the value that starts at p
+    static const uint8_t* skip(const uint8_t* p, const uint8_t* last, int depth)
+    {
+        std::error_code ec;
+        const uint8_t* q = skip(p, last, depth, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec));
+        }
+        return q;
+    }
+
+    // Returns a pointer past the value that starts at p, or nullptr on error
+    static const uint8_t* skip(const uint8_t* p, const uint8_t* last, int depth, std::error_code& ec)
+    {
+        if (JSONCONS_UNLIKELY(depth > max_nesting_depth))
+        {
+            ec = msgpack_errc::max_nesting_depth_exceeded;
+            return nullptr;
+        }
+        auto h = read_header(p, last, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            return nullptr;
+        }
+        const uint8_t* q = p + h.length;
+        switch (h.kind)
+        {
+            case item_kind::string_value:
+            case item_kind::binary_value:
+            case item_kind::ext_value:
+                if (JSONCONS_UNLIKELY(h.value > static_cast<uint64_t>(last - q)))
+                {
+                    ec = msgpack_errc::unexpected_eof;
+                    return nullptr;
+                }
+                return q + h.value;
+            case item_kind::array_value:
+            case item_kind::map_value:
+            {
+                uint64_t n = h.kind == item_kind::map_value ? 2*h.value : h.value;
+                if (JSONCONS_UNLIKELY(n > static_cast<uint64_t>(last - q)))
+                {
+                    // every value occupies at least one byte
+                    ec = msgpack_errc::unexpected_eof;
+                    return nullptr;
+                }
+                for (uint64_t i = 0; i < n; ++i)
+                {
+                    q = skip(q, last, depth+1, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return nullptr;
+                    }
+                }
+                return q;
+            }
+            default:
+                return q;
+        }
+    }
+
+    item_header header() const
+    {
+        if (data_ == nullptr)
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Empty view"));
+        }
+        return read_header(data_, data_ + length_);
+    }
+
+};
+
+class msgpack_array_iterator
+{
+    const uint8_t* p_{nullptr};
+    const uint8_t* last_{nullptr};
+    // Values left; an end iterator has a null p_
+    uint64_t remaining_{0};
+    msgpack_view value_;
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = msgpack_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const msgpack_view*;
+    using reference = const msgpack_view&;
+
+    msgpack_array_iterator() = default;
+
+    msgpack_array_iterator(const uint8_t* first, const uint8_t* last, uint64_t count)
+        : p_(first), last_(last), remaining_(count)
+    {
+        read_item();
+    }
+
+    reference operator*() const
+    {
+        return value_;
+    }
+
+    pointer operator->() const
+    {
+        return &value_;
+    }
+
+    msgpack_array_iterator& operator++()
+    {
+        p_ += value_.length_;
+        --remaining_;
+        read_item();
+        return *this;
+    }
+
+    msgpack_array_iterator operator++(int)
+    {
+        msgpack_array_iterator temp(*this);
+        ++(*this);
+        return temp;
+    }
+
+    friend bool operator==(const msgpack_array_iterator& lhs, const msgpack_array_iterator& rhs)
+    {
+        return lhs.p_ == rhs.p_;
+    }
+
+    friend bool operator!=(const msgpack_array_iterator& lhs, const msgpack_array_iterator& rhs)
+    {
+        return lhs.p_ != rhs.p_;
+    }
+private:
+    void read_item()
+    {
+        if (remaining_ == 0)
+        {
+            p_ = nullptr;
+            return;
+        }
+        value_ = msgpack_view(p_, msgpack_view::skip(p_, last_, 0) - p_, 0);
+    }
+};
+
+class msgpack_member_view
+{
+    msgpack_view key_;
+    msgpack_view value_;
+public:
+    msgpack_member_view() = default;
+
+    msgpack_member_view(const msgpack_view& key, const msgpack_view& value)
+        : key_(key), value_(value)
+    {
+    }
+
+    const msgpack_view& key() const noexcept
+    {
+        return key_;
+    }
+
+    const msgpack_view& value() const noexcept
+    {
+        return value_;
+    }
+};
+
+class msgpack_object_iterator
+{
+    const uint8_t* p_{nullptr};
+    const uint8_t* last_{nullptr};
+    // Members left; an end iterator has a null p_
+    uint64_t remaining_{0};
+    msgpack_member_view member_;
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = msgpack_member_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const msgpack_member_view*;
+    using reference = const msgpack_member_view&;
+
+    msgpack_object_iterator() = default;
+
+    msgpack_object_iterator(const uint8_t* first, const uint8_t* last, uint64_t count)
+        : p_(first), last_(last), remaining_(count)
+    {
+        read_member();
+    }
+
+    reference operator*() const
+    {
+        return member_;
+    }
+
+    pointer operator->() const
+    {
+        return &member_;
+    }
+
+    msgpack_object_iterator& operator++()
+    {
+        p_ += member_.key().length_ + member_.value().length_;
+        --remaining_;
+        read_member();
+        return *this;
+    }
+
+    msgpack_object_iterator operator++(int)
+    {
+        msgpack_object_iterator temp(*this);
+        ++(*this);
+        return temp;
+    }
+
+    friend bool operator==(const msgpack_object_iterator& lhs, const msgpack_object_iterator& rhs)
+    {
+        return lhs.p_ == rhs.p_;
+    }
+
+    friend bool operator!=(const msgpack_object_iterator& lhs, const msgpack_object_iterator& rhs)
+    {
+        return lhs.p_ != rhs.p_;
+    }
+private:
+    void read_member()
+    {
+        if (remaining_ == 0)
+        {
+            p_ = nullptr;
+            return;
+        }
+        const uint8_t* q = msgpack_view::skip(p_, last_, 0);
+        const uint8_t* r = msgpack_view::skip(q, last_, 0);
+        member_ = msgpack_member_view(msgpack_view(p_, q - p_, 0), msgpack_view(q, r - q, 0));
+    }
+};
+
+// The children of an array or map, located once when the index is built. Lookups by
+// position take constant time, and by key a scan of the keys without skipping values.
+// An index is not modified after construction, so it may be read from several threads.
+class msgpack_indexed_view
+{
+    msgpack_view view_;
+    // The elements of an array, or the keys and values of a map in turn
+    std::vector<msgpack_view> children_;
+public:
+    explicit msgpack_indexed_view(const msgpack_view& view)
+        : view_(view)
+    {
+        if (view.is_array())
+        {
+            children_.reserve(view.size());
+            for (const auto& item : view.array_range())
+            {
+                children_.push_back(item);
+            }
+        }
+        else if (view.is_object())
+        {
+            children_.reserve(2*view.size());
+            for (const auto& member : view.object_range())
+            {
+                children_.push_back(member.key());
+                children_.push_back(member.value());
+            }
+        }
+        else
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array or object"));
+        }
+    }
+
+    const msgpack_view& view() const noexcept
+    {
+        return view_;
+    }
+
+    // The number of elements of an array or members of a map
+    std::size_t size() const noexcept
+    {
+        return view_.is_array() ? children_.size() : children_.size()/2;
+    }
+
+    bool empty() const noexcept
+    {
+        return children_.empty();
+    }
+
+    msgpack_view at(std::size_t index) const
+    {
+        if (!view_.is_array())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
+        }
+        if (index >= children_.size())
+        {
+            JSONCONS_THROW(std::out_of_range("Index out of range"));
+        }
+        return children_[index];
+    }
+
+    bool contains(const jsoncons::string_view& key) const
+    {
+        return find_value(key) != nullptr;
+    }
+
+    msgpack_view at(const jsoncons::string_view& key) const
+    {
+        const msgpack_view* value = find_value(key);
+        if (value == nullptr)
+        {
+            JSONCONS_THROW(key_not_found(key.data(),key.length()));
+        }
+        return *value;
+    }
+
+    msgpack_view operator[](const jsoncons::string_view& key) const
+    {
+        return at(key);
+    }
+private:
+    const msgpack_view* find_value(const jsoncons::string_view& key) const
+    {
+        if (!view_.is_object())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object"));
+        }
+        for (std::size_t i = 0; i + 1 < children_.size(); i += 2)
+        {
+            const msgpack_view& k = children_[i];
+            if (k.is_string() && k.as_string_view() == key)
+            {
+                return &children_[i+1];
+            }
+        }
+        return nullptr;
+    }
+};
+
+inline
+range<msgpack_view::array_iterator,msgpack_view::array_iterator> msgpack_view::array_range() const
+{
+    if (!is_array())
+    {
+        JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
+    }
+    auto h = header();
+    return range<array_iterator,array_iterator>(array_iterator(data_ + h.length, data_ + length_, h.value), array_iterator());
+}
+
+inline
+range<msgpack_view::object_iterator,msgpack_view::object_iterator> msgpack_view::object_range() const
+{
+    if (!is_object())
+    {
+        JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object"));
+    }
+    auto h = header();
+    return range<object_iterator,object_iterator>(object_iterator(data_ + h.length, data_ + length_, h.value), object_iterator());
+}
+
+inline
+msgpack_view::object_iterator msgpack_view::find(const jsoncons::string_view& key) const
+{
+    auto members = object_range();
+    for (auto it = members.begin(); it != members.end(); ++it)
+    {
+        const msgpack_view& k = it->key();
+        if (k.is_string() && k.as_string_view() == key)
+        {
+            return it;
+        }
+    }
+    return members.end();
+}
+
+inline
+bool msgpack_view::contains(const jsoncons::string_view& key) const
+{
+    return find(key) != object_iterator();
+}
+
+inline
+msgpack_view msgpack_view::at(const jsoncons::string_view& key) const
+{
+    auto it = find(key);
+    if (it == object_iterator())
+    {
+        JSONCONS_THROW(key_not_found(key.data(),key.length()));
+    }
+    return it->value();
+}
+
+inline
+msgpack_view msgpack_view::at(std::size_t index) const
+{
+    if (!is_array())
+    {
+        JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
+    }
+    if (index >= size())
+    {
+        JSONCONS_THROW(std::out_of_range("Index out of range"));
+    }
+    auto it = array_range().begin();
+    for (std::size_t i = 0; i < index; ++i)
+    {
+        ++it;
+    }
+    return *it;
+}
+
+inline
+msgpack_indexed_view msgpack_view::index() const
+{
+    return msgpack_indexed_view(*this);
+}
+
+} // namespace msgpack
+} // namespace jsoncons
+
+#endif // JSONCONS_EXT_MSGPACK_MSGPACK_VIEW_HPP
@@ -39,7 +39,7 @@ try_decode_toon(const StringViewLike& s,
     auto result = reader.try_read();
     if (!result)
     {
-        return result_type{jsoncons::unexpect, result.error().code()};
+        return result_type{jsoncons::unexpect, result.error()};
     }
 
     return result_type{decoder.get_result()};
@@ -73,7 +73,7 @@ try_decode_toon(std::istream& is,
     auto result = reader.try_read();
     if (!result)
     {
-        return result_type{jsoncons::unexpect, result.error().code()};
+        return result_type{jsoncons::unexpect, result.error()};
     }
 
     return result_type{decoder.get_result()};
@@ -7,7 +7,10 @@
 #ifndef JSONCONS_TOON_TOON_HPP 
 #define JSONCONS_TOON_TOON_HPP 
 
+#include <jsoncons_ext/toon/decode_toon.hpp>
 #include <jsoncons_ext/toon/encode_toon.hpp>
+#include <jsoncons_ext/toon/toon_cursor.hpp>
+#include <jsoncons_ext/toon/toon_encoder.hpp>
 
 #endif // JSONCONS_TOON_TOON_HPP 
 
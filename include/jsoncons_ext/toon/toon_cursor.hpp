@@ -0,0 +1,430 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_TOON_TOON_CURSOR_HPP
+#define JSONCONS_TOON_TOON_CURSOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory> // std::allocator
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility> // std::move
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/ser_utils.hpp>
+#include <jsoncons/source.hpp>
+#include <jsoncons/staj_cursor.hpp>
+#include <jsoncons/staj_event.hpp>
+#include <jsoncons/utility/byte_string.hpp>
+
+#include <jsoncons_ext/toon/toon_error.hpp>
+#include <jsoncons_ext/toon/toon_options.hpp>
+#include <jsoncons_ext/toon/toon_parser.hpp>
+
+namespace jsoncons {
+namespace toon {
+namespace detail {
+
+    // Holds the events reported for one line until the cursor reads them.
+    // Slots are reused once all events have been read.
+    class toon_event_buffer : public json_visitor
+    {
+        struct slot
+        {
+            staj_events event_type{staj_events::null_value};
+            semantic_tag tag{semantic_tag::none};
+            std::string text;
+            union
+            {
+                bool bool_value;
+                int64_t int64_value;
+                uint64_t uint64_value;
+                double double_value;
+            };
+
+            slot()
+                : uint64_value(0)
+            {
+            }
+        };
+
+        std::vector<slot> slots_;
+        std::size_t size_{0};
+        std::size_t next_{0};
+    public:
+        bool empty() const
+        {
+            return next_ == size_;
+        }
+
+        void clear()
+        {
+            size_ = 0;
+            next_ = 0;
+        }
+
+        // The next event, valid until more events are added
+        basic_staj_event<char> pop()
+        {
+            const slot& s = slots_[next_++];
+            switch (s.event_type)
+            {
+                case staj_events::key:
+                case staj_events::string_value:
+                    return basic_staj_event<char>(jsoncons::string_view(s.text.data(), s.text.size()), s.event_type, s.tag);
+                case staj_events::byte_string_value:
+                    return basic_staj_event<char>(byte_string_view(reinterpret_cast<const uint8_t*>(s.text.data()), s.text.size()), s.event_type, s.tag);
+                case staj_events::bool_value:
+                    return basic_staj_event<char>(s.bool_value, s.tag);
+                case staj_events::int64_value:
+                    return basic_staj_event<char>(s.int64_value, s.tag);
+                case staj_events::uint64_value:
+                    return basic_staj_event<char>(s.uint64_value, s.tag);
+                case staj_events::double_value:
+                    return basic_staj_event<char>(s.double_value, s.tag);
+                default:
+                    return basic_staj_event<char>(s.event_type, s.tag);
+            }
+        }
+
+    private:
+        slot& push(staj_events event_type, semantic_tag tag)
+        {
+            if (next_ == size_)
+            {
+                clear();
+            }
+            if (size_ == slots_.size())
+            {
+                slots_.emplace_back();
+            }
+            slot& s = slots_[size_++];
+            s.event_type = event_type;
+            s.tag = tag;
+            return s;
+        }
+
+        void visit_flush() final
+        {
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_object(semantic_tag tag, const ser_context&, std::error_code&) final
+        {
+            push(staj_events::begin_object, tag);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_end_object(const ser_context&, std::error_code&) final
+        {
+            push(staj_events::end_object, semantic_tag::none);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_array(semantic_tag tag, const ser_context&, std::error_code&) final
+        {
+            push(staj_events::begin_array, tag);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_end_array(const ser_context&, std::error_code&) final
+        {
+            push(staj_events::end_array, semantic_tag::none);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_key(const string_view_type& name, const ser_context&, std::error_code&) final
+        {
+            push(staj_events::key, semantic_tag::none).text.assign(name.data(), name.size());
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_null(semantic_tag tag, const ser_context&, std::error_code&) final
+        {
+            push(staj_events::null_value, tag);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_bool(bool value, semantic_tag tag, const ser_context&, std::error_code&) final
+        {
+            push(staj_events::bool_value, tag).bool_value = value;
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_string(const string_view_type& value, semantic_tag tag, const ser_context&, std::error_code&) final
+        {
+            push(staj_events::string_value, tag).text.assign(value.data(), value.size());
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view& value, semantic_tag tag, const ser_context&, std::error_code&) final
+        {
+            push(staj_events::byte_string_value, tag).text.assign(reinterpret_cast<const char*>(value.data()), value.size());
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_uint64(uint64_t value, semantic_tag tag, const ser_context&, std::error_code&) final
+        {
+            push(staj_events::uint64_value, tag).uint64_value = value;
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_int64(int64_t value, semantic_tag tag, const ser_context&, std::error_code&) final
+        {
+            push(staj_events::int64_value, tag).int64_value = value;
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_double(double value, semantic_tag tag, const ser_context&, std::error_code&) final
+        {
+            push(staj_events::double_value, tag).double_value = value;
+            JSONCONS_VISITOR_RETURN;
+        }
+    };
+
+} // namespace detail
+
+// Pulls the events of TOON text a line at a time
+template <typename Source=jsoncons::stream_source<char>,typename TempAlloc=std::allocator<char>>
+class basic_toon_cursor : public basic_staj_cursor<char>, private virtual ser_context
+{
+public:
+    using source_type = Source;
+    using char_type = char;
+    using string_view_type = jsoncons::string_view;
+private:
+    source_type source_;
+    basic_toon_parser<TempAlloc> parser_;
+    detail::toon_event_buffer events_;
+    basic_staj_event<char> current_{staj_events::null_value};
+    bool done_{false};
+
+public:
+    // Noncopyable and nonmoveable
+    basic_toon_cursor(const basic_toon_cursor&) = delete;
+    basic_toon_cursor(basic_toon_cursor&&) = delete;
+    basic_toon_cursor& operator=(const basic_toon_cursor&) = delete;
+    basic_toon_cursor& operator=(basic_toon_cursor&&) = delete;
+
+    template <typename Sourceable>
+    basic_toon_cursor(Sourceable&& source,
+        const toon_decode_options& options = toon_decode_options(),
+        const TempAlloc& temp_alloc = TempAlloc())
+        : source_(std::forward<Sourceable>(source)),
+          parser_(options, temp_alloc)
+    {
+        parser_.cursor_mode(true);
+        read_next();
+    }
+
+    template <typename Sourceable>
+    basic_toon_cursor(Sourceable&& source, std::error_code& ec)
+        : basic_toon_cursor(std::allocator_arg, TempAlloc(),
+              std::forward<Sourceable>(source),
+              toon_decode_options(),
+              ec)
+    {
+    }
+
+    template <typename Sourceable>
+    basic_toon_cursor(Sourceable&& source,
+        const toon_decode_options& options,
+        std::error_code& ec)
+        : basic_toon_cursor(std::allocator_arg, TempAlloc(),
+              std::forward<Sourceable>(source),
+              options,
+              ec)
+    {
+    }
+
+    template <typename Sourceable>
+    basic_toon_cursor(std::allocator_arg_t, const TempAlloc& temp_alloc,
+        Sourceable&& source,
+        const toon_decode_options& options,
+        std::error_code& ec)
+        : source_(std::forward<Sourceable>(source)),
+          parser_(options, temp_alloc)
+    {
+        parser_.cursor_mode(true);
+        read_next(ec);
+    }
+
+    ~basic_toon_cursor() = default;
+
+    template <typename Sourceable>
+    void reset(Sourceable&& source)
+    {
+        source_ = std::forward<Sourceable>(source);
+        parser_.reinitialize();
+        events_.clear();
+        done_ = false;
+        read_next();
+    }
+
+    template <typename Sourceable>
+    void reset(Sourceable&& source, std::error_code& ec)
+    {
+        source_ = std::forward<Sourceable>(source);
+        parser_.reinitialize();
+        events_.clear();
+        done_ = false;
+        read_next(ec);
+    }
+
+    bool done() const final
+    {
+        return done_;
+    }
+
+    const basic_staj_event<char>& current() const final
+    {
+        return current_;
+    }
+
+    void read_to(basic_json_visitor<char>& visitor) final
+    {
+        std::error_code ec;
+        read_to(visitor, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec, parser_.line(), parser_.column()));
+        }
+    }
+
+    void read_to(basic_json_visitor<char>& visitor, std::error_code& ec) final
+    {
+        current_.send_json_event(visitor, *this, ec);
+        if (JSONCONS_UNLIKELY(ec) || !is_begin_container(current_.event_type()))
+        {
+            return;
+        }
+        std::size_t level = 1;
+        while (level > 0)
+        {
+            read_next(ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+            if (JSONCONS_UNLIKELY(done_))
+            {
+                ec = toon_errc::unexpected_eof;
+                return;
+            }
+            if (is_begin_container(current_.event_type()))
+            {
+                ++level;
+            }
+            else if (is_end_container(current_.event_type()))
+            {
+                --level;
+            }
+            current_.send_json_event(visitor, *this, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+        }
+    }
+
+    void next() final
+    {
+        read_next();
+    }
+
+    void next(std::error_code& ec) final
+    {
+        read_next(ec);
+    }
+
+    const ser_context& context() const final
+    {
+        return *this;
+    }
+
+    std::size_t line() const final
+    {
+        return parser_.line();
+    }
+
+    std::size_t column() const final
+    {
+        return parser_.column();
+    }
+
+    friend
+    basic_staj_filter_view<char> operator|(basic_toon_cursor& cursor,
+        std::function<bool(const basic_staj_event<char>&, const ser_context&)> pred)
+    {
+        return basic_staj_filter_view<char>(cursor, pred);
+    }
+
+private:
+    void read_next()
+    {
+        std::error_code ec;
+        read_next(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec, parser_.line(), parser_.column()));
+        }
+    }
+
+    void read_next(std::error_code& ec)
+    {
+        while (events_.empty() && !parser_.done())
+        {
+            if (parser_.source_exhausted())
+            {
+                if (source_.eof())
+                {
+                    parser_.finish_parse(events_, ec);
+                }
+                else
+                {
+                    auto s = source_.read_buffer();
+                    if (JSONCONS_UNLIKELY(source_.is_error()))
+                    {
+                        ec = toon_errc::source_error;
+                    }
+                    else
+                    {
+                        parser_.update(s.data(), s.size());
+                    }
+                }
+            }
+            else
+            {
+                parser_.parse_some(events_, ec);
+            }
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+        }
+        if (events_.empty())
+        {
+            done_ = true;
+        }
+        else
+        {
+            current_ = events_.pop();
+        }
+    }
+};
+
+using toon_string_cursor = basic_toon_cursor<jsoncons::string_source<char>>;
+using toon_stream_cursor = basic_toon_cursor<jsoncons::stream_source<char>>;
+
+} // namespace toon
+} // namespace jsoncons
+
+#endif // JSONCONS_TOON_TOON_CURSOR_HPP
@@ -0,0 +1,1175 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_TOON_TOON_ENCODER_HPP
+#define JSONCONS_TOON_TOON_ENCODER_HPP
+
+#include <cctype>
+#include <cmath> // std::isfinite
+#include <cstddef>
+#include <cstdint>
+#include <memory> // std::allocator
+#include <string>
+#include <system_error>
+#include <utility> // std::move
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/json_encoders.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/semantic_tag.hpp>
+#include <jsoncons/ser_utils.hpp>
+#include <jsoncons/sink.hpp>
+#include <jsoncons/utility/byte_string.hpp>
+#include <jsoncons/utility/write_number.hpp>
+
+#include <jsoncons_ext/toon/toon_options.hpp>
+
+namespace jsoncons {
+namespace toon {
+
+JSONCONS_INLINE_CONSTEXPR jsoncons::string_view null_literal{"null", 4};
+JSONCONS_INLINE_CONSTEXPR jsoncons::string_view true_literal{"true", 4};
+JSONCONS_INLINE_CONSTEXPR jsoncons::string_view false_literal{"false", 5};
+
+namespace detail {
+
+enum class format_number_state{value_sign,digits,fraction,exponent_sign,exponent_value,err};
+
+inline
+std::string exponential_to_decimal_notation(jsoncons::string_view str)
+{
+    std::string result;
+
+    std::string num_str;
+    std::string exponent_str;
+
+    bool neg_value = false;
+    bool neg_exp = false;
+
+    std::size_t decimal_places = 0;
+
+    format_number_state state = format_number_state::value_sign;
+    for (std::size_t i = 0; i < str.size();)
+    {
+        char c = str[i];
+        switch (state)
+        {
+            case format_number_state::value_sign:
+                if (c == '-')
+                {
+                    neg_value = true;
+                    ++i;
+                }
+                state = format_number_state::digits;
+                break;
+            case format_number_state::digits:
+                if ((c >= '0' && c <= '9') || c == '-')
+                {
+                    num_str.push_back(c);
+                    ++i;
+                }
+                else if (c == 'e' || c == 'E')
+                {
+                    state = format_number_state::exponent_sign;
+                    ++i;
+                }
+                else if (c == '.')
+                { 
+                    state = format_number_state::fraction;
+                    ++i;
+                }
+                break;
+            case format_number_state::fraction:
+                if ((c >= '0' && c <= '9'))
+                {
+                    ++decimal_places;
+                    num_str.push_back(c);
+                    ++i;
+                }
+                else if (c == 'e' || c == 'E')
+                {
+                    state = format_number_state::exponent_sign;
+                    ++i;
+                }
+                break;
+            case format_number_state::exponent_sign:
+                if (c == '-')
+                {
+                    neg_exp = true;
+                    state = format_number_state::exponent_value;
+                    ++i;
+                }
+                else if (c == '+')
+                {
+                    state = format_number_state::exponent_value;
+                    ++i;
+                }
+                else
+                {
+                    state = format_number_state::exponent_value;
+                }
+                break;
+            case format_number_state::exponent_value:
+                if ((c >= '0' && c <= '9'))
+                {
+                    exponent_str.push_back(c);
+                    ++i;
+                }
+                break;
+            case format_number_state::err:
+                i = str.size();
+                break;
+        }
+    }
+
+    std::size_t exponent;
+    dec_to_integer(exponent_str.data(), exponent_str.size(), exponent);
+
+    std::size_t n = num_str.size();
+
+    if (neg_exp) // shift decimal point left
+    {
+        if ((exponent+decimal_places+1) > n)
+        {
+            num_str.insert(num_str.begin(), ((exponent+decimal_places+1) - n), '0');
+        }
+        std::size_t pos = num_str.size()-(decimal_places+exponent);
+        auto first_non_zero = num_str.find_first_not_of('0', pos);
+        if (first_non_zero ==  std::string::npos)
+        {
+            num_str.erase(num_str.begin()+pos, num_str.end());
+        }
+        else
+        {
+            num_str.insert(num_str.begin()+(num_str.size()-decimal_places-exponent), '.');
+        }
+    }
+    else // shift decimal point right
+    {
+        if (exponent > decimal_places)
+        {
+            num_str.append(exponent - decimal_places, '0');
+        }
+        if (decimal_places > exponent)
+        {
+            num_str.insert(num_str.begin() + (num_str.size() - exponent), '.');
+        }
+    }
+    if (neg_value)
+    {
+        num_str.insert(num_str.begin(), '-');
+    }
+    return num_str;
+}
+
+inline
+bool is_unquoted_key_valid(string_view key)
+{
+    if (key.empty())
+    {
+        return false;
+    }
+    char c = key.front();
+    if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_'))
+    {
+        return false;
+    }
+    for (auto it = key.begin()+1; it != key.end(); ++it)
+    {
+        c = *it;
+        if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || (c >= '0' && c <= '9') || c == '.'))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+enum class is_number_state{initial,negative,digits_or_dot_or_exp,octal,leading_zero, 
+    leading_decimal_zero, decimal_zero, decimal_digit, exponent, digits_or_exp, digits, not_number};
+
+inline
+bool is_number(jsoncons::string_view str) 
+{
+    is_number_state state = is_number_state::initial;
+
+    for (std::size_t i = 0; i < str.size();)
+    {
+        char c = str[i];
+        switch (state)
+        {
+            case is_number_state::initial:
+                if (c == '-')
+                {
+                    state = is_number_state::negative;
+                    ++i;
+                }
+                else if (c == '0')
+                {
+                    state = is_number_state::leading_zero;
+                    ++i;
+                }
+                else 
+                {
+                    state = is_number_state::digits_or_dot_or_exp;
+                }
+                break;
+            case is_number_state::leading_zero:
+                if (c == '.')
+                {
+                    state = is_number_state::decimal_digit;
+                    ++i;
+                }
+                else 
+                {
+                    state = is_number_state::octal;
+                }
+                break;
+            case is_number_state::leading_decimal_zero:
+                if (c == '.')
+                {
+                    state = is_number_state::decimal_digit;
+                    ++i;
+                }
+                else
+                {
+                    state = is_number_state::not_number;
+                }
+                break;
+            case is_number_state::octal:
+                if (!(c >= '0' && c <= '7'))
+                {
+                    state = is_number_state::not_number;
+                }
+                else
+                {
+                    ++i;
+                }
+                break;
+            case is_number_state::negative: 
+                if (c == '0')
+                {
+                    state = is_number_state::leading_decimal_zero;
+                    ++i;
+                }
+                else 
+                {
+                    state = is_number_state::digits_or_dot_or_exp;
+                }
+                break;
+            case is_number_state::decimal_zero: 
+                if (c == '0')
+                {
+                    state = is_number_state::not_number;
+                }
+                else if (c == '.')
+                {
+                    state = is_number_state::decimal_digit;
+                    ++i;
+                }
+                else if (c == 'e' || c == 'E')
+                {
+                    state = is_number_state::digits_or_dot_or_exp;
+                    ++i;
+                }
+                else if (c >= '1' && c <= '9')
+                {
+                    state = is_number_state::digits_or_dot_or_exp;
+                    ++i;
+                }
+                else
+                {
+                    state = is_number_state::not_number;
+                }
+                break;
+            case is_number_state::decimal_digit:
+                if (c >= '0' && c <= '9')
+                {
+                    state = is_number_state::digits_or_exp;
+                    ++i;
+                }
+                else
+                {
+                    state = is_number_state::not_number;
+                }
+                break;
+            case is_number_state::digits_or_dot_or_exp: 
+                if (c == '.')
+                {
+                    state = is_number_state::decimal_digit;
+                    ++i;
+                }
+                else if (c == 'e' || c == 'E')
+                {
+                    state = is_number_state::exponent;
+                    ++i;
+                }
+                else if (!(c >= '0' && c <= '9'))
+                {
+                    state = is_number_state::not_number;
+                }
+                else
+                {
+                    ++i;
+                }
+                break;
+            case is_number_state::digits_or_exp: 
+                if (c == 'e' || c == 'E')
+                {
+                    state = is_number_state::exponent;
+                    ++i;
+                }
+                else if (!(c >= '0' && c <= '9'))
+                {
+                    state = is_number_state::not_number;
+                }
+                else
+                {
+                    ++i;
+                }
+                break;
+            case is_number_state::exponent: 
+                if ((c >= '0' && c <= '9') || c == '-')
+                {
+                    state = is_number_state::digits;
+                    ++i;
+                }
+                else
+                {
+                    state = is_number_state::not_number;
+                }
+                break;
+            case is_number_state::digits: 
+                if (!(c >= '0' && c <= '9'))
+                {
+                    state = is_number_state::not_number;
+                }
+                else
+                {
+                    ++i;
+                }
+                break;
+            default:
+                i = str.size();
+                break;
+        }
+    }
+    if (state == is_number_state::digits_or_dot_or_exp || state == is_number_state::octal 
+        || state == is_number_state::decimal_zero 
+        || state == is_number_state::digits_or_exp || state == is_number_state::digits
+        || state == is_number_state::leading_zero || state == is_number_state::leading_decimal_zero)
+    {
+        return true;
+    }
+    return false;
+}
+
+inline
+bool is_unquoted_safe(jsoncons::string_view str, char delimiter = ',')
+{
+    if (str.empty())
+    {
+        return false;
+    }
+    if (std::isspace(static_cast<unsigned char>(str.front())) || std::isspace(static_cast<unsigned char>(str.back())))
+    {
+        return false;
+    }
+    if (is_number(str))
+    {
+        return false;
+    }
+    if (str == null_literal || str == true_literal || str == false_literal)
+    {
+        return false;
+    }
+    if (str.front() == '-')
+    {
+        return false;
+    }
+    for (auto c : str)
+    {
+        switch (c)
+        {
+            case ':':
+            case '[':
+            case ']':
+            case '{':
+            case '}':
+            case '\"':
+            case '\\':
+            case '\n':
+            case '\r':
+            case '\t':
+                return false;
+        }
+        if (c == delimiter)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Sink>
+void encode_string(jsoncons::string_view str, char delimiter, Sink& sink)
+{
+    if (is_unquoted_safe(str, delimiter))
+    {
+        sink.append(str.data(), str.size());
+    }
+    else
+    {
+        sink.push_back('\"');
+        jsoncons::detail::escape_string(str.data(), str.size(), false, false, sink);
+        sink.push_back('\"');
+    }
+}
+
+template <typename Sink>
+void encode_key(jsoncons::string_view key, Sink& sink)
+{
+    if (is_unquoted_key_valid(key))
+    {
+        sink.append(key.data(), key.size());
+    }
+    else
+    {
+        sink.push_back('\"');
+        jsoncons::detail::escape_string(key.data(), key.size(), false, false, sink);
+        sink.push_back('\"');
+    }
+}
+
+enum class toon_node_kind : uint8_t {literal, string, array, object};
+
+// A value of the array being encoded. Literals hold their TOON text, strings their unescaped text.
+// Arrays record the kinds of their items as they are added, and whether their items are objects
+// with the same keys and primitive values, so tabular form is decided in one pass.
+template <typename Allocator>
+struct toon_node
+{
+    using char_allocator_type = typename std::allocator_traits<Allocator>:: template rebind_alloc<char>;
+    using string_type = std::basic_string<char,std::char_traits<char>,char_allocator_type>;
+
+    toon_node_kind kind;
+    string_type key;
+    string_type text;
+    std::size_t end{0}; // one past the last node of the value
+    std::size_t size{0}; // number of items or members
+    bool all_primitives{true};
+    bool all_arrays{true};
+    bool all_objects{true};
+    bool same_fields{true};
+
+    toon_node(toon_node_kind kind, const Allocator& alloc)
+        : kind(kind), key(alloc), text(alloc)
+    {
+    }
+
+    bool is_container() const
+    {
+        return kind == toon_node_kind::array || kind == toon_node_kind::object;
+    }
+
+    bool is_tabular() const
+    {
+        return kind == toon_node_kind::array && size > 0 && all_objects && same_fields;
+    }
+};
+
+} // namespace detail
+
+// Writes TOON text from a stream of events. Objects outside arrays are written as their members
+// arrive. An array is held until it ends, because its header gives its length, and its form
+// (inline, tabular or list) depends on its items.
+template <typename Sink=jsoncons::stream_sink<char>,typename Allocator=std::allocator<char>>
+class basic_toon_encoder final : public basic_json_visitor<char>
+{
+public:
+    using char_type = char;
+    using typename basic_json_visitor<char>::string_view_type;
+    using sink_type = Sink;
+    using allocator_type = Allocator;
+    using char_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<char>;
+    using string_type = std::basic_string<char, std::char_traits<char>, char_allocator_type>;
+private:
+    using node_type = detail::toon_node<allocator_type>;
+    using node_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<node_type>;
+    using size_t_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<std::size_t>;
+
+    Sink sink_;
+    std::size_t indent_;
+    char delimiter_;
+    jsoncons::optional<char> length_marker_;
+    allocator_type alloc_;
+    jsoncons::write_double fp_;
+    std::vector<std::size_t,size_t_allocator_type> stack_; // member depth of each open object outside an array
+    std::vector<node_type,node_allocator_type> nodes_;
+    std::vector<std::size_t,size_t_allocator_type> open_; // open containers in nodes_
+    std::vector<std::size_t,size_t_allocator_type> matched_; // fields of the first row matched by the current row
+    string_type key_;
+    string_type buffer_;
+    std::size_t array_depth_{0};
+    std::size_t line_{0};
+
+    // Noncopyable and nonmoveable
+    basic_toon_encoder(const basic_toon_encoder&) = delete;
+    basic_toon_encoder& operator=(const basic_toon_encoder&) = delete;
+public:
+    basic_toon_encoder(Sink&& sink, const Allocator& alloc = Allocator())
+       : basic_toon_encoder(std::forward<Sink>(sink), toon_encode_options(), alloc)
+    {
+    }
+
+    basic_toon_encoder(Sink&& sink,
+        const toon_encode_options& options,
+        const Allocator& alloc = Allocator())
+      : sink_(std::forward<Sink>(sink)),
+        indent_(options.indent()),
+        delimiter_(static_cast<char>(options.delimiter())),
+        length_marker_(options.length_marker()),
+        alloc_(alloc),
+        fp_(float_chars_format::general, 0),
+        stack_(alloc),
+        nodes_(alloc),
+        open_(alloc),
+        matched_(alloc),
+        key_(alloc),
+        buffer_(alloc)
+    {
+    }
+
+    ~basic_toon_encoder() noexcept
+    {
+        JSONCONS_TRY
+        {
+            sink_.flush();
+        }
+        JSONCONS_CATCH(...)
+        {
+        }
+    }
+
+    void reset()
+    {
+        stack_.clear();
+        nodes_.clear();
+        open_.clear();
+        line_ = 0;
+    }
+
+    void reset(Sink&& sink)
+    {
+        sink_ = std::move(sink);
+        reset();
+    }
+
+private:
+    void visit_flush() final
+    {
+        sink_.flush();
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_begin_object(semantic_tag, const ser_context&, std::error_code&) final
+    {
+        if (!nodes_.empty())
+        {
+            begin_node(detail::toon_node_kind::object);
+        }
+        else if (stack_.empty())
+        {
+            stack_.push_back(0);
+        }
+        else
+        {
+            std::size_t depth = stack_.back();
+            begin_line(depth);
+            detail::encode_key(key_, sink_);
+            sink_.push_back(':');
+            stack_.push_back(depth+1);
+        }
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_end_object(const ser_context&, std::error_code&) final
+    {
+        if (!nodes_.empty())
+        {
+            end_node();
+        }
+        else
+        {
+            stack_.pop_back();
+            if (stack_.empty())
+            {
+                sink_.flush();
+            }
+        }
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_begin_array(semantic_tag, const ser_context&, std::error_code&) final
+    {
+        if (nodes_.empty())
+        {
+            array_depth_ = stack_.empty() ? 0 : stack_.back();
+        }
+        begin_node(detail::toon_node_kind::array);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_end_array(const ser_context&, std::error_code&) final
+    {
+        end_node();
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_key(const string_view_type& name, const ser_context&, std::error_code&) final
+    {
+        key_.assign(name.data(), name.size());
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_null(semantic_tag, const ser_context&, std::error_code&) final
+    {
+        write_value(detail::toon_node_kind::literal, null_literal);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_bool(bool value, semantic_tag, const ser_context&, std::error_code&) final
+    {
+        write_value(detail::toon_node_kind::literal, value ? true_literal : false_literal);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_string(const string_view_type& value, semantic_tag tag, const ser_context&, std::error_code&) final
+    {
+        if (is_number_tag(tag))
+        {
+            write_number(value);
+        }
+        else
+        {
+            write_value(detail::toon_node_kind::string, value);
+        }
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view& value, semantic_tag tag, const ser_context&, std::error_code&) final
+    {
+        buffer_.clear();
+        switch (tag)
+        {
+            case semantic_tag::base16:
+                bytes_to_base16(value.begin(), value.end(), buffer_);
+                break;
+            case semantic_tag::base64:
+                bytes_to_base64(value.begin(), value.end(), buffer_);
+                break;
+            default:
+                bytes_to_base64url(value.begin(), value.end(), buffer_);
+                break;
+        }
+        write_value(detail::toon_node_kind::string, buffer_);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_int64(int64_t value, semantic_tag, const ser_context&, std::error_code&) final
+    {
+        buffer_.clear();
+        jsoncons::from_integer(value, buffer_);
+        write_value(detail::toon_node_kind::literal, buffer_);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_uint64(uint64_t value, semantic_tag, const ser_context&, std::error_code&) final
+    {
+        buffer_.clear();
+        jsoncons::from_integer(value, buffer_);
+        write_value(detail::toon_node_kind::literal, buffer_);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_double(double value, semantic_tag, const ser_context&, std::error_code&) final
+    {
+        if (JSONCONS_UNLIKELY(!std::isfinite(value)))
+        {
+            write_value(detail::toon_node_kind::literal, null_literal);
+        }
+        else
+        {
+            buffer_.clear();
+            fp_(value, buffer_);
+            write_number(buffer_);
+        }
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    // Numbers are written in decimal notation
+    void write_number(jsoncons::string_view s)
+    {
+        bool exponential_notation = false;
+        for (auto c : s)
+        {
+            if (c == 'e' || c == 'E')
+            {
+                exponential_notation = true;
+                break;
+            }
+        }
+        if (exponential_notation)
+        {
+            auto dec_str = detail::exponential_to_decimal_notation(s);
+            write_value(detail::toon_node_kind::literal, dec_str);
+        }
+        else
+        {
+            write_value(detail::toon_node_kind::literal, s);
+        }
+    }
+
+    void write_value(detail::toon_node_kind kind, jsoncons::string_view value)
+    {
+        if (!nodes_.empty())
+        {
+            node_type& node = begin_node(kind);
+            node.text.assign(value.data(), value.size());
+            node.end = nodes_.size();
+        }
+        else if (stack_.empty())
+        {
+            write_primitive(kind, value);
+            sink_.flush();
+        }
+        else
+        {
+            begin_line(stack_.back());
+            detail::encode_key(key_, sink_);
+            sink_.push_back(':');
+            sink_.push_back(' ');
+            write_primitive(kind, value);
+        }
+    }
+
+    node_type& begin_node(detail::toon_node_kind kind)
+    {
+        std::size_t index = nodes_.size();
+        nodes_.emplace_back(kind, alloc_);
+        bool is_container = nodes_.back().is_container();
+        if (open_.empty())
+        {
+            if (!stack_.empty())
+            {
+                nodes_.back().key = key_;
+            }
+        }
+        else if (nodes_[open_.back()].kind == detail::toon_node_kind::array)
+        {
+            node_type& parent = nodes_[open_.back()];
+            switch (kind)
+            {
+                case detail::toon_node_kind::array:
+                    parent.all_primitives = false;
+                    parent.all_objects = false;
+                    break;
+                case detail::toon_node_kind::object:
+                    parent.all_primitives = false;
+                    parent.all_arrays = false;
+                    if (parent.same_fields && parent.size > 0)
+                    {
+                        matched_.clear();
+                    }
+                    break;
+                default:
+                    parent.all_arrays = false;
+                    parent.all_objects = false;
+                    break;
+            }
+            ++parent.size;
+        }
+        else
+        {
+            nodes_.back().key = key_;
+            match_field(is_container);
+            ++nodes_[open_.back()].size;
+        }
+        if (is_container)
+        {
+            open_.push_back(index);
+        }
+        return nodes_.back();
+    }
+
+    // Checks a member of an object that is an item of an array against the fields of the first item
+    void match_field(bool is_container)
+    {
+        if (open_.size() < 2)
+        {
+            return;
+        }
+        std::size_t row = open_.back();
+        std::size_t index = open_[open_.size()-2];
+        node_type& parent = nodes_[index];
+        if (parent.kind != detail::toon_node_kind::array || !parent.same_fields)
+        {
+            return;
+        }
+        if (is_container)
+        {
+            parent.same_fields = false;
+            return;
+        }
+        if (row == index+1)
+        {
+            return;
+        }
+        // The members of the first row are primitives that follow it
+        const std::size_t first = index+2;
+        const std::size_t num_fields = nodes_[index+1].size;
+        std::size_t pos = nodes_[row].size;
+        if (pos >= num_fields || nodes_[first+pos].key != key_)
+        {
+            pos = 0;
+            while (pos < num_fields && nodes_[first+pos].key != key_)
+            {
+                ++pos;
+            }
+        }
+        if (pos == num_fields)
+        {
+            parent.same_fields = false;
+            return;
+        }
+        for (auto i : matched_)
+        {
+            if (i == pos)
+            {
+                parent.same_fields = false;
+                return;
+            }
+        }
+        matched_.push_back(pos);
+    }
+
+    void end_node()
+    {
+        std::size_t index = open_.back();
+        open_.pop_back();
+        nodes_[index].end = nodes_.size();
+        if (!open_.empty() && nodes_[index].kind == detail::toon_node_kind::object)
+        {
+            node_type& parent = nodes_[open_.back()];
+            if (parent.kind == detail::toon_node_kind::array && parent.same_fields)
+            {
+                // Every row has the members of the first row, which must have at least one
+                std::size_t num_fields = nodes_[open_.back()+1].size;
+                if (num_fields == 0 || nodes_[index].size != num_fields)
+                {
+                    parent.same_fields = false;
+                }
+            }
+        }
+        if (open_.empty())
+        {
+            if (stack_.empty())
+            {
+                write_array(0, array_depth_, jsoncons::optional<jsoncons::string_view>{});
+            }
+            else
+            {
+                write_array(0, array_depth_, key_of(0));
+            }
+            nodes_.clear();
+            if (stack_.empty())
+            {
+                sink_.flush();
+            }
+        }
+    }
+
+    jsoncons::string_view key_of(std::size_t index) const
+    {
+        return jsoncons::string_view(nodes_[index].key.data(), nodes_[index].key.size());
+    }
+
+    void begin_line(std::size_t depth)
+    {
+        if (line_ != 0)
+        {
+            sink_.push_back('\n');
+        }
+        ++line_;
+        sink_.append(depth*indent_, ' ');
+    }
+
+    void write_primitive(detail::toon_node_kind kind, jsoncons::string_view value)
+    {
+        if (kind == detail::toon_node_kind::string)
+        {
+            detail::encode_string(value, delimiter_, sink_);
+        }
+        else
+        {
+            sink_.append(value.data(), value.size());
+        }
+    }
+
+    void write_primitive(const node_type& node)
+    {
+        write_primitive(node.kind, jsoncons::string_view(node.text.data(), node.text.size()));
+    }
+
+    void write_header(jsoncons::optional<jsoncons::string_view> key, std::size_t index)
+    {
+        const node_type& node = nodes_[index];
+        if (key)
+        {
+            detail::encode_key(*key, sink_);
+        }
+        sink_.push_back('[');
+        if (length_marker_)
+        {
+            sink_.push_back(*length_marker_);
+        }
+        jsoncons::from_integer(node.size, sink_);
+        if (delimiter_ != ',')
+        {
+            sink_.push_back(delimiter_);
+        }
+        sink_.push_back(']');
+        if (node.is_tabular())
+        {
+            sink_.push_back('{');
+            const std::size_t first = index+2;
+            for (std::size_t i = 0; i < nodes_[index+1].size; ++i)
+            {
+                if (i > 0)
+                {
+                    sink_.push_back(delimiter_);
+                }
+                detail::encode_key(key_of(first+i), sink_);
+            }
+            sink_.push_back('}');
+        }
+        sink_.push_back(':');
+    }
+
+    void write_array(std::size_t index, std::size_t depth, jsoncons::optional<jsoncons::string_view> key)
+    {
+        const node_type& node = nodes_[index];
+        begin_line(depth);
+        write_header(key, index);
+        if (node.size == 0)
+        {
+            return;
+        }
+        if (node.all_primitives)
+        {
+            write_inline_items(index);
+        }
+        else if (node.all_arrays)
+        {
+            write_array_items(index, depth);
+        }
+        else if (node.is_tabular())
+        {
+            write_rows(index, depth);
+        }
+        else
+        {
+            write_list_items(index, depth, true);
+        }
+    }
+
+    // The items of an array whose header has been written
+    void write_array_content(std::size_t index, std::size_t depth)
+    {
+        const node_type& node = nodes_[index];
+        if (node.all_primitives)
+        {
+            write_inline_items(index);
+        }
+        else if (node.all_arrays)
+        {
+            write_array_items(index, depth);
+        }
+        else if (node.is_tabular())
+        {
+            write_rows(index, depth);
+        }
+        else
+        {
+            write_list_items(index, depth, false);
+        }
+    }
+
+    void write_inline_items(std::size_t index)
+    {
+        bool first = true;
+        for (std::size_t i = index+1; i < nodes_[index].end; i = nodes_[i].end)
+        {
+            sink_.push_back(first ? ' ' : delimiter_);
+            first = false;
+            write_primitive(nodes_[i]);
+        }
+    }
+
+    void write_array_items(std::size_t index, std::size_t depth)
+    {
+        for (std::size_t i = index+1; i < nodes_[index].end; i = nodes_[i].end)
+        {
+            if (nodes_[i].all_primitives)
+            {
+                begin_line(depth+1);
+                sink_.push_back('-');
+                sink_.push_back(' ');
+                write_header(jsoncons::optional<jsoncons::string_view>{}, i);
+                write_inline_items(i);
+            }
+            else
+            {
+                write_array(i, depth+1, jsoncons::optional<jsoncons::string_view>{});
+            }
+        }
+    }
+
+    void write_rows(std::size_t index, std::size_t depth)
+    {
+        const std::size_t first = index+2;
+        const std::size_t num_fields = nodes_[index+1].size;
+        for (std::size_t row = index+1; row < nodes_[index].end; row = nodes_[row].end)
+        {
+            begin_line(depth+1);
+            for (std::size_t i = 0; i < num_fields; ++i)
+            {
+                if (i > 0)
+                {
+                    sink_.push_back(delimiter_);
+                }
+                const auto& field = nodes_[first+i].key;
+                std::size_t pos = row+1+i;
+                if (nodes_[pos].key != field)
+                {
+                    pos = row+1;
+                    while (nodes_[pos].key != field)
+                    {
+                        ++pos;
+                    }
+                }
+                write_primitive(nodes_[pos]);
+            }
+        }
+    }
+
+    // List items; arrays of arrays and mixed arrays are written as "- " items only
+    // when the enclosing array's header has just been written by write_array
+    void write_list_items(std::size_t index, std::size_t depth, bool dash_arrays)
+    {
+        for (std::size_t i = index+1; i < nodes_[index].end; i = nodes_[i].end)
+        {
+            const node_type& item = nodes_[i];
+            switch (item.kind)
+            {
+                case detail::toon_node_kind::object:
+                    write_object_as_list_item(i, depth+1);
+                    break;
+                case detail::toon_node_kind::array:
+                    if (dash_arrays)
+                    {
+                        begin_line(depth+1);
+                        sink_.push_back('-');
+                        sink_.push_back(' ');
+                        write_header(jsoncons::optional<jsoncons::string_view>{}, i);
+                        write_array_content(i, depth+1);
+                    }
+                    else
+                    {
+                        write_array(i, depth+1, jsoncons::optional<jsoncons::string_view>{});
+                    }
+                    break;
+                default:
+                    begin_line(depth+1);
+                    sink_.push_back('-');
+                    sink_.push_back(' ');
+                    write_primitive(item);
+                    break;
+            }
+        }
+    }
+
+    void write_object_as_list_item(std::size_t index, std::size_t depth)
+    {
+        const node_type& node = nodes_[index];
+        begin_line(depth);
+        sink_.push_back('-');
+        if (node.size == 0)
+        {
+            return;
+        }
+        std::size_t first = index+1;
+        const node_type& member = nodes_[first];
+        switch (member.kind)
+        {
+            case detail::toon_node_kind::array:
+                sink_.push_back(' ');
+                write_header(key_of(first), first);
+                write_array_content(first, depth+1);
+                break;
+            case detail::toon_node_kind::object:
+                write_member(first, depth+1);
+                break;
+            default:
+                sink_.push_back(' ');
+                detail::encode_key(key_of(first), sink_);
+                sink_.push_back(':');
+                sink_.push_back(' ');
+                write_primitive(member);
+                break;
+        }
+        for (std::size_t i = member.end; i < node.end; i = nodes_[i].end)
+        {
+            write_member(i, depth+1);
+        }
+    }
+
+    void write_member(std::size_t index, std::size_t depth)
+    {
+        const node_type& node = nodes_[index];
+        switch (node.kind)
+        {
+            case detail::toon_node_kind::array:
+                write_array(index, depth, key_of(index));
+                break;
+            case detail::toon_node_kind::object:
+                begin_line(depth);
+                detail::encode_key(key_of(index), sink_);
+                sink_.push_back(':');
+                for (std::size_t i = index+1; i < node.end; i = nodes_[i].end)
+                {
+                    write_member(i, depth+1);
+                }
+                break;
+            default:
+                begin_line(depth);
+                detail::encode_key(key_of(index), sink_);
+                sink_.push_back(':');
+                sink_.push_back(' ');
+                write_primitive(node);
+                break;
+        }
+    }
+};
+
+using toon_stream_encoder = basic_toon_encoder<jsoncons::stream_sink<char>>;
+using toon_string_encoder = basic_toon_encoder<jsoncons::string_sink<std::string>>;
+
+} // namespace toon
+} // namespace jsoncons
+
+#endif // JSONCONS_TOON_TOON_ENCODER_HPP
@@ -0,0 +1,1741 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_TOON_TOON_PARSER_HPP
+#define JSONCONS_TOON_TOON_PARSER_HPP
+
+#include <algorithm> // std::find
+#include <cmath> // std::floor
+#include <cstddef>
+#include <cstring> // std::memchr
+#include <memory> // std::allocator
+#include <string>
+#include <system_error>
+#include <utility> // std::move
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/json_type.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/ser_utils.hpp>
+#include <jsoncons/utility/read_number.hpp>
+#include <jsoncons/utility/string_utils.hpp>
+#include <jsoncons_ext/toon/toon_error.hpp>
+#include <jsoncons_ext/toon/toon_options.hpp>
+
+namespace jsoncons {
+namespace toon {
+
+inline
+bool starts_with(jsoncons::span<char> sv, jsoncons::span<char> prefix)
+{
+    if (JSONCONS_UNLIKELY(sv.size() < prefix.size()))
+    {
+        return false;
+    }
+    const char* p = sv.data();
+    const char* q = prefix.data();
+    const char* last = prefix.data() + prefix.size();
+
+    while (q < last)
+    {
+        if (*q++ != *p++)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline
+bool starts_with(jsoncons::span<char> s, char* prefix)
+{
+    return starts_with(s, jsoncons::span<char>(prefix,strlen(prefix)));
+}
+
+inline
+bool starts_with(jsoncons::span<char> s, char prefix)
+{
+    return starts_with(s, jsoncons::span<char>(&prefix, 1));
+}
+
+inline
+bool ends_with(jsoncons::span<char> sv, jsoncons::span<char> suffix)
+{
+    if (JSONCONS_UNLIKELY(sv.size() < suffix.size()))
+    {
+        return false;
+    }
+    const char* p = sv.data() + (sv.size() - suffix.size());
+    const char* q = suffix.data();
+    const char* last = suffix.data() + suffix.size();
+
+    while (q < last)
+    {
+        if (*q++ != *p++)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline
+bool ends_with(jsoncons::span<char> s, char* suffix)
+{
+    return ends_with(s, jsoncons::span<char>(suffix, strlen(suffix)));
+}
+
+inline
+bool ends_with(jsoncons::span<char> s, char suffix)
+{
+    return ends_with(s, jsoncons::span<char>(&suffix, 1));
+}
+
+inline
+jsoncons::span<char> strip(jsoncons::span<char> sv)
+{
+    char* first = sv.data();
+    char* last = first + sv.size();
+    char* p = first;
+
+    while (p < last)
+    {
+        char c = *p;
+        if (!(c == ' ' || c == '\t' || c == '\n' || c == '\r'))
+        {
+            break;
+        }
+        ++p;
+    }
+    if (p == last)
+    {
+        return jsoncons::span<char>{};
+    }
+
+    char* q = last;
+    do
+    {
+        --q;
+        char c = *q;
+        if (!(c == ' ' || c == '\t' || c == '\n' || c == '\r'))
+        {
+            break;
+        }
+    } while (q > p);
+
+    std::size_t size = (p - first) + ((last-q)-1);
+    return jsoncons::span<char>{p, sv.size() - size};
+}
+
+inline
+jsoncons::expected<jsoncons::string_view,toon_errc> unescape_string(jsoncons::span<char> value)
+{
+    using result_type = jsoncons::expected<jsoncons::string_view,toon_errc>;
+
+    char* cur = value.data(); 
+    char* end = cur + value.size();
+
+    while (cur < end)
+    {
+        if (*cur == '\\')
+        {
+            goto copy_escape;
+        }
+        ++cur;
+    }
+    return result_type{jsoncons::string_view{value.data(), value.size()}};
+
+copy_escape:
+
+    char* dst = cur;
+
+    while (cur < end)
+    {
+        if (*cur == '\\')
+        {
+            if (cur + 1 == end)
+            {
+                return result_type{jsoncons::unexpect, toon_errc::invalid_escape_sequence};
+            }
+            char next_char = *(cur+1);
+            if (next_char == 'n')
+            {
+                *dst++ = '\n';
+                cur += 2;
+                continue;
+            }
+            if (next_char == 't')
+            {
+                *dst++ = '\t';
+                cur += 2;
+                continue;
+            }
+            if (next_char == 'r')
+            {
+                *dst++ = '\r';
+                cur += 2;
+                continue;
+            }
+            if (next_char == '\\')
+            {
+                *dst++ = '\\';
+                cur += 2;
+                continue;
+            }
+            if (next_char == '\"')
+            {
+                *dst++ = '\"';
+                cur += 2;
+                continue;
+            }
+            return result_type{jsoncons::unexpect, toon_errc::invalid_escape_sequence};
+        }
+        *dst++ = *cur++;
+    }
+
+    return result_type{jsoncons::string_view{value.data(), std::size_t(dst - value.data())}
+};
+}
+
+enum class parse_number_state{sign,zero,digits,fraction,exponent_sign,exponent_value,err};
+
+inline
+jsoncons::expected<void,std::error_code> parse_primitive(jsoncons::span<char> token, jsoncons::json_visitor& visitor)
+{
+    using result_type = jsoncons::expected<void,std::error_code>;
+
+    token = strip(token);
+
+    if (token.empty())
+    {
+        visitor.string_value(jsoncons::string_view{});
+        return result_type{};
+    }
+
+    if (starts_with(token, '\"'))
+    {
+        if (!ends_with(token, '\"') || token.size() < 2)
+        {
+            return result_type{jsoncons::unexpect, toon_errc::missing_closing_quote};
+        }
+        auto result = unescape_string(jsoncons::span<char>(token.data()+1, token.size()-2));
+        if (!result)
+        {
+            return result_type{jsoncons::unexpect, result.error()};
+        }
+        visitor.string_value(*result);
+        return result_type{};
+    }
+    if (token.size() == 4 && token[0] == 't' &&  token[1] == 'r' && token[2] == 'u' &&  token[3] == 'e')
+    {
+        visitor.bool_value(true);
+        return result_type{};
+    }
+    if (token.size() == 5 && token[0] == 'f' &&  token[1] == 'a' && token[2] == 'l' &&  token[3] == 's' &&  token[4] == 'e')
+    {
+        visitor.bool_value(false);
+        return result_type{};
+    }
+    if (token.size() == 4 && token[0] == 'n' &&  token[1] == 'u' && token[2] == 'l' &&  token[3] == 'l')
+    {
+        visitor.null_value();
+        return result_type{};
+    }
+
+    std::string num_str;
+    std::string exponent_str;
+
+    bool neg_value = false;
+    bool neg_exp = false;
+    bool not_a_number = false;
+
+    std::size_t decimal_places = 0;
+
+    parse_number_state state = parse_number_state::sign;
+    for (std::size_t i = 0; i < token.size() && !not_a_number;)
+    {
+        char c = token[i];
+        switch (state)
+        {
+            case parse_number_state::sign:
+                if (c == '-')
+                {
+                    neg_value = true;
+                    ++i;
+                }
+                if (i < token.size() && token[i] == '0')
+                {
+                    num_str.push_back('0');
+                    state = parse_number_state::zero;
+                    if (++i == token.size())
+                    {
+                        neg_value = false;
+                    }
+                }
+                else
+                {
+                    state = parse_number_state::digits;
+                }
+                break;
+            case parse_number_state::zero:
+                if (c == '.')
+                {
+                    state = parse_number_state::digits;
+                    ++i;
+                }
+                else
+                {
+                    if ((token.size() - i) == 2 && (token[i] == 'e' || token[i] == 'E') && token[i + 1] == '1')
+                    {
+                        num_str.push_back('0');
+                        i += 2;
+                    }
+                    else
+                    {
+                        not_a_number = true;
+                    }
+                }
+                break;
+            case parse_number_state::digits:
+                if ((c >= '0' && c <= '9') || c == '-')
+                {
+                    num_str.push_back(c);
+                    ++i;
+                }
+                else if (c == 'e' || c == 'E')
+                {
+                    state = parse_number_state::exponent_sign;
+                    ++i;
+                }
+                else if (c == '.')
+                { 
+                    state = parse_number_state::fraction;
+                    ++i;
+                }
+                else
+                {
+                    not_a_number = true;
+                }
+                break;
+            case parse_number_state::fraction:
+                if ((c >= '0' && c <= '9'))
+                {
+                    ++decimal_places;
+                    num_str.push_back(c);
+                    ++i;
+                }
+                else if (c == 'e' || c == 'E')
+                {
+                    state = parse_number_state::exponent_sign;
+                    ++i;
+                }
+                else
+                {
+                    not_a_number = true;
+                }
+                break;
+            case parse_number_state::exponent_sign:
+                if (c == '-')
+                {
+                    neg_exp = true;
+                    state = parse_number_state::exponent_value;
+                    ++i;
+                }
+                else if (c == '+')
+                {
+                    state = parse_number_state::exponent_value;
+                    ++i;
+                }
+                else
+                {
+                    state = parse_number_state::exponent_value;
+                }
+                break;
+            case parse_number_state::exponent_value:
+                if ((c >= '0' && c <= '9'))
+                {
+                    exponent_str.push_back(c);
+                    ++i;
+                }
+                else
+                {
+                    not_a_number = true;
+                }
+                break;
+            case parse_number_state::err:
+                i = token.size();
+                break;
+            default:
+                not_a_number = true;
+                break;
+        }
+    }
+
+    if (not_a_number)
+    {
+        visitor.string_value(jsoncons::string_view(token.data(), token.size()));
+        return result_type{};
+    }
+
+    if (!exponent_str.empty())
+    {
+        std::size_t exponent;
+        auto r = dec_to_integer(exponent_str.data(), exponent_str.size(), exponent);
+        JSONCONS_ASSERT(r);
+
+        std::size_t n = num_str.size();
+
+        if (neg_exp) // shift decimal point left
+        {
+            if ((exponent+decimal_places+1) > n)
+            {
+                num_str.insert(num_str.begin(), ((exponent+decimal_places+1) - n), '0');
+            }
+            std::size_t pos = num_str.size() - (decimal_places + exponent);
+            auto first_non_zero = num_str.find_first_not_of('0', pos);
+            if (first_non_zero == std::string::npos)
+            {
+                num_str.erase(num_str.begin() + pos, num_str.end());
+            }
+            else
+            {
+                num_str.insert(num_str.begin() + (num_str.size() - decimal_places - exponent), '.');
+            }
+        }
+        else // shift decimal point right
+        {
+            if (exponent > decimal_places)
+            {
+                num_str.append(exponent - decimal_places, '0');
+            }
+            if (decimal_places > exponent)
+            {
+                num_str.insert(num_str.begin() + (num_str.size() - (decimal_places- exponent)), '.');
+            }
+        }
+    }
+    else
+    {
+        if (decimal_places > 0)
+        {
+            num_str.insert(num_str.begin() + (num_str.size()-decimal_places), '.');
+        }
+
+    }
+    if (neg_value)
+    {
+        num_str.insert(num_str.begin(), '-');
+    }
+
+    if (not_a_number)
+    {
+        visitor.string_value(jsoncons::string_view(token.data(), token.size()));
+        return result_type{};
+    }
+    else
+    {
+
+        std::uint64_t u64;
+        auto ru64 = jsoncons::to_integer(num_str.data(), num_str.size(), u64);
+        if (ru64)
+        {
+            visitor.uint64_value(u64);
+            return result_type{};
+        }
+        std::int64_t i64;
+        auto ri64 = jsoncons::to_integer(num_str.data(), num_str.size(), i64);
+        if (ri64)
+        {
+            visitor.int64_value(i64);
+            return result_type{};
+        }
+
+        double d;
+        auto rd = jsoncons::decstr_to_double(num_str.data(), num_str.size(), d);
+        if (rd)
+        {
+            visitor.double_value(d);
+            return result_type{};
+        }
+
+        visitor.string_value(jsoncons::string_view(token.data(), token.size()));
+    }
+
+    return result_type{};
+}
+
+struct header_info
+{
+    jsoncons::optional<jsoncons::string_view> key;
+    std::size_t length{0};
+    char delimiter{','};
+    std::vector<jsoncons::string_view> fields;
+};
+
+using header_result = jsoncons::expected<jsoncons::optional<header_info>, std::error_code>;
+
+inline
+std::size_t find_unquoted_char(jsoncons::span<char> line, 
+    char target_char,
+    std::size_t start=0)
+{
+    bool in_quotes = false;
+    std::size_t index = jsoncons::string_view::npos;
+    bool done = false;
+    for (std::size_t i = start; !done && i < line.size(); ++i)
+    {
+        char c = line[i];
+        if (!in_quotes && c == '\"')
+        {
+            in_quotes = true;
+        }
+        else if (in_quotes && c == '\\' && i+1 < line.size())
+        {
+            ++i;
+        }
+        else if (in_quotes && c == '\"')
+        {
+            in_quotes = false;
+        }
+        if (!in_quotes && line[i] == target_char)
+        {
+            index = i;
+            done = true;
+        }
+    }
+    return index;
+}
+
+inline 
+jsoncons::expected<std::pair<jsoncons::span<char>,jsoncons::span<char>>,std::error_code> split_key_value(jsoncons::span<char> line)
+{
+    using result_type = jsoncons::expected<std::pair<jsoncons::span<char>,jsoncons::span<char>>,std::error_code>;
+
+    auto colon_idx = find_unquoted_char(line, ':');
+    if (colon_idx == jsoncons::string_view::npos)
+    {
+        return result_type{jsoncons::unexpect, toon_errc::missing_colon};
+    }
+    return result_type{std::make_pair(
+        strip(jsoncons::span<char>{line.data(),colon_idx}),
+        strip(jsoncons::span<char>{line.data()+(colon_idx+1), line.size()-(colon_idx+1)}))
+    };
+}
+
+inline
+jsoncons::expected<jsoncons::string_view, toon_errc> parse_key(jsoncons::span<char> key_str)
+{
+    using result_type = jsoncons::expected<jsoncons::string_view, toon_errc>;
+
+    bool in_quotes{false};
+    std::size_t start{0};
+    std::size_t end{0};
+
+    std::size_t i = 0;
+    while (i < key_str.size() && key_str[i] == ' ')
+    {
+        ++start;
+    }
+
+    for (; i < key_str.size(); ++i)
+    {
+        char c = key_str[i];
+        if (!in_quotes && c == '\"')
+        {
+            start = i + 1;
+            in_quotes = true;
+        }
+        else if (in_quotes && c == '\\')
+        {
+            ++i;
+        }
+        else if (in_quotes && c == '\"')
+        {
+            end = i;
+            return unescape_string(jsoncons::span<char>(key_str.data() + start, (end - start)));
+        }
+        else if (c != ' ')
+        {
+            end = i + 1;
+        }
+    }
+    if (in_quotes) // unterminated_quoted_key
+    {
+        return result_type{jsoncons::unexpect, toon_errc::unterminated_quoted_key};
+    }
+
+    return result_type{jsoncons::string_view(key_str.data() + start, (end - start))};
+}
+
+inline
+toon_errc parse_number(const char* data, std::size_t length, 
+    json_visitor& visitor)
+{
+    if (length == 0)
+    {
+        visitor.string_value(jsoncons::string_view{});
+        return toon_errc{};
+    }
+    const char* cur = data;
+    bool sign = (*cur == '-');
+    cur += sign;
+    std::size_t len = length - sign;
+    if (len == 0)
+    {
+        visitor.string_value(jsoncons::string_view{data, length});
+        return toon_errc{};
+    }
+
+    if (len >= 2 && *cur == '0' && *(cur+1) != '.')
+    {
+        visitor.string_value(jsoncons::string_view(data, length));
+        return toon_errc{};
+    }
+
+    const char* end = data + length;
+    bool dot = false;
+    while (cur < end)
+    {
+        if (*cur == '.')
+        {
+            dot = true;
+        }
+        else if (!((*cur >= '0' && *cur <= '9') || (!dot && (*cur == 'e' || *cur == 'E' || *cur == '-' || *cur == '+'))))
+        {
+            visitor.string_value(jsoncons::string_view(data, length));
+            return toon_errc{};
+        }
+        ++cur;
+    }
+
+    std::uint64_t u64;
+    auto ru64 = jsoncons::to_integer(data, length, u64);
+    if (ru64)
+    {
+        visitor.uint64_value(u64);
+        return toon_errc{};
+    }
+    std::int64_t i64;
+    auto ri64 = jsoncons::to_integer(data, length, i64);
+    if (ri64)
+    {
+        visitor.int64_value(i64);
+        return toon_errc{};
+    }
+
+    double d;
+    auto result = jsoncons::decstr_to_double(data, length, d);
+    if (result)
+    {
+        visitor.double_value(d);
+        return toon_errc{};
+    }
+
+    visitor.string_value(jsoncons::string_view(data, length));
+
+    return toon_errc{};
+}
+
+inline 
+jsoncons::expected<void,std::error_code> parse_delimited_values(jsoncons::span<char> line, 
+    char delimiter,
+    std::size_t expected_length,
+    bool strict,
+    json_visitor& visitor)
+{
+    using result_type = jsoncons::expected<void,std::error_code>;
+
+    bool is_quoted = false;
+    std::size_t offset = 0;
+    std::size_t length = 0;
+    bool is_empty = true;
+    std::size_t num_items = 0;
+    std::size_t num_delimiters = 0;
+
+    for (size_t i = 0; i < line.size(); ++i)
+    {
+        char c = line[i];
+
+        if (c == delimiter && !is_quoted)
+        {
+            auto r = parse_primitive(strip(jsoncons::span<char>(line.data()+offset, length)), visitor);
+            if (!r)
+            {
+                return result_type{jsoncons::unexpect, r.error()};
+            }
+            ++num_items;
+            offset = i+1;
+            length = 0;
+            is_empty = false;
+            ++num_delimiters;
+        }
+        else if (!is_quoted && c == '\"')
+        {
+            offset = i;
+            length = 0;
+            is_quoted = true;
+        }
+        else if (is_quoted && c == '\\' && i+1 < line.size())
+        {
+            length += 2;
+            ++i;
+        }
+        else if (is_quoted && c == '\"')
+        {
+            auto r = parse_primitive(jsoncons::span<char>(line.data()+offset, length+2), visitor);
+            if (!r)
+            {
+                return result_type{jsoncons::unexpect, r.error()};
+            }
+            ++num_items;
+            while (++i < line.size())
+            {
+                if (line[i] == delimiter)
+                {
+                    ++num_delimiters;
+                    break;
+                }
+            }
+            is_empty = false;
+            is_quoted = false;
+            offset = i+1;
+            length = 0;
+        }
+        else
+        {
+            ++length;
+        }
+    }
+    if ((length > 0 || !is_empty) && (num_delimiters == num_items))
+    {
+        auto r = parse_primitive(strip(jsoncons::span<char>(line.data()+offset, length)), visitor);
+        if (!r)
+        {
+            return result_type{jsoncons::unexpect, r.error()};
+        }
+        ++num_items;
+    }
+
+    return strict && expected_length != num_items ? result_type{jsoncons::unexpect, toon_errc::inline_array_length_mismatch} : result_type{};
+}
+
+inline 
+jsoncons::expected<void,std::error_code> parse_delimited_values(jsoncons::span<char> line, 
+    char delimiter,
+    const std::vector<jsoncons::string_view>& fields,
+    json_visitor& visitor)
+{
+    using result_type = jsoncons::expected<void,std::error_code>;
+
+    bool is_quoted = false;
+    std::size_t offset = 0;
+    std::size_t length = 0;
+    bool is_empty = true;
+
+    std::size_t field_index = 0;
+    std::size_t num_items = 0;
+    std::size_t num_delimiters = 0;
+
+    visitor.begin_object();
+    for (size_t i = 0; i < line.size(); ++i)
+    {
+        char c = line[i];
+
+        if (c == delimiter && !is_quoted)
+        {
+            if (field_index >= fields.size())
+            {
+                return result_type{jsoncons::unexpect, toon_errc::too_many_values_in_row};
+            }
+            visitor.key(fields[field_index]);
+            auto r = parse_primitive(strip(jsoncons::span<char>(line.data()+offset, length)), visitor);
+            if (!r)
+            {
+                return result_type{jsoncons::unexpect, r.error()};
+            }
+            ++num_items;
+            ++num_delimiters;
+            offset = i+1;
+            length = 0;
+            is_empty = false;
+            ++field_index;
+        }
+        else if (!is_quoted && c == '\"')
+        {
+            offset = i;
+            length = 0;
+            is_quoted = true;
+        }
+        else if (is_quoted && c == '\\' && i+1 < line.size())
+        {
+            length += 2;
+            ++i;
+        }
+        else if (is_quoted && c == '\"')
+        {
+            if (field_index >= fields.size())
+            {
+                return result_type{jsoncons::unexpect, toon_errc::too_many_values_in_row};
+            }
+            visitor.key(fields[field_index]);
+            auto r = parse_primitive(jsoncons::span<char>(line.data()+offset, length+2), visitor);
+            if (!r)
+            {
+                return result_type{jsoncons::unexpect, r.error()};
+            }
+            ++num_items;
+            while (++i < line.size())
+            {
+                if (line[i] == delimiter)
+                {
+                    ++num_delimiters;
+                    break;
+                }
+            }
+            is_quoted = false;
+            offset = i+1;
+            length = 0;
+            ++field_index;
+        }
+        else
+        {
+            ++length;
+        }
+    }
+    if ((length > 0 || !is_empty) && (num_delimiters == num_items))
+    {
+        if (field_index >= fields.size())
+        {
+            return result_type{jsoncons::unexpect, toon_errc::too_many_values_in_row};
+        }
+        visitor.key(fields[field_index]);
+        auto r = parse_primitive(strip(jsoncons::span<char>(line.data()+offset, length)), visitor);
+        if (!r)
+        {
+            return result_type{jsoncons::unexpect, r.error()};
+        }
+        ++field_index;
+    }
+    if (field_index != fields.size())
+    {
+        return result_type{jsoncons::unexpect, toon_errc::too_few_values_in_row};
+    }
+    visitor.end_object();
+    return result_type{};
+}
+
+inline 
+void parse_delimited_values(jsoncons::string_view line, 
+    char delimiter,
+    std::vector<jsoncons::string_view>& tokens)
+{
+    bool is_quoted = false;
+    std::size_t offset = 0;
+    std::size_t length = 0;
+
+    for (size_t i = 0; i < line.size(); ++i)
+    {
+        char c = line[i];
+
+        if (c == delimiter && !is_quoted)
+        {
+            tokens.push_back(jsoncons::strip(jsoncons::string_view(line.data()+offset, length)));
+            offset = i+1;
+            length = 0;
+        }
+        else if (!is_quoted && c == '\"')
+        {
+            ++offset;
+            length = 0;
+            is_quoted = true;
+        }
+        else if (is_quoted && c == '\\' && i+1 < line.size())
+        {
+            length += 2;
+            ++i;
+        }
+        else if (is_quoted && c == '\"')
+        {
+            is_quoted = false;
+        }
+        else
+        {
+            ++length;
+        }
+    }
+    if (length > 0 || !tokens.empty())
+    {
+        tokens.push_back(jsoncons::strip(jsoncons::string_view(line.data()+offset, length)));
+    }
+}
+
+inline
+header_result parse_header(jsoncons::span<char> line)
+{
+    auto bracket_start = find_unquoted_char(line, '[');
+    if (bracket_start == jsoncons::string_view::npos)
+    {
+        return header_result{};
+    }
+    auto key = jsoncons::optional<jsoncons::string_view>{};
+    if (bracket_start > 0)
+    {
+        auto key_part = strip(jsoncons::span<char>{line.data(), bracket_start});
+        if (!key_part.empty())
+        {
+            auto rkey = parse_key(key_part);
+            if (!rkey)
+            {
+                return header_result{jsoncons::unexpect, rkey.error()};
+            }
+            key = *rkey;
+        }
+    }
+    auto bracket_end = find_unquoted_char(line, ']', bracket_start);
+    if (bracket_end == jsoncons::string_view::npos)
+    {
+        return header_result{};
+    }
+
+    jsoncons::string_view bracket_content = jsoncons::string_view(line.data() + (bracket_start + 1), bracket_end - (bracket_start + 1));
+    if (jsoncons::starts_with(bracket_content, "#"))
+    {
+        bracket_content = jsoncons::string_view(bracket_content.data() + 1, bracket_content.size() - 1);
+    }
+
+    jsoncons::string_view length_str = bracket_content;
+
+    char delimiter = ',';
+    if (jsoncons::ends_with(bracket_content, '\t'))
+    {
+        delimiter = '\t';
+        length_str = jsoncons::string_view(bracket_content.data(), bracket_content.size() - 1);
+    }
+    else if (jsoncons::ends_with(bracket_content, '|'))
+    {
+        delimiter = '|';
+        length_str = jsoncons::string_view(bracket_content.data(), bracket_content.size() - 1);
+    }
+    else if (jsoncons::ends_with(bracket_content, ','))
+    {
+        delimiter = ',';
+        length_str = jsoncons::string_view(bracket_content.data(), bracket_content.size() - 1);
+    }
+
+    std::size_t length{0};
+    auto rc = to_integer(length_str.data(), length_str.size(), length);
+    if (rc.ec != std::errc{})
+    {
+        return header_result{jsoncons::unexpect, toon_errc::invalid_value};
+    }
+
+    auto after_bracket = strip(jsoncons::span<char>(line.data() + (bracket_end + 1),
+        line.size() - (bracket_end + 1)));
+
+    std::vector<jsoncons::string_view> fields;
+    if (starts_with(after_bracket, '{'))
+    {
+        auto brace_end = find_unquoted_char(after_bracket, '}');
+        if (brace_end == jsoncons::string_view::npos)
+        {
+            return header_result{jsoncons::unexpect, toon_errc::unterminated_fields_segment};
+        }
+        auto fields_content = jsoncons::string_view(after_bracket.data() + 1, brace_end - 1);
+
+        // Parse fields using the delimiter
+        parse_delimited_values(fields_content, delimiter, fields);
+
+        after_bracket = jsoncons::span<char>(after_bracket.data() + (brace_end + 1),
+            after_bracket.size() - (brace_end + 1));
+    }
+    if (!starts_with(after_bracket, ':'))
+    {
+        fields.clear();
+    }
+    return header_result{jsoncons::in_place, header_info{jsoncons::optional<jsoncons::string_view>{key}, length, delimiter, std::move(fields)}};
+}
+
+inline
+std::size_t compute_depth_from_indent(std::size_t indent_spaces, std::size_t indent_size)
+{
+    return static_cast<std::size_t>(std::floor(static_cast<double>(indent_spaces) / static_cast<double>(indent_size)));
+}
+
+inline
+jsoncons::expected<void,std::error_code> decode_inline_array(jsoncons::span<char> content, 
+    char delimiter,
+    std::size_t expected_length,
+    const toon_decode_options& options,
+    json_visitor& visitor)
+{
+    using result_type = jsoncons::expected<void,std::error_code>;
+
+    bool strict = options.strict();
+
+    if (content.empty() && expected_length == 0)
+    {
+        visitor.begin_array();
+        visitor.end_array();
+        return result_type{};
+    }
+    visitor.begin_array();
+    auto r = parse_delimited_values(content, delimiter, expected_length, strict, visitor);
+    if (!r)
+    {
+        return r;
+    }
+    visitor.end_array();
+    return result_type{};
+}
+
+inline
+std::pair<std::size_t,char> find_first_unquoted(jsoncons::span<char> line, 
+    jsoncons::span<const char> chars)
+{
+    bool in_quotes = false;
+    for (std::size_t i = 0; i < line.size(); ++i)
+    {
+        char c = line[i];
+        if (!in_quotes && c == '\"')
+        {
+            in_quotes = true;
+        }
+        else if (in_quotes && c == '\\' && i+1 < line.size())
+        {
+            ++i;
+        }
+        else if (in_quotes && c == '\"')
+        {
+            in_quotes = false;
+        }
+        if (!in_quotes)
+        {
+            for (auto chr : chars)
+            {
+                if (c == chr)
+                {
+                    return std::pair<std::size_t,char>{i, c};
+                }
+            }
+        }
+    }
+
+    return std::pair<std::size_t,char>{jsoncons::string_view::npos, ' '};
+}
+
+inline
+bool is_row_line(jsoncons::span<char> line, char delimiter) 
+{
+    // Find first occurrence of delimiter or colon (single pass optimization)
+
+    char chars [2] = {delimiter, ':'};
+    auto res = find_first_unquoted(line, chars);
+
+    // No special chars found -> row
+    if (res.first == jsoncons::string_view::npos)
+        return true;
+
+    // First special char is delimiter -> row
+    // First special char is colon -> key-value
+    return res.second == delimiter;
+}
+
+enum class toon_frame_kind {object, item_object, list_array, tabular_array};
+
+// An open container, and the depth of the lines that belong to it: the fields of an object,
+// or the items or rows of an array
+struct toon_frame
+{
+    toon_frame_kind kind;
+    std::size_t depth;
+    std::size_t expected_length;
+    std::size_t count;
+    std::size_t first_line;
+};
+
+struct toon_line
+{
+    std::size_t depth{0};
+    jsoncons::span<char> content;
+    std::size_t line_num{0};
+
+    bool is_blank() const
+    {
+        for (auto c : content)
+        {
+            if (!(c == ' ' || c == '\t'))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// Parses TOON text a line at a time. Open containers are kept on a stack of frames, and each
+// line is handled by the innermost frame, or closes it and passes to the enclosing one, so 
+// events are reported as lines arrive and only the current line is held in memory.
+template <typename TempAlloc=std::allocator<char>>
+class basic_toon_parser : public ser_context
+{
+    using char_allocator_type = typename std::allocator_traits<TempAlloc>:: template rebind_alloc<char>;
+    using string_type = std::basic_string<char,std::char_traits<char>,char_allocator_type>;
+
+    // A line read before the root form is known
+    struct pending_line
+    {
+        string_type text;
+        std::size_t depth;
+        std::size_t line_num;
+    };
+
+    using pending_line_allocator_type = typename std::allocator_traits<TempAlloc>:: template rebind_alloc<pending_line>;
+    using frame_allocator_type = typename std::allocator_traits<TempAlloc>:: template rebind_alloc<toon_frame>;
+    using string_allocator_type = typename std::allocator_traits<TempAlloc>:: template rebind_alloc<string_type>;
+    using string_view_allocator_type = typename std::allocator_traits<TempAlloc>:: template rebind_alloc<jsoncons::string_view>;
+
+    enum class parse_state {root, lines, done};
+
+    toon_decode_options options_;
+    std::size_t indent_size_;
+    bool strict_;
+    bool cursor_mode_{false};
+    parse_state state_{parse_state::root};
+    std::size_t line_{1};
+    const char* input_ptr_{nullptr};
+    const char* input_end_{nullptr};
+    string_type buffer_;
+    std::vector<pending_line,pending_line_allocator_type> pending_;
+    std::size_t pending_non_blank_{0};
+    std::vector<toon_frame,frame_allocator_type> stack_;
+    // The fields of the open tabular array, which is always the innermost frame
+    std::vector<string_type,string_allocator_type> fields_;
+    std::vector<jsoncons::string_view,string_view_allocator_type> field_views_;
+    char delimiter_{','};
+
+public:
+    basic_toon_parser(const TempAlloc& temp_alloc = TempAlloc())
+        : basic_toon_parser(toon_decode_options(), temp_alloc)
+    {
+    }
+
+    basic_toon_parser(const toon_decode_options& options,
+        const TempAlloc& temp_alloc = TempAlloc())
+        : options_(options),
+          indent_size_(options.indent()),
+          strict_(options.strict()),
+          buffer_(temp_alloc),
+          pending_(temp_alloc),
+          stack_(temp_alloc),
+          fields_(temp_alloc),
+          field_views_(temp_alloc)
+    {
+    }
+
+    void cursor_mode(bool value)
+    {
+        cursor_mode_ = value;
+    }
+
+    bool done() const
+    {
+        return state_ == parse_state::done;
+    }
+
+    bool source_exhausted() const
+    {
+        return input_ptr_ == input_end_;
+    }
+
+    std::size_t line() const override
+    {
+        return line_;
+    }
+
+    std::size_t column() const override
+    {
+        return 0;
+    }
+
+    void reinitialize()
+    {
+        state_ = parse_state::root;
+        line_ = 1;
+        input_ptr_ = nullptr;
+        input_end_ = nullptr;
+        buffer_.clear();
+        pending_.clear();
+        pending_non_blank_ = 0;
+        stack_.clear();
+        fields_.clear();
+        field_views_.clear();
+    }
+
+    void update(const char* data, std::size_t length)
+    {
+        input_ptr_ = data;
+        input_end_ = data + length;
+    }
+
+    // Parses the complete lines in the current input, holding back a partial last line.
+    // In cursor mode, returns after each line.
+    void parse_some(json_visitor& visitor, std::error_code& ec)
+    {
+        while (input_ptr_ != input_end_ && state_ != parse_state::done)
+        {
+            const char* p = static_cast<const char*>(std::memchr(input_ptr_, '\n', static_cast<std::size_t>(input_end_ - input_ptr_)));
+            if (p == nullptr)
+            {
+                buffer_.append(input_ptr_, input_end_);
+                input_ptr_ = input_end_;
+                return;
+            }
+            buffer_.append(input_ptr_, p);
+            input_ptr_ = p + 1;
+            read_line(visitor, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+            if (cursor_mode_)
+            {
+                return;
+            }
+        }
+    }
+
+    // Parses a partial last line, and closes the open containers
+    void finish_parse(json_visitor& visitor, std::error_code& ec)
+    {
+        if (state_ == parse_state::done)
+        {
+            return;
+        }
+        if (!buffer_.empty())
+        {
+            read_line(visitor, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+        }
+        if (state_ == parse_state::root)
+        {
+            begin_root(visitor, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+        }
+        while (!stack_.empty())
+        {
+            end_frame(visitor, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+        }
+        state_ = parse_state::done;
+    }
+
+private:
+    void read_line(json_visitor& visitor, std::error_code& ec)
+    {
+        std::size_t indent = 0;
+        std::size_t offset = 0;
+        std::size_t trailing_blanks = 0;
+        bool is_blank_line = true;
+
+        for (std::size_t i = 0; i < buffer_.size(); ++i)
+        {
+            char c = buffer_[i];
+            if (c == '\t')
+            {
+                if (is_blank_line)
+                {
+                    if (strict_)
+                    {
+                        ec = toon_errc::tab_in_indentation;
+                        return;
+                    }
+                    indent += indent_size_;
+                    ++offset;
+                }
+            }
+            else if (c == ' ')
+            {
+                if (is_blank_line)
+                {
+                    ++indent;
+                    ++offset;
+                }
+                else
+                {
+                    ++trailing_blanks;
+                }
+            }
+            else
+            {
+                is_blank_line = false;
+                trailing_blanks = 0;
+            }
+        }
+        if (strict_ && !is_blank_line && indent > 0 && indent % indent_size_ != 0)
+        {
+            ec = toon_errc::indent_not_multiple_of_indent_size;
+            return;
+        }
+        std::size_t depth = compute_depth_from_indent(indent, indent_size_);
+        std::size_t length = buffer_.size() - offset - trailing_blanks;
+
+        if (state_ == parse_state::root)
+        {
+            pending_.push_back(pending_line{string_type(buffer_.data() + offset, length, buffer_.get_allocator()), depth, line_});
+            if (!is_blank_line)
+            {
+                ++pending_non_blank_;
+            }
+            if (pending_non_blank_ == 2)
+            {
+                begin_root(visitor, ec);
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    return;
+                }
+            }
+        }
+        else
+        {
+            toon_line line{depth, jsoncons::span<char>(&buffer_[0] + offset, length), line_};
+            parse_line(line, visitor, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+        }
+        buffer_.clear();
+        ++line_;
+    }
+
+    static toon_line make_line(pending_line& pending)
+    {
+        return toon_line{pending.depth, jsoncons::span<char>(&pending.text[0], pending.text.size()), pending.line_num};
+    }
+
+    // Determines the root form (Section 5) from the first two non-blank lines
+    void begin_root(json_visitor& visitor, std::error_code& ec)
+    {
+        state_ = parse_state::lines;
+
+        std::size_t first = 0;
+        while (first < pending_.size() && make_line(pending_[first]).is_blank())
+        {
+            ++first;
+        }
+        if (first == pending_.size())
+        {
+            visitor.begin_object();
+            visitor.end_object();
+            pending_.clear();
+            return;
+        }
+
+        std::size_t current_line = line_;
+        toon_line first_line = make_line(pending_[first]);
+        line_ = first_line.line_num;
+        std::size_t next = pending_.size();
+
+        auto header_result = parse_header(first_line.content);
+        if (!header_result)
+        {
+            ec = header_result.error();
+            return;
+        }
+        if (*header_result && !(*header_result)->key)
+        {
+            // Root array
+            begin_array_from_header(first_line, false, 0, *(*header_result), visitor, ec);
+            next = first + 1;
+        }
+        else if (pending_non_blank_ == 1 && !split_key_value(first_line.content) && !(*header_result))
+        {
+            // Single primitive
+            auto r = parse_primitive(first_line.content, visitor);
+            if (!r)
+            {
+                ec = r.error();
+            }
+        }
+        else
+        {
+            // Root object
+            visitor.begin_object();
+            stack_.push_back(toon_frame{toon_frame_kind::object, 0, 0, 0, 0});
+            next = 0;
+        }
+
+        for (std::size_t i = next; i < pending_.size() && !ec; ++i)
+        {
+            toon_line line = make_line(pending_[i]);
+            line_ = line.line_num;
+            parse_line(line, visitor, ec);
+        }
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            return;
+        }
+        line_ = current_line;
+        pending_.clear();
+    }
+
+    // Passes the line to the innermost open container, closing containers that it ends
+    void parse_line(toon_line& line, json_visitor& visitor, std::error_code& ec)
+    {
+        bool consumed = false;
+        while (!consumed && !stack_.empty())
+        {
+            switch (stack_.back().kind)
+            {
+                case toon_frame_kind::object:
+                    consumed = parse_object_line(line, visitor, ec);
+                    break;
+                case toon_frame_kind::item_object:
+                    consumed = parse_item_object_line(line, visitor, ec);
+                    break;
+                case toon_frame_kind::list_array:
+                    consumed = parse_list_line(line, visitor, ec);
+                    break;
+                case toon_frame_kind::tabular_array:
+                    consumed = parse_row_line(line, visitor, ec);
+                    break;
+            }
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+        }
+    }
+
+    void end_frame(json_visitor& visitor, std::error_code& ec)
+    {
+        toon_frame frame = stack_.back();
+        stack_.pop_back();
+        switch (frame.kind)
+        {
+            case toon_frame_kind::object:
+            case toon_frame_kind::item_object:
+                visitor.end_object();
+                break;
+            case toon_frame_kind::list_array:
+                visitor.end_array();
+                if (strict_ && frame.expected_length != frame.count)
+                {
+                    ec = toon_errc::list_array_length_mismatch;
+                }
+                break;
+            case toon_frame_kind::tabular_array:
+                visitor.end_array();
+                if (strict_ && frame.expected_length != frame.count)
+                {
+                    ec = toon_errc::tabular_array_length_mismatch;
+                }
+                break;
+        }
+    }
+
+    // A key and a primitive value, or a key that opens a nested object with fields at depth
+    void parse_key_value(const std::pair<jsoncons::span<char>,jsoncons::span<char>>& kv, 
+        std::size_t depth,
+        json_visitor& visitor, 
+        std::error_code& ec)
+    {
+        auto rkey = parse_key(kv.first);
+        if (!rkey)
+        {
+            ec = rkey.error();
+            return;
+        }
+        visitor.key(*rkey);
+        if (kv.second.empty())
+        {
+            visitor.begin_object();
+            stack_.push_back(toon_frame{toon_frame_kind::object, depth, 0, 0, 0});
+        }
+        else
+        {
+            auto r = parse_primitive(kv.second, visitor);
+            if (!r)
+            {
+                ec = r.error();
+            }
+        }
+    }
+
+    bool parse_object_line(toon_line& line, json_visitor& visitor, std::error_code& ec)
+    {
+        std::size_t depth = stack_.back().depth;
+        if (line.is_blank())
+        {
+            return true;
+        }
+        if (line.depth < depth)
+        {
+            end_frame(visitor, ec);
+            return false;
+        }
+        // Lines that are too deeply indented are skipped
+        if (line.depth > depth)
+        {
+            return true;
+        }
+
+        auto header_result = parse_header(line.content);
+        if (!header_result)
+        {
+            ec = header_result.error();
+            return true;
+        }
+        if (*header_result && (*header_result)->key)
+        {
+            const header_info& header(*(*header_result));
+            visitor.key(*header.key);
+            begin_array_from_header(line, false, line.depth, header, visitor, ec);
+            return true;
+        }
+
+        auto kv = split_key_value(line.content);
+        if (!kv)
+        {
+            // Invalid line, skip in non-strict mode
+            if (strict_)
+            {
+                ec = kv.error();
+            }
+            return true;
+        }
+        parse_key_value(*kv, line.depth + 1, visitor, ec);
+        return true;
+    }
+
+    // The fields after the first of an object that is a list item
+    bool parse_item_object_line(toon_line& line, json_visitor& visitor, std::error_code& ec)
+    {
+        if (line.depth != stack_.back().depth)
+        {
+            end_frame(visitor, ec);
+            return false;
+        }
+        if (line.is_blank())
+        {
+            return true;
+        }
+
+        auto header_result = parse_header(line.content);
+        if (!header_result)
+        {
+            ec = header_result.error();
+            return true;
+        }
+        if (*header_result && (*header_result)->key)
+        {
+            const header_info& header(*(*header_result));
+            visitor.key(*header.key);
+            begin_array_from_header(line, false, line.depth, header, visitor, ec);
+            return true;
+        }
+
+        auto kv = split_key_value(line.content);
+        if (!kv)
+        {
+            end_frame(visitor, ec);
+            return false;
+        }
+        parse_key_value(*kv, line.depth + 1, visitor, ec);
+        return true;
+    }
+
+    // In strict mode, blank lines within the expected length of an array are errors,
+    // and later ones end the array
+    bool parse_blank_array_line(const toon_line& line, json_visitor& visitor, std::error_code& ec)
+    {
+        if (!strict_)
+        {
+            return true;
+        }
+        const toon_frame& frame = stack_.back();
+        if ((line.line_num - frame.first_line) < frame.expected_length)
+        {
+            ec = toon_errc::blank_lines_in_array;
+            return true;
+        }
+        end_frame(visitor, ec);
+        return false;
+    }
+
+    bool parse_list_line(toon_line& line, json_visitor& visitor, std::error_code& ec)
+    {
+        if (line.is_blank())
+        {
+            return parse_blank_array_line(line, visitor, ec);
+        }
+        std::size_t item_depth = stack_.back().depth;
+        if (line.depth < item_depth || !starts_with(line.content, '-'))
+        {
+            end_frame(visitor, ec);
+            return false;
+        }
+        ++stack_.back().count;
+
+        // Remove "- " prefix
+        auto item_content = strip(jsoncons::span<char>(line.content.data()+1, line.content.size()-1));
+        auto item_header_result = parse_header(item_content);
+        if (!item_header_result)
+        {
+            ec = item_header_result.error();
+            return true;
+        }
+        if (*item_header_result)
+        {
+            const header_info& item_header(*(*item_header_result));
+            if (!item_header.key)
+            {
+                // - [N]: inline array, or a list array with items at the same depth
+                auto it = std::find(item_content.begin(), item_content.end(), ':');
+                if (it != item_content.end())
+                {
+                    std::size_t colon_idx = static_cast<std::size_t>(it - item_content.begin());
+                    auto inline_part = strip(jsoncons::span<char>(item_content.data()+(colon_idx+1), item_content.size()-(colon_idx+1)));
+                    if (!inline_part.empty() || item_header.length == 0)
+                    {
+                        auto r = decode_inline_array(inline_part, item_header.delimiter, item_header.length, options_, visitor);
+                        if (!r)
+                        {
+                            ec = r.error();
+                        }
+                        return true;
+                    }
+                    visitor.begin_array();
+                    stack_.push_back(toon_frame{toon_frame_kind::list_array, item_depth, item_header.length, 0, line.line_num + 1});
+                    return true;
+                }
+            }
+            else
+            {
+                // - key[N]...: an object whose first field is an array
+                visitor.begin_object();
+                stack_.push_back(toon_frame{toon_frame_kind::item_object, line.depth + 1, 0, 0, 0});
+                visitor.key(*item_header.key);
+                begin_array_from_header(line, true, line.depth, item_header, visitor, ec);
+                return true;
+            }
+        }
+
+        auto kv = split_key_value(item_content);
+        if (kv)
+        {
+            // An object item, with a nested object first field at depth + 2 
+            // and remaining fields at depth + 1
+            visitor.begin_object();
+            stack_.push_back(toon_frame{toon_frame_kind::item_object, line.depth + 1, 0, 0, 0});
+            parse_key_value(*kv, line.depth + 2, visitor, ec);
+        }
+        else if (item_content.empty())
+        {
+            visitor.begin_object();
+            visitor.end_object();
+        }
+        else
+        {
+            auto r = parse_primitive(item_content, visitor);
+            if (!r)
+            {
+                ec = r.error();
+            }
+        }
+        return true;
+    }
+
+    bool parse_row_line(toon_line& line, json_visitor& visitor, std::error_code& ec)
+    {
+        if (line.is_blank())
+        {
+            return parse_blank_array_line(line, visitor, ec);
+        }
+        if (line.depth != stack_.back().depth || !is_row_line(line.content, delimiter_))
+        {
+            end_frame(visitor, ec);
+            return false;
+        }
+        auto r = parse_delimited_values(line.content, delimiter_, field_views_, visitor);
+        if (!r)
+        {
+            ec = r.error();
+            return true;
+        }
+        ++stack_.back().count;
+        return true;
+    }
+
+    void begin_array_from_header(const toon_line& line,
+        bool list_item,
+        std::size_t base_depth,
+        const header_info& header,
+        json_visitor& visitor,
+        std::error_code& ec)
+    {
+        // Check if there's inline content after the colon
+        std::size_t colon_idx = find_unquoted_char(line.content, ':');
+        if (colon_idx == jsoncons::string_view::npos)
+        {
+            ec = toon_errc::missing_colon_after_key;
+            return;
+        }
+        auto inline_content = strip(jsoncons::span<char>(line.content.data() + (colon_idx + 1), line.content.size() - (colon_idx + 1)));
+
+        if (!inline_content.empty() || (header.fields.empty() && header.length == 0))
+        {
+            auto r = decode_inline_array(inline_content, header.delimiter, header.length, options_, visitor);
+            if (!r)
+            {
+                ec = r.error();
+            }
+            return;
+        }
+
+        visitor.begin_array();
+        if (!header.fields.empty())
+        {
+            // The fields refer to the header line, so are copied before later lines are read
+            fields_.clear();
+            for (const auto& field : header.fields)
+            {
+                fields_.emplace_back(field.data(), field.size(), fields_.get_allocator());
+            }
+            field_views_.clear();
+            for (const auto& field : fields_)
+            {
+                field_views_.emplace_back(field.data(), field.size());
+            }
+            delimiter_ = header.delimiter;
+
+            // For a tabular-first list-item object, `- key[N]{fields}:`, rows are at base_depth + 2
+            std::size_t depth = (header.key && list_item) ? base_depth + 2 : base_depth + 1;
+            stack_.push_back(toon_frame{toon_frame_kind::tabular_array, depth, header.length, 0, line.line_num + 1});
+        }
+        else
+        {
+            stack_.push_back(toon_frame{toon_frame_kind::list_array, base_depth + 1, header.length, 0, line.line_num + 1});
+        }
+    }
+};
+
+using toon_parser = basic_toon_parser<std::allocator<char>>;
+
+} // namespace toon
+} // namespace jsoncons
+
+#endif // JSONCONS_TOON_TOON_PARSER_HPP
@@ -206,6 +206,29 @@ public:
         read_next(ec);
     }
 
+    void skip() final
+    {
+        std::error_code ec;
+        skip(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    void skip(std::error_code& ec) final
+    {
+        if (is_begin_container(current().event_type()))
+        {
+            parser_.skip_container(ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+            read_next(ec);
+        }
+    }
+
     const ser_context& context() const final
     {
         return *this;
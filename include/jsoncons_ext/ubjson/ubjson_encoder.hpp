@@ -492,6 +492,132 @@ private:
         JSONCONS_VISITOR_RETURN;
     }
 
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const uint8_t>& data, 
+        semantic_tag,
+        const ser_context&, 
+        std::error_code&) override
+    {
+        write_typed_array<uint8_t>(jsoncons::ubjson::ubjson_type::uint8_type, data);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const uint16_t>& data, 
+        semantic_tag,
+        const ser_context&, 
+        std::error_code&) override
+    {
+        // no unsigned 16-bit type, widen to int32
+        write_typed_array<int32_t>(jsoncons::ubjson::ubjson_type::int32_type, data);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const uint32_t>& data, 
+        semantic_tag,
+        const ser_context&, 
+        std::error_code&) override
+    {
+        // no unsigned 32-bit type, widen to int64
+        write_typed_array<int64_t>(jsoncons::ubjson::ubjson_type::int64_type, data);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const uint64_t>& data, 
+        semantic_tag tag,
+        const ser_context& context, 
+        std::error_code& ec) override
+    {
+        for (auto val : data)
+        {
+            if (val > static_cast<uint64_t>((std::numeric_limits<int64_t>::max)()))
+            {
+                // values that do not fit in int64 are written element by element
+                this->begin_array(data.size(), semantic_tag::none, context, ec);
+                if (JSONCONS_UNLIKELY(ec)) {JSONCONS_VISITOR_RETURN;}
+                for (auto p = data.begin(); p != data.end(); ++p)
+                {
+                    this->uint64_value(*p, tag, context, ec);
+                    if (JSONCONS_UNLIKELY(ec)) {JSONCONS_VISITOR_RETURN;}
+                }
+                this->end_array(context, ec);
+                JSONCONS_VISITOR_RETURN;
+            }
+        }
+        write_typed_array<int64_t>(jsoncons::ubjson::ubjson_type::int64_type, data);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int8_t>& data, 
+        semantic_tag,
+        const ser_context&, 
+        std::error_code&) override
+    {
+        write_typed_array<int8_t>(jsoncons::ubjson::ubjson_type::int8_type, data);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int16_t>& data, 
+        semantic_tag,
+        const ser_context&, 
+        std::error_code&) override
+    {
+        write_typed_array<int16_t>(jsoncons::ubjson::ubjson_type::int16_type, data);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int32_t>& data, 
+        semantic_tag,
+        const ser_context&, 
+        std::error_code&) override
+    {
+        write_typed_array<int32_t>(jsoncons::ubjson::ubjson_type::int32_type, data);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int64_t>& data, 
+        semantic_tag,
+        const ser_context&, 
+        std::error_code&) override
+    {
+        write_typed_array<int64_t>(jsoncons::ubjson::ubjson_type::int64_type, data);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const float>& data, 
+        semantic_tag,
+        const ser_context&, 
+        std::error_code&) override
+    {
+        write_typed_array<float>(jsoncons::ubjson::ubjson_type::float32_type, data);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const double>& data, 
+        semantic_tag,
+        const ser_context&, 
+        std::error_code&) override
+    {
+        write_typed_array<double>(jsoncons::ubjson::ubjson_type::float64_type, data);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    // Writes a strongly typed array, [$<type>#<count> followed by the packed big endian values
+    template <typename Target,typename T>
+    void write_typed_array(uint8_t type, const jsoncons::span<const T>& data)
+    {
+        sink_.push_back(jsoncons::ubjson::ubjson_type::start_array_marker);
+        sink_.push_back(static_cast<uint8_t>(jsoncons::ubjson::ubjson_type::type_marker));
+        sink_.push_back(type);
+        sink_.push_back(jsoncons::ubjson::ubjson_type::count_marker);
+        put_length(data.size());
+
+        for (auto val : data)
+        {
+            binary::native_to_big(static_cast<Target>(val),std::back_inserter(sink_));
+        }
+
+        end_value();
+    }
+
     void end_value()
     {
         if (!stack_.empty())
@@ -9,6 +9,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <limits> // std::numeric_limits
 #include <memory>
 #include <string>
 #include <system_error>
@@ -59,6 +60,7 @@ class basic_ubjson_parser : public ser_context
     using char_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<char_type>;                  
     using byte_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<uint8_t>;                  
     using parse_state_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<parse_state>;                         
+    using uint64_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<uint64_t>;                  
 
     bool more_{true};
     bool done_{false};
@@ -70,6 +72,8 @@ class basic_ubjson_parser : public ser_context
     int max_nesting_depth_;
     std::size_t max_items_;
     std::basic_string<char,std::char_traits<char>,char_allocator_type> text_buffer_;
+    std::vector<uint8_t,byte_allocator_type> bytes_buffer_;
+    std::vector<uint64_t,uint64_allocator_type> typed_buffer_;
     std::vector<parse_state,parse_state_allocator_type> state_stack_;
 public:
     template <typename Sourceable>
@@ -80,6 +84,8 @@ public:
          max_nesting_depth_(options.max_nesting_depth()),
          max_items_(options.max_items()),
          text_buffer_(alloc),
+         bytes_buffer_(alloc),
+         typed_buffer_(alloc),
          state_stack_(alloc)
     {
         state_stack_.emplace_back(parse_mode::root,0);
@@ -344,7 +350,375 @@ public:
             }
         }
     }
+
+    // Consumes the remaining items of the innermost array or object without reporting them,
+    // so that the next call to parse reports the end of the container. Strongly typed
+    // containers of fixed size values are jumped over in one step.
+    void skip_container(std::error_code& ec)
+    {
+        switch (state_stack_.back().mode)
+        {
+            case parse_mode::array:
+                while (state_stack_.back().index < state_stack_.back().length)
+                {
+                    ++state_stack_.back().index;
+                    skip_type_and_value(0, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                }
+                break;
+            case parse_mode::strongly_typed_array:
+            {
+                std::size_t count = state_stack_.back().length - state_stack_.back().index;
+                state_stack_.back().index = state_stack_.back().length;
+                skip_values(state_stack_.back().type, count, 0, ec);
+                break;
+            }
+            case parse_mode::indefinite_array:
+                skip_to_end_marker(jsoncons::ubjson::ubjson_type::end_array_marker, 0, ec);
+                break;
+            case parse_mode::map_value:
+            case parse_mode::map_key:
+                if (state_stack_.back().mode == parse_mode::map_value)
+                {
+                    state_stack_.back().mode = parse_mode::map_key;
+                    skip_type_and_value(0, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                }
+                while (state_stack_.back().index < state_stack_.back().length)
+                {
+                    ++state_stack_.back().index;
+                    skip_key(ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                    skip_type_and_value(0, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                }
+                break;
+            case parse_mode::strongly_typed_map_value:
+            case parse_mode::strongly_typed_map_key:
+                if (state_stack_.back().mode == parse_mode::strongly_typed_map_value)
+                {
+                    state_stack_.back().mode = parse_mode::strongly_typed_map_key;
+                    skip_value(state_stack_.back().type, 0, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                }
+                while (state_stack_.back().index < state_stack_.back().length)
+                {
+                    ++state_stack_.back().index;
+                    skip_key(ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                    skip_value(state_stack_.back().type, 0, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                }
+                break;
+            case parse_mode::indefinite_map_value:
+            case parse_mode::indefinite_map_key:
+                if (state_stack_.back().mode == parse_mode::indefinite_map_value)
+                {
+                    state_stack_.back().mode = parse_mode::indefinite_map_key;
+                    skip_type_and_value(0, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                }
+                skip_to_end_marker(jsoncons::ubjson::ubjson_type::end_object_marker, 0, ec);
+                break;
+            default:
+                break;
+        }
+    }
 private:
+    static std::size_t fixed_value_size(uint8_t type)
+    {
+        switch (type)
+        {
+            case jsoncons::ubjson::ubjson_type::null_type: 
+            case jsoncons::ubjson::ubjson_type::no_op_type: 
+            case jsoncons::ubjson::ubjson_type::true_type:
+            case jsoncons::ubjson::ubjson_type::false_type:
+                return 0;
+            case jsoncons::ubjson::ubjson_type::int8_type: 
+            case jsoncons::ubjson::ubjson_type::uint8_type: 
+            case jsoncons::ubjson::ubjson_type::char_type: 
+                return 1;
+            case jsoncons::ubjson::ubjson_type::int16_type: 
+                return 2;
+            case jsoncons::ubjson::ubjson_type::int32_type: 
+            case jsoncons::ubjson::ubjson_type::float32_type: 
+                return 4;
+            case jsoncons::ubjson::ubjson_type::int64_type: 
+            case jsoncons::ubjson::ubjson_type::float64_type: 
+                return 8;
+            default:
+                return (std::numeric_limits<std::size_t>::max)();
+        }
+    }
+
+    static bool is_fixed_width_number(uint8_t type)
+    {
+        switch (type)
+        {
+            case jsoncons::ubjson::ubjson_type::int8_type: 
+            case jsoncons::ubjson::ubjson_type::uint8_type: 
+            case jsoncons::ubjson::ubjson_type::int16_type: 
+            case jsoncons::ubjson::ubjson_type::int32_type: 
+            case jsoncons::ubjson::ubjson_type::int64_type: 
+            case jsoncons::ubjson::ubjson_type::float32_type: 
+            case jsoncons::ubjson::ubjson_type::float64_type: 
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    void skip_bytes(std::size_t length, std::error_code& ec)
+    {
+        std::size_t position = source_.position();
+        source_.ignore(length);
+        if (JSONCONS_UNLIKELY(source_.position() - position != length))
+        {
+            ec = ubjson_errc::unexpected_eof;
+            more_ = false;
+        }
+    }
+
+    void skip_key(std::error_code& ec)
+    {
+        std::size_t length = get_length(ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            ec = ubjson_errc::key_expected;
+            more_ = false;
+            return;
+        }
+        skip_bytes(length, ec);
+    }
+
+    void skip_values(uint8_t type, std::size_t count, int depth, std::error_code& ec)
+    {
+        std::size_t size = fixed_value_size(type);
+        if (size != (std::numeric_limits<std::size_t>::max)())
+        {
+            if (JSONCONS_UNLIKELY(size != 0 && count > (std::numeric_limits<std::size_t>::max)() / size))
+            {
+                ec = ubjson_errc::number_too_large;
+                more_ = false;
+                return;
+            }
+            skip_bytes(count*size, ec);
+            return;
+        }
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            skip_value(type, depth, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+        }
+    }
+
+    // Skips items up to but not including the end marker
+    void skip_to_end_marker(uint8_t end_marker, int depth, std::error_code& ec)
+    {
+        bool is_object = end_marker == jsoncons::ubjson::ubjson_type::end_object_marker;
+        std::size_t index = 0;
+        while (true)
+        {
+            auto c = source_.peek();
+            if (JSONCONS_UNLIKELY(c.eof))
+            {
+                ec = ubjson_errc::unexpected_eof;
+                more_ = false;
+                return;
+            }
+            if (c.value == end_marker)
+            {
+                return;
+            }
+            if (++index > max_items_)
+            {
+                ec = ubjson_errc::max_items_exceeded;
+                more_ = false;
+                return;
+            }
+            if (is_object)
+            {
+                skip_key(ec);
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    return;
+                }
+            }
+            skip_type_and_value(depth, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return;
+            }
+        }
+    }
+
+    void skip_type_and_value(int depth, std::error_code& ec)
+    {
+        uint8_t b;
+        if (source_.read(&b, 1) == 0)
+        {
+            ec = ubjson_errc::unexpected_eof;
+            more_ = false;
+            return;
+        }
+        skip_value(b, depth, ec);
+    }
+
+    void skip_value(uint8_t type, int depth, std::error_code& ec)
+    {
+        switch (type)
+        {
+            case jsoncons::ubjson::ubjson_type::string_type: 
+            case jsoncons::ubjson::ubjson_type::high_precision_number_type: 
+            {
+                std::size_t length = get_length(ec);
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    return;
+                }
+                skip_bytes(length, ec);
+                break;
+            }
+            case jsoncons::ubjson::ubjson_type::start_array_marker: 
+            case jsoncons::ubjson::ubjson_type::start_object_marker: 
+            {
+                if (JSONCONS_UNLIKELY(nesting_depth_ + (++depth) > max_nesting_depth_))
+                {
+                    ec = ubjson_errc::max_nesting_depth_exceeded;
+                    more_ = false;
+                    return;
+                } 
+                bool is_object = type == jsoncons::ubjson::ubjson_type::start_object_marker;
+                auto c = source_.peek();
+                if (JSONCONS_UNLIKELY(c.eof))
+                {
+                    ec = ubjson_errc::unexpected_eof;
+                    more_ = false;
+                    return;
+                }
+                uint8_t item_type = 0;
+                bool typed = false;
+                if (c.value == jsoncons::ubjson::ubjson_type::type_marker)
+                {
+                    source_.ignore(1);
+                    if (source_.read(&item_type, 1) == 0)
+                    {
+                        ec = ubjson_errc::unexpected_eof;
+                        more_ = false;
+                        return;
+                    }
+                    typed = true;
+                    c = source_.peek();
+                    if (JSONCONS_UNLIKELY(c.eof))
+                    {
+                        ec = ubjson_errc::unexpected_eof;
+                        more_ = false;
+                        return;
+                    }
+                    if (c.value != jsoncons::ubjson::ubjson_type::count_marker)
+                    {
+                        ec = ubjson_errc::count_required_after_type;
+                        more_ = false;
+                        return;
+                    }
+                }
+                if (c.value == jsoncons::ubjson::ubjson_type::count_marker)
+                {
+                    source_.ignore(1);
+                    std::size_t length = get_length(ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                    if (length > max_items_)
+                    {
+                        ec = ubjson_errc::max_items_exceeded;
+                        more_ = false;
+                        return;
+                    }
+                    if (typed && !is_object)
+                    {
+                        skip_values(item_type, length, depth, ec);
+                        return;
+                    }
+                    for (std::size_t i = 0; i < length; ++i)
+                    {
+                        if (is_object)
+                        {
+                            skip_key(ec);
+                            if (JSONCONS_UNLIKELY(ec))
+                            {
+                                return;
+                            }
+                        }
+                        if (typed)
+                        {
+                            skip_value(item_type, depth, ec);
+                        }
+                        else
+                        {
+                            skip_type_and_value(depth, ec);
+                        }
+                        if (JSONCONS_UNLIKELY(ec))
+                        {
+                            return;
+                        }
+                    }
+                }
+                else
+                {
+                    skip_to_end_marker(is_object ? jsoncons::ubjson::ubjson_type::end_object_marker : jsoncons::ubjson::ubjson_type::end_array_marker, 
+                        depth, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                    source_.ignore(1);
+                }
+                break;
+            }
+            default:
+            {
+                std::size_t size = fixed_value_size(type);
+                if (size == (std::numeric_limits<std::size_t>::max)())
+                {
+                    ec = ubjson_errc::unknown_type;
+                    more_ = false;
+                    return;
+                }
+                skip_bytes(size, ec);
+                break;
+            }
+        }
+    }
+
     void read_type_and_value(json_visitor& visitor, std::error_code& ec)
     {
         if (source_.is_error())
@@ -489,21 +863,21 @@ private:
             }
             case jsoncons::ubjson::ubjson_type::char_type: 
             {
-                text_buffer_.clear();
-                if (source_reader<Source>::read(source_,text_buffer_,1) != 1)
+                auto chars = source_reader<Source>::read_view(source_,text_buffer_,1);
+                if (chars.size() != 1)
                 {
                     ec = ubjson_errc::unexpected_eof;
                     more_ = false;
                     return;
                 }
-                auto result = unicode_traits::validate(text_buffer_.data(),text_buffer_.size());
+                auto result = unicode_traits::validate(chars.data(),chars.size());
                 if (result.ec != unicode_traits::conv_errc())
                 {
                     ec = ubjson_errc::invalid_utf8_text_string;
                     more_ = false;
                     return;
                 }
-                visitor.string_value(text_buffer_, semantic_tag::none, *this, ec);
+                visitor.string_value(jsoncons::basic_string_view<char>(chars.data(),chars.size()), semantic_tag::none, *this, ec);
                 more_ = !cursor_mode_;
                 break;
             }
@@ -514,21 +888,21 @@ private:
                 {
                     return;
                 }
-                text_buffer_.clear();
-                if (source_reader<Source>::read(source_,text_buffer_,length) != length)
+                auto chars = source_reader<Source>::read_view(source_,text_buffer_,length);
+                if (chars.size() != length)
                 {
                     ec = ubjson_errc::unexpected_eof;
                     more_ = false;
                     return;
                 }
-                auto result = unicode_traits::validate(text_buffer_.data(),text_buffer_.size());
+                auto result = unicode_traits::validate(chars.data(),chars.size());
                 if (result.ec != unicode_traits::conv_errc())
                 {
                     ec = ubjson_errc::invalid_utf8_text_string;
                     more_ = false;
                     return;
                 }
-                visitor.string_value(jsoncons::basic_string_view<char>(text_buffer_.data(),text_buffer_.length()), semantic_tag::none, *this, ec);
+                visitor.string_value(jsoncons::basic_string_view<char>(chars.data(),chars.size()), semantic_tag::none, *this, ec);
                 more_ = !cursor_mode_;
                 break;
             }
@@ -539,21 +913,21 @@ private:
                 {
                     return;
                 }
-                text_buffer_.clear();
-                if (source_reader<Source>::read(source_,text_buffer_,length) != length)
+                auto chars = source_reader<Source>::read_view(source_,text_buffer_,length);
+                if (chars.size() != length)
                 {
                     ec = ubjson_errc::unexpected_eof;
                     more_ = false;
                     return;
                 }
-                if (jsoncons::is_base10(text_buffer_.data(),text_buffer_.length()))
+                if (jsoncons::is_base10(chars.data(),chars.size()))
                 {
-                    visitor.string_value(jsoncons::basic_string_view<char>(text_buffer_.data(),text_buffer_.length()), semantic_tag::bigint, *this, ec);
+                    visitor.string_value(jsoncons::basic_string_view<char>(chars.data(),chars.size()), semantic_tag::bigint, *this, ec);
                     more_ = !cursor_mode_;
                 }
                 else
                 {
-                    visitor.string_value(jsoncons::basic_string_view<char>(text_buffer_.data(),text_buffer_.length()), semantic_tag::bigdec, *this, ec);
+                    visitor.string_value(jsoncons::basic_string_view<char>(chars.data(),chars.size()), semantic_tag::bigdec, *this, ec);
                     more_ = !cursor_mode_;
                 }
                 break;
@@ -627,6 +1001,12 @@ private:
                     more_ = false;
                     return;
                 }
+                if (!cursor_mode_ && is_fixed_width_number(b))
+                {
+                    --nesting_depth_;
+                    read_typed_array(visitor, b, length, ec);
+                    return;
+                }
                 state_stack_.emplace_back(parse_mode::strongly_typed_array,length,b);
                 visitor.begin_array(length, semantic_tag::none, *this, ec);
                 more_ = !cursor_mode_;
@@ -664,6 +1044,75 @@ private:
         }
     }
 
+    // Reads the packed values of a strongly typed numeric array in one pass
+    // and reports them as a single typed array
+    void read_typed_array(json_visitor& visitor, uint8_t type, std::size_t length, std::error_code& ec)
+    {
+        switch (type)
+        {
+            case jsoncons::ubjson::ubjson_type::uint8_type: 
+            {
+                auto bytes = source_reader<Source>::read_view(source_, bytes_buffer_, length);
+                if (JSONCONS_UNLIKELY(bytes.size() != length))
+                {
+                    ec = ubjson_errc::unexpected_eof;
+                    more_ = false;
+                    return;
+                }
+                visitor.typed_array(bytes, semantic_tag::none, *this, ec);
+                break;
+            }
+            case jsoncons::ubjson::ubjson_type::int8_type: 
+                read_typed_array<int8_t>(visitor, length, ec);
+                break;
+            case jsoncons::ubjson::ubjson_type::int16_type: 
+                read_typed_array<int16_t>(visitor, length, ec);
+                break;
+            case jsoncons::ubjson::ubjson_type::int32_type: 
+                read_typed_array<int32_t>(visitor, length, ec);
+                break;
+            case jsoncons::ubjson::ubjson_type::int64_type: 
+                read_typed_array<int64_t>(visitor, length, ec);
+                break;
+            case jsoncons::ubjson::ubjson_type::float32_type: 
+                read_typed_array<float>(visitor, length, ec);
+                break;
+            case jsoncons::ubjson::ubjson_type::float64_type: 
+                read_typed_array<double>(visitor, length, ec);
+                break;
+            default:
+                ec = ubjson_errc::unknown_type;
+                more_ = false;
+                break;
+        }
+    }
+
+    template <typename T>
+    void read_typed_array(json_visitor& visitor, std::size_t length, std::error_code& ec)
+    {
+        if (JSONCONS_UNLIKELY(length > (std::numeric_limits<std::size_t>::max)()/sizeof(T)))
+        {
+            ec = ubjson_errc::max_items_exceeded;
+            more_ = false;
+            return;
+        }
+        const std::size_t size = length*sizeof(T);
+        auto bytes = source_reader<Source>::read_view(source_, bytes_buffer_, size);
+        if (JSONCONS_UNLIKELY(bytes.size() != size))
+        {
+            ec = ubjson_errc::unexpected_eof;
+            more_ = false;
+            return;
+        }
+        typed_buffer_.resize((size + sizeof(uint64_t) - 1)/sizeof(uint64_t));
+        T* data = reinterpret_cast<T*>(typed_buffer_.data());
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            data[i] = binary::big_to_native<T>(bytes.data() + i*sizeof(T), sizeof(T));
+        }
+        visitor.typed_array(jsoncons::span<const T>(data, length), semantic_tag::none, *this, ec);
+    }
+
     void end_array(json_visitor& visitor, std::error_code& ec)
     {
         --nesting_depth_;
@@ -920,22 +1369,22 @@ private:
             more_ = false;
             return;
         }
-        text_buffer_.clear();
-        if (source_reader<Source>::read(source_,text_buffer_,length) != length)
+        auto chars = source_reader<Source>::read_view(source_,text_buffer_,length);
+        if (chars.size() != length)
         {
             ec = ubjson_errc::unexpected_eof;
             more_ = false;
             return;
         }
 
-        auto result = unicode_traits::validate(text_buffer_.data(),text_buffer_.size());
+        auto result = unicode_traits::validate(chars.data(),chars.size());
         if (result.ec != unicode_traits::conv_errc())
         {
             ec = ubjson_errc::invalid_utf8_text_string;
             more_ = false;
             return;
         }
-        visitor.key(jsoncons::basic_string_view<char>(text_buffer_.data(),text_buffer_.length()), *this, ec);
+        visitor.key(jsoncons::basic_string_view<char>(chars.data(),chars.size()), *this, ec);
         more_ = !cursor_mode_;
     }
 };
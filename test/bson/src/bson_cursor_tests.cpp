@@ -306,3 +306,34 @@ TEMPLATE_TEST_CASE("bson_cursor reset test", "",
         check_bson_cursor_document("third document", cursor, "c", 3);
     }
 }
+
+TEST_CASE("bson_cursor skip test")
+{
+    ojson j = ojson::parse(R"(
+    {
+        "skipped" : {"a" : [1, -2, 3.5, {"b" : "c"}], "d" : null, "e" : [[],{}]},
+        "kept" : [true, "x"]
+    }
+    )");
+    std::vector<uint8_t> data;
+    bson::encode_bson(j, data);
+
+    bson::bson_bytes_cursor cursor(data);
+    REQUIRE(staj_events::begin_object == cursor.current().event_type());
+    cursor.next();
+    CHECK(cursor.current().get<std::string>() == "skipped");
+    cursor.next();
+    REQUIRE(staj_events::begin_object == cursor.current().event_type());
+    cursor.skip();
+    CHECK(staj_events::end_object == cursor.current().event_type());
+    cursor.next();
+    CHECK(cursor.current().get<std::string>() == "kept");
+    cursor.next();
+    REQUIRE(staj_events::begin_array == cursor.current().event_type());
+    cursor.skip();
+    CHECK(staj_events::end_array == cursor.current().event_type());
+    cursor.next();
+    CHECK(staj_events::end_object == cursor.current().event_type());
+    cursor.next();
+    CHECK(cursor.done());
+}
@@ -0,0 +1,103 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons_ext/bson/bson.hpp>
+#include <jsoncons/json.hpp>
+
+#include <string>
+#include <vector>
+#include <catch/catch.hpp>
+
+using namespace jsoncons;
+
+TEST_CASE("bson_view tests")
+{
+    json j;
+    j.try_emplace("_id", json("507f1f77bcf86cd799439011", semantic_tag::id));
+    j.try_emplace("name", "Alice");
+    j.try_emplace("count", 42);
+    j.try_emplace("big", int64_t(1) << 40);
+    j.try_emplace("price", json("1.25", semantic_tag::float128));
+    j.try_emplace("ratio", 0.5);
+    j.try_emplace("active", true);
+    j.try_emplace("missing", null_type());
+    j.try_emplace("created", json(1431027667000, semantic_tag::epoch_milli));
+    j.try_emplace("data", json(byte_string_arg, std::vector<uint8_t>{1,2,3}));
+    j.try_emplace("route", json::parse(R"({"region":"eu","shard":7})"));
+    j.try_emplace("tags", json::parse(R"(["a","b","c"])"));
+
+    std::vector<uint8_t> buffer;
+    bson::encode_bson(j, buffer);
+
+    bson::bson_view view(buffer.data(), buffer.size());
+
+    SECTION("find and typed accessors")
+    {
+        CHECK(view.size() == j.size());
+        CHECK_FALSE(view.empty());
+
+        CHECK(view["name"].as_string_view() == "Alice");
+        CHECK(view["count"].as_int64() == 42);
+        CHECK(view["big"].as_int64() == (int64_t(1) << 40));
+        CHECK(view["ratio"].as_double() == 0.5);
+        CHECK(view["active"].as_bool());
+        CHECK(view["missing"].is_null());
+        CHECK(view["created"].type() == bson::bson_type::datetime_type);
+        CHECK(view["created"].as_int64() == 1431027667000);
+
+        std::string id;
+        bson::to_string(view["_id"].as_oid(), id);
+        CHECK(id == "507f1f77bcf86cd799439011");
+
+        char buf[bson::decimal128_limits::buf_size];
+        auto dec = view["price"].as_decimal128();
+        auto r = bson::decimal128_to_chars(buf, buf+sizeof(buf), dec);
+        CHECK(std::string(buf, r.ptr) == "1.25");
+
+        auto bytes = view["data"].as_byte_string_view();
+        CHECK(bytes == byte_string_view(std::vector<uint8_t>{1,2,3}));
+
+        CHECK(view.contains("route"));
+        CHECK_FALSE(view.contains("nothere"));
+        CHECK(view.find("nothere") == view.end());
+        CHECK_THROWS_AS(view["nothere"], key_not_found);
+        CHECK_THROWS(view["name"].as_int64());
+    }
+
+    SECTION("nested documents and arrays")
+    {
+        auto route = view["route"].as_document();
+        CHECK(route["region"].as_string_view() == "eu");
+        CHECK(route["shard"].as_int64() == 7);
+
+        auto tags = view["tags"].as_array();
+        CHECK(tags.size() == 3);
+        CHECK(tags.at(std::size_t(1)).as_string_view() == "b");
+        CHECK_THROWS(tags.at(std::size_t(3)));
+    }
+
+    SECTION("iteration")
+    {
+        auto it = j.object_range().begin();
+        for (const auto& element : view)
+        {
+            REQUIRE((it != j.object_range().end()));
+            CHECK(element.key() == it->key());
+            ++it;
+        }
+        CHECK((it == j.object_range().end()));
+    }
+
+    SECTION("truncated input")
+    {
+        CHECK_THROWS_AS(bson::bson_view(buffer.data(), buffer.size() - 1), ser_error);
+
+        // Corrupt the length of "name"
+        std::vector<uint8_t> bad(buffer);
+        auto elem = view.find("name");
+        std::size_t offset = static_cast<std::size_t>(elem->bytes().data() - buffer.data());
+        bad[offset] = 0xff;
+        bson::bson_view bad_view(bad.data(), bad.size());
+        CHECK_THROWS_AS(bad_view.find("tags"), ser_error);
+    }
+}
@@ -3,6 +3,10 @@
 
 #include <jsoncons_ext/bson/bson.hpp>
 #include <jsoncons/json.hpp>
+#include <map>
+#include <sstream>
+#include <streambuf>
+#include <string>
 #include <vector>
 #include <catch/catch.hpp>
 
@@ -231,3 +235,102 @@ TEST_CASE("encode decode bson source with temp_allocator")
 }
 
 #endif
+
+namespace {
+
+    // A stream buffer that cannot seek, so tellp() reports -1
+    class unseekable_buffer : public std::streambuf
+    {
+        std::string data_;
+    public:
+        const std::string& data() const
+        {
+            return data_;
+        }
+    protected:
+        int_type overflow(int_type ch) override
+        {
+            if (!traits_type::eq_int_type(ch, traits_type::eof()))
+            {
+                data_.push_back(traits_type::to_char_type(ch));
+            }
+            return ch;
+        }
+
+        std::streamsize xsputn(const char* s, std::streamsize count) override
+        {
+            data_.append(s, static_cast<std::size_t>(count));
+            return count;
+        }
+    };
+
+} // namespace
+
+TEST_CASE("encode bson with stream_output")
+{
+    // Large enough that document lengths are patched after leaving the encoder's buffer
+    json j;
+    json& a = j.try_emplace("a", json_array_arg).first->value();
+    for (std::size_t i = 0; i < 2000; ++i)
+    {
+        json item;
+        item.try_emplace("name", std::string(10, static_cast<char>('a' + i % 26)));
+        item.try_emplace("values", json(json_array_arg, {i, i+1, i+2}));
+        a.push_back(std::move(item));
+    }
+    j.try_emplace("b", 1.5);
+
+    std::vector<uint8_t> expected;
+    bson::encode_bson(j, expected);
+
+    auto options = bson::bson_options{}
+        .stream_output(true);
+
+    SECTION("bytes")
+    {
+        std::vector<uint8_t> buffer;
+        bson::encode_bson(j, buffer, options);
+        CHECK(buffer == expected);
+        CHECK(bson::decode_bson<json>(buffer) == j);
+    }
+
+    SECTION("seekable stream")
+    {
+        std::ostringstream os;
+        os << "prefix";
+        bson::encode_bson(j, os, options);
+        std::string s = os.str();
+        REQUIRE(s.size() == expected.size() + 6);
+        CHECK(std::equal(expected.begin(), expected.end(), s.begin() + 6, 
+            [](uint8_t x, char y){return x == static_cast<uint8_t>(y);}));
+    }
+
+    SECTION("unseekable stream")
+    {
+        unseekable_buffer buf;
+        std::ostream os(&buf);
+        REQUIRE(os.tellp() == std::ostream::pos_type(-1));
+        bson::encode_bson(j, os, options);
+        const std::string& s = buf.data();
+        std::vector<uint8_t> bytes(s.begin(), s.end());
+        CHECK(bytes == expected);
+    }
+
+    SECTION("unseekable stream, reflected type")
+    {
+        std::map<std::string,std::vector<std::string>> m;
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            m.emplace(std::to_string(i), std::vector<std::string>(20, std::string(10,'x')));
+        }
+        std::vector<uint8_t> expected2;
+        bson::encode_bson(m, expected2);
+
+        unseekable_buffer buf;
+        std::ostream os(&buf);
+        bson::encode_bson(m, os, options);
+        const std::string& s = buf.data();
+        std::vector<uint8_t> bytes(s.begin(), s.end());
+        CHECK(bytes == expected2);
+    }
+}
@@ -387,3 +387,207 @@ TEMPLATE_TEST_CASE("cbor_cursor reset test", "",
         CHECK(cursor.done());
     }
 }
+
+TEST_CASE("cbor_cursor skip test")
+{
+    SECTION("definite length")
+    {
+        ojson j = ojson::parse(R"(
+        {
+            "skipped" : {"a" : [1, -2, 3.5, {"b" : "c"}], "d" : null, "e" : [[],{}]},
+            "kept" : [true, "x"]
+        }
+        )");
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(j, data);
+
+        cbor::cbor_bytes_cursor cursor(data);
+        REQUIRE(staj_events::begin_object == cursor.current().event_type());
+        cursor.next();
+        CHECK(cursor.current().get<std::string>() == "skipped");
+        cursor.next();
+        REQUIRE(staj_events::begin_object == cursor.current().event_type());
+        cursor.skip();
+        CHECK(staj_events::end_object == cursor.current().event_type());
+        cursor.next();
+        CHECK(cursor.current().get<std::string>() == "kept");
+        cursor.next();
+        REQUIRE(staj_events::begin_array == cursor.current().event_type());
+        cursor.next();
+        CHECK(staj_events::bool_value == cursor.current().event_type());
+        cursor.next();
+        CHECK(cursor.current().get<std::string>() == "x");
+        cursor.next();
+        CHECK(staj_events::end_array == cursor.current().event_type());
+        cursor.next();
+        CHECK(staj_events::end_object == cursor.current().event_type());
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("indefinite length")
+    {
+        // {_ "a": [_ 1, (_ h'00'), 1(1000)], "b": true}
+        std::vector<uint8_t> data = {0xbf,0x61,0x61,0x9f,0x01,0x5f,0x41,0x00,0xff,0xc1,0x19,0x03,0xe8,0xff,0x61,0x62,0xf5,0xff};
+
+        cbor::cbor_bytes_cursor cursor(data);
+        REQUIRE(staj_events::begin_object == cursor.current().event_type());
+        cursor.next();
+        cursor.next();
+        REQUIRE(staj_events::begin_array == cursor.current().event_type());
+        cursor.skip();
+        CHECK(staj_events::end_array == cursor.current().event_type());
+        cursor.next();
+        CHECK(cursor.current().get<std::string>() == "b");
+        cursor.next();
+        CHECK(cursor.current().get<bool>());
+        cursor.next();
+        CHECK(staj_events::end_object == cursor.current().event_type());
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("truncated")
+    {
+        std::vector<uint8_t> data = {0x82,0x83,0x01,0x02};
+
+        cbor::cbor_bytes_cursor cursor(data);
+        cursor.next();
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == cbor::cbor_errc::unexpected_eof);
+    }
+}
+
+namespace {
+
+    std::vector<staj_events> read_events(staj_cursor& cursor)
+    {
+        std::vector<staj_events> events;
+        for (; !cursor.done(); cursor.next())
+        {
+            events.push_back(cursor.current().event_type());
+        }
+        return events;
+    }
+
+} // namespace
+
+TEST_CASE("cbor_push_cursor test")
+{
+    // {_ "a": [_ 1, (_ h'00'), 1(1000)], "b": true}
+    std::vector<uint8_t> item1 = {0xbf,0x61,0x61,0x9f,0x01,0x5f,0x41,0x00,0xff,0xc1,0x19,0x03,0xe8,0xff,0x61,0x62,0xf5,0xff};
+    std::vector<uint8_t> item2;
+    cbor::encode_cbor(ojson::parse(R"({"name":"Jane Doe","values":[1,-2.5,[]],"blob":{}})"), item2);
+    std::vector<uint8_t> item3 = {0x19,0x03,0xe8}; // 1000
+
+    std::vector<uint8_t> data(item1);
+    data.insert(data.end(), item2.begin(), item2.end());
+    data.insert(data.end(), item3.begin(), item3.end());
+
+    std::vector<std::vector<staj_events>> expected;
+    for (const auto& item : {item1, item2, item3})
+    {
+        cbor::cbor_bytes_cursor cursor(item);
+        expected.push_back(read_events(cursor));
+    }
+
+    SECTION("one byte at a time")
+    {
+        cbor::cbor_push_cursor cursor;
+        std::vector<std::vector<staj_events>> actual(1);
+        std::size_t pos = 0;
+        while (actual.size() <= expected.size())
+        {
+            cursor.next();
+            if (cursor.need_more_input())
+            {
+                if (pos == data.size())
+                {
+                    break;
+                }
+                cursor.update(data.data() + pos, 1);
+                ++pos;
+            }
+            else if (cursor.done())
+            {
+                actual.emplace_back();
+                cursor.reset();
+                if (!cursor.need_more_input())
+                {
+                    actual.back().push_back(cursor.current().event_type());
+                }
+            }
+            else
+            {
+                actual.back().push_back(cursor.current().event_type());
+            }
+        }
+        actual.pop_back();
+        CHECK(expected == actual);
+        CHECK(pos == data.size());
+    }
+
+    SECTION("all at once")
+    {
+        cbor::cbor_push_cursor cursor;
+        cursor.update(data.data(), data.size());
+        cursor.next();
+        for (const auto& events : expected)
+        {
+            REQUIRE_FALSE(cursor.need_more_input());
+            CHECK(events == read_events(cursor));
+            cursor.reset();
+        }
+        CHECK(cursor.need_more_input());
+        CHECK(data.size() == cursor.column());
+    }
+}
+
+TEST_CASE("cbor_bytes_cursor string views into input")
+{
+    ojson j(json_object_arg);
+    j.try_emplace("name", "hiking");
+    j.try_emplace("data", byte_string{'H','e','l','l','o'});
+    j.try_emplace("tags", ojson(json_array_arg, {"advanced", "Marilyn C"}));
+
+    std::vector<uint8_t> data;
+    cbor::encode_cbor(j, data);
+    const char* first = reinterpret_cast<const char*>(data.data());
+    const char* last = first + data.size();
+
+    std::string input(data.begin(), data.end());
+    std::istringstream is(input);
+    cbor::cbor_stream_cursor stream_cursor(is);
+
+    cbor::cbor_bytes_cursor cursor(data);
+    std::size_t count = 0;
+    for (; !cursor.done(); cursor.next(), stream_cursor.next())
+    {
+        REQUIRE(cursor.current().event_type() == stream_cursor.current().event_type());
+        switch (cursor.current().event_type())
+        {
+            case staj_events::key:
+            case staj_events::string_value:
+            {
+                auto sv = cursor.current().get<string_view>();
+                CHECK((sv.data() >= first && sv.data() + sv.size() <= last));
+                CHECK(stream_cursor.current().get<string_view>() == sv);
+                ++count;
+                break;
+            }
+            case staj_events::byte_string_value:
+            {
+                auto bytes = cursor.current().get<byte_string_view>();
+                CHECK((reinterpret_cast<const char*>(bytes.data()) >= first));
+                CHECK((reinterpret_cast<const char*>(bytes.data()) + bytes.size() <= last));
+                CHECK(stream_cursor.current().get<byte_string_view>() == bytes);
+                ++count;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    CHECK(7 == count);
+}
@@ -455,6 +455,62 @@ TEST_CASE("encode stringref")
     CHECK(j2 == j);
 }
 
+TEST_CASE("cbor encode with stringref dictionary")
+{
+    ojson j = ojson::parse(R"(
+{"application" : "hiking", "reputons" : [{"rater" : "HikingAsylum", "assertion" : "advanced", "rating" : 0.9}]}
+)");
+
+    auto options = cbor::cbor_options{}
+        .pack_strings(true)
+        .stringref_dictionary({"application", "reputons", "rater", "assertion", "rating", "ok"});
+
+    std::vector<uint8_t> packed;
+    cbor::encode_cbor(j, packed, cbor::cbor_options{}.pack_strings(true));
+
+    std::vector<uint8_t> buf;
+    cbor::encode_cbor(j, buf, options);
+    CHECK(buf.size() < packed.size());
+
+    SECTION("decode with dictionary")
+    {
+        ojson j2 = cbor::decode_cbor<ojson>(buf, options);
+        CHECK(j2 == j);
+    }
+
+    SECTION("decode without dictionary")
+    {
+        std::error_code ec;
+        json_decoder<ojson> decoder;
+        cbor::cbor_bytes_reader reader(buf, decoder);
+        reader.read(ec);
+        CHECK(ec == cbor::cbor_errc::stringref_too_large);
+    }
+
+    SECTION("short dictionary entries are written inline")
+    {
+        std::vector<uint8_t> buf2;
+        cbor::encode_cbor(ojson("ok"), buf2, options);
+        std::vector<uint8_t> expected = {0xd9,0x01,0x00,0x62,'o','k'};
+        CHECK(expected == buf2);
+    }
+
+    SECTION("encoder reset keeps dictionary")
+    {
+        std::vector<uint8_t> buf2;
+        cbor::cbor_bytes_encoder encoder(buf2, options);
+        encoder.string_value("hiking");
+        encoder.flush();
+        encoder.reset();
+        encoder.string_value("hiking");
+        encoder.string_value("rater");
+        encoder.flush();
+        std::vector<uint8_t> expected = {0xd9,0x01,0x00,0x66,'h','i','k','i','n','g',
+            0x66,'h','i','k','i','n','g',0xd8,0x19,0x02};
+        CHECK(expected == buf2);
+    }
+}
+
 TEST_CASE("cbor encode with semantic_tags")
 {
     SECTION("string")
@@ -738,3 +738,16 @@ TEST_CASE("CBOR stringref tag 3")
 
     CHECK(expected == j);
 }
+
+TEST_CASE("cbor_reader with a concrete visitor type")
+{
+    ojson expected = ojson::parse(R"({"a":[1,-2,3.5,"four",true,null],"b":{"c":"d"}})");
+    std::vector<uint8_t> data;
+    cbor::encode_cbor(expected, data);
+
+    std::string buffer;
+    compact_json_string_encoder encoder(buffer);
+    cbor::basic_cbor_reader<bytes_source,std::allocator<char>,compact_json_string_encoder> reader(data, encoder);
+    reader.read();
+    CHECK(expected.to_string() == buffer);
+}
@@ -1289,3 +1289,178 @@ TEST_CASE("multi-dim classical array and typed array")
     }
 }
 
+
+TEST_CASE("cbor read_typed_array conversion tests")
+{
+    SECTION("Tag 81, float32, big endian, to double")
+    {
+        const std::vector<uint8_t> data = {
+            0xd8, 0x51, // Tag 81, float32, big endian
+            0x48,       // byte string (8)
+            0x3f, 0x80, 0x00, 0x00, // 1.0
+            0xc0, 0x00, 0x00, 0x00  // -2.0
+        };
+
+        auto u = cbor::decode_cbor<std::vector<double>>(data);
+        std::vector<double> expected = {1.0, -2.0};
+        CHECK(expected == u);
+    }
+
+    SECTION("Tag 86, float64, little endian, to double")
+    {
+        const std::vector<uint8_t> data = {
+            0xd8, 0x56, // Tag 86, float64, little endian
+            0x50,       // byte string (16)
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x40,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40
+        };
+
+        cbor::cbor_bytes_cursor cursor(data);
+        REQUIRE(cursor.is_typed_array());
+        std::vector<double> v;
+        cursor.read_typed_array(v);
+        std::vector<double> expected = {10.0, 20.0};
+        CHECK(expected == v);
+        CHECK(staj_events::end_array == cursor.current().event_type());
+    }
+}
+
+TEST_CASE("cbor cursor read_mdarray tests")
+{
+    std::vector<double> expected = {1,2,3,4,5,6,7,8,9,10,11,12};
+    std::vector<std::size_t> expected_extents = {2,3,2};
+
+    SECTION("typed array, row-major")
+    {
+        const std::vector<uint8_t> data = {
+            0xd8, 0x28,             // tag(40) row-major storage
+            0x82,                   // array(2)
+            0x83, 0x02, 0x03, 0x02, // shape [2, 3, 2]
+            0xd8, 0x40,             // tag(64) uint8 typed array
+            0x4c,                   // bytes(12)
+            0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+            0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c
+        };
+
+        cbor::cbor_bytes_cursor cursor(data);
+        std::vector<double> v;
+        std::vector<std::size_t> extents;
+        cursor.read_mdarray(v, extents);
+        CHECK(expected == v);
+        CHECK(expected_extents == extents);
+        CHECK(staj_events::end_array == cursor.current().event_type());
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("typed array, column-major")
+    {
+        const std::vector<uint8_t> data = {
+            0xd9, 0x04, 0x10,       // tag(1040) column-major storage
+            0x82,                   // array(2)
+            0x83, 0x02, 0x03, 0x02, // shape [2, 3, 2]
+            0xd8, 0x40,             // tag(64) uint8 typed array
+            0x4c,                   // bytes(12)
+            0x01, 0x07, 0x03, 0x09, 0x05, 0x0b,
+            0x02, 0x08, 0x04, 0x0a, 0x06, 0x0c
+        };
+
+        cbor::cbor_bytes_cursor cursor(data);
+        CHECK(mdarray_order::column_major == cursor.order());
+        std::vector<double> v;
+        std::vector<std::size_t> extents;
+        cursor.read_mdarray(v, extents);
+        CHECK(expected == v);
+        CHECK(expected_extents == extents);
+    }
+
+    SECTION("classical array, row-major")
+    {
+        const std::vector<uint8_t> data = {
+            0xd8, 0x28,             // tag(40) row-major storage
+            0x82,                   // array(2)
+            0x83, 0x02, 0x03, 0x02, // shape [2, 3, 2]
+            0x8c,                   // data array(12)
+            0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+            0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c
+        };
+
+        cbor::cbor_bytes_cursor cursor(data);
+        std::vector<double> v;
+        std::vector<std::size_t> extents;
+        cursor.read_mdarray(v, extents);
+        CHECK(expected == v);
+        CHECK(expected_extents == extents);
+        CHECK(staj_events::end_array == cursor.current().event_type());
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("non-empty target, column-major")
+    {
+        const std::vector<uint8_t> data = {
+            0xd9, 0x04, 0x10,       // tag(1040) column-major storage
+            0x82,                   // array(2)
+            0x83, 0x02, 0x03, 0x02, // shape [2, 3, 2]
+            0xd8, 0x40,             // tag(64) uint8 typed array
+            0x4c,                   // bytes(12)
+            0x01, 0x07, 0x03, 0x09, 0x05, 0x0b,
+            0x02, 0x08, 0x04, 0x0a, 0x06, 0x0c
+        };
+
+        cbor::cbor_bytes_cursor cursor(data);
+        std::vector<double> v = {100,200,300};
+        std::vector<std::size_t> extents = {7};
+        cursor.read_mdarray(v, extents);
+        CHECK(expected == v);
+        CHECK(expected_extents == extents);
+    }
+
+    SECTION("non-empty target, classical array")
+    {
+        const std::vector<uint8_t> data = {
+            0xd9, 0x04, 0x10,       // tag(1040) column-major storage
+            0x82,                   // array(2)
+            0x82, 0x02, 0x02,       // shape [2, 2]
+            0x84,                   // data array(4)
+            0x01, 0x03, 0x02, 0x04
+        };
+
+        cbor::cbor_bytes_cursor cursor(data);
+        std::vector<int> v = {9,9};
+        std::vector<std::size_t> extents;
+        cursor.read_mdarray(v, extents);
+        CHECK(std::vector<int>{1,2,3,4} == v);
+    }
+
+    SECTION("element count does not match extents")
+    {
+        const std::vector<uint8_t> data = {
+            0xd9, 0x04, 0x10,       // tag(1040) column-major storage
+            0x82,                   // array(2)
+            0x82, 0x02, 0x03,       // shape [2, 3]
+            0xd8, 0x40,             // tag(64) uint8 typed array
+            0x44,                   // bytes(4)
+            0x01, 0x02, 0x03, 0x04
+        };
+
+        cbor::cbor_bytes_cursor cursor(data);
+        std::vector<double> v;
+        std::vector<std::size_t> extents;
+        std::error_code ec;
+        cursor.read_mdarray(v, extents, ec);
+        CHECK(ec == conv_errc::invalid_mdarray);
+    }
+
+    SECTION("not a multi-dimensional array")
+    {
+        const std::vector<uint8_t> data = {0x82, 0x01, 0x02};
+
+        cbor::cbor_bytes_cursor cursor(data);
+        std::vector<double> v;
+        std::vector<std::size_t> extents;
+        std::error_code ec;
+        cursor.read_mdarray(v, extents, ec);
+        CHECK(ec == conv_errc::not_vector);
+    }
+}
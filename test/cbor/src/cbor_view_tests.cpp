@@ -0,0 +1,149 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <jsoncons/json.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+#include <catch/catch.hpp>
+
+using namespace jsoncons;
+
+TEST_CASE("cbor_view tests")
+{
+    json j = json::parse(R"(
+{"name":"Alice","count":42,"delta":-5,"ratio":1.5,"active":true,"missing":null,
+ "tags":["a","b",{"c":"x"}],"route":{"region":"eu","shard":7}}
+    )");
+    j.try_emplace("data", json(byte_string_arg, std::vector<uint8_t>{1,2,3}));
+
+    std::vector<uint8_t> buffer;
+    cbor::encode_cbor(j, buffer);
+
+    cbor::cbor_view view(buffer.data(), buffer.size());
+
+    SECTION("find and typed accessors")
+    {
+        CHECK(view.is_object());
+        CHECK(view.size() == j.size());
+        CHECK(view["name"].as_string_view() == "Alice");
+        CHECK(view["count"].as_uint64() == 42);
+        CHECK(view["delta"].as_int64() == -5);
+        CHECK(view["ratio"].as_double() == 1.5);
+        CHECK(view["active"].as_bool());
+        CHECK(view["missing"].is_null());
+        CHECK(view["data"].as_byte_string_view() == byte_string_view(std::vector<uint8_t>{1,2,3}));
+        CHECK(view["tags"].at(std::size_t(2))["c"].as_string_view() == "x");
+        CHECK(view["route"]["shard"].as_int64() == 7);
+
+        CHECK(view.contains("route"));
+        CHECK_FALSE(view.contains("nothere"));
+        CHECK_THROWS_AS(view["nothere"], key_not_found);
+        CHECK_THROWS(view["name"].as_int64());
+        CHECK_THROWS(view["tags"].at(std::size_t(3)));
+    }
+
+    SECTION("iteration")
+    {
+        auto it = j.object_range().begin();
+        for (const auto& member : view.object_range())
+        {
+            REQUIRE((it != j.object_range().end()));
+            CHECK(member.key().as_string_view() == it->key());
+            ++it;
+        }
+        CHECK((it == j.object_range().end()));
+
+        std::vector<std::string> tags;
+        for (const auto& item : view["tags"].array_range())
+        {
+            if (item.is_string())
+            {
+                tags.emplace_back(item.as_string_view());
+            }
+        }
+        CHECK(tags == std::vector<std::string>{"a","b"});
+    }
+
+    SECTION("truncated input")
+    {
+        // Only the bytes a read needs are scanned
+        cbor::cbor_view truncated(buffer.data(), buffer.size() - 1);
+        CHECK(truncated["name"].as_string_view() == "Alice");
+        CHECK_THROWS_AS(truncated["tags"], ser_error);
+        CHECK_THROWS_AS(truncated.bytes(), ser_error);
+    }
+
+    SECTION("index")
+    {
+        auto index = view.index();
+        CHECK(index.size() == j.size());
+        CHECK(index["name"].as_string_view() == "Alice");
+        CHECK(index["route"]["region"].as_string_view() == "eu");
+        CHECK(index.contains("route"));
+        CHECK_FALSE(index.contains("nothere"));
+        CHECK_THROWS_AS(index["nothere"], key_not_found);
+
+        auto tags = view["tags"].index();
+        CHECK(tags.size() == 3);
+        CHECK(tags.at(std::size_t(1)).as_string_view() == "b");
+        CHECK_THROWS(tags.at(std::size_t(3)));
+        CHECK_THROWS(view["name"].index());
+    }
+}
+
+TEST_CASE("cbor_view shared between threads")
+{
+    json j(json_array_arg);
+    for (int i = 0; i < 100; ++i)
+    {
+        json item;
+        item["id"] = i;
+        item["name"] = "item " + std::to_string(i);
+        j.push_back(std::move(item));
+    }
+    std::vector<uint8_t> buffer;
+    cbor::encode_cbor(j, buffer);
+
+    const cbor::cbor_view view(buffer.data(), buffer.size());
+    const auto index = view.index();
+
+    std::vector<int> sums(4, 0);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < sums.size(); ++t)
+    {
+        threads.emplace_back([&view, &index, &sums, t]()
+        {
+            for (std::size_t i = 0; i < 100; ++i)
+            {
+                sums[t] += static_cast<int>(view.at(i)["id"].as_int64() + index.at(i)["id"].as_int64());
+            }
+        });
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+    for (auto sum : sums)
+    {
+        CHECK(sum == 2*4950);
+    }
+}
+
+TEST_CASE("cbor_view indefinite length and tagged items")
+{
+    // {_ "a": [_ 1, 2], "b": 1(5)}
+    std::vector<uint8_t> input = {0xbf,0x61,'a',0x9f,0x01,0x02,0xff,0x61,'b',0xc1,0x1a,0x00,0x00,0x00,0x05,0xff};
+
+    cbor::cbor_view view(input.data(), input.size());
+
+    CHECK(view.size() == 2);
+    CHECK(view["a"].size() == 2);
+    CHECK(view["a"].at(std::size_t(1)).as_uint64() == 2);
+    CHECK(view["b"].has_tag());
+    CHECK(view["b"].tag() == 1);
+    CHECK(view["b"].as_uint64() == 5);
+    CHECK(view.bytes().size() == input.size());
+}
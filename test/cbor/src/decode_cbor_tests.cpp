@@ -6,9 +6,11 @@
 #endif
 
 #include <jsoncons_ext/cbor/cbor.hpp>
+#include <jsoncons_ext/cbor/decode_cbor_sequence.hpp>
 #include <jsoncons_ext/jsonpointer/jsonpointer.hpp>
 #include <jsoncons/json.hpp>
 
+#include <atomic>
 #include <sstream>
 #include <vector>
 #include <utility>
@@ -781,3 +783,82 @@ TEST_CASE("encode decode cbor source")
     }
 }
 
+
+TEST_CASE("decode cbor sequence")
+{
+    std::vector<uint8_t> input;
+    std::vector<json> expected;
+    for (int i = 0; i < 100; ++i)
+    {
+        json j;
+        j.try_emplace("id", i);
+        j.try_emplace("name", std::string(static_cast<std::size_t>(i % 7), 'x'));
+        j.try_emplace("values", json::parse("[1,2,3]"));
+        cbor::encode_cbor(j, input);
+        expected.push_back(j);
+    }
+
+    SECTION("split")
+    {
+        auto items = cbor::split_cbor_sequence(input);
+        REQUIRE(items.size() == expected.size());
+        CHECK(cbor::decode_cbor<json>(items[42]) == expected[42]);
+    }
+
+    SECTION("decode in parallel")
+    {
+        for (std::size_t num_threads : {std::size_t(1), std::size_t(3), std::size_t(0)})
+        {
+            auto values = cbor::decode_cbor_sequence<json>(input, cbor::cbor_decode_options(), num_threads);
+            CHECK(values == expected);
+        }
+    }
+
+    SECTION("decode into a user type")
+    {
+        std::vector<uint8_t> ints;
+        cbor::encode_cbor(1, ints);
+        cbor::encode_cbor(-20, ints);
+        cbor::encode_cbor(300, ints);
+        auto values = cbor::decode_cbor_sequence<int>(ints, cbor::cbor_decode_options(), 2);
+        CHECK(values == std::vector<int>{1,-20,300});
+    }
+
+    SECTION("empty sequence")
+    {
+        std::vector<uint8_t> empty;
+        CHECK(cbor::decode_cbor_sequence<json>(empty).empty());
+    }
+
+    SECTION("truncated item")
+    {
+        std::vector<uint8_t> truncated(input.begin(), input.end() - 1);
+        CHECK_THROWS_AS(cbor::decode_cbor_sequence<json>(truncated), ser_error);
+    }
+
+    SECTION("invalid item")
+    {
+        // 0x7f introduces an indefinite length text string, which may only contain text string chunks
+        std::vector<uint8_t> bad = {0x01,0x02,0x7f,0x41,0x61,0xff,0x03};
+        auto result = cbor::try_decode_cbor_sequence<json>(bad, cbor::cbor_decode_options(), 2);
+        REQUIRE_FALSE(result);
+        CHECK(result.error().column() == 2);
+    }
+
+    SECTION("exception thrown while decoding")
+    {
+        for (std::size_t failing : {std::size_t(1), std::size_t(5)}) // last of the caller's range, and of a worker's
+        {
+            std::atomic<int> calls{0};
+            CHECK_THROWS_AS(jsoncons::detail::parallel_for(8, 4, [&](std::size_t i)
+            {
+                if (i == failing)
+                {
+                    JSONCONS_THROW(std::runtime_error("decode failed"));
+                }
+                ++calls;
+            }), std::runtime_error);
+            CHECK(calls == 7);
+        }
+    }
+}
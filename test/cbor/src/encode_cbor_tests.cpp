@@ -253,3 +253,69 @@ TEST_CASE("encode_cbor allocator_set for temp only")
 }
 
 #endif
+
+TEST_CASE("encode_cbor exact size and fixed buffer")
+{
+    json j = json::parse(R"(
+{"name":"Alice","count":42,"big":4294967296,"delta":-500,"ratio":1.5,"active":true,"missing":null,
+ "tags":["a","b",{"c":"x"}],"text":"A somewhat longer string that needs a longer length header"}
+    )");
+
+    std::vector<uint8_t> expected;
+    cbor::encode_cbor(j, expected);
+
+    SECTION("encoded size")
+    {
+        CHECK(cbor::encoded_cbor_size(j) == expected.size());
+        std::vector<std::string> v = {"a","bc","def"};
+        std::vector<uint8_t> buffer;
+        cbor::encode_cbor(v, buffer);
+        CHECK(cbor::encoded_cbor_size(v) == buffer.size());
+    }
+
+    SECTION("fixed buffer")
+    {
+        std::vector<uint8_t> buffer(expected.size() + 10);
+        std::size_t length = cbor::encode_cbor_to_buffer(j, jsoncons::span<uint8_t>(buffer.data(), buffer.size()));
+        CHECK(length == expected.size());
+        buffer.resize(length);
+        CHECK(buffer == expected);
+    }
+
+    SECTION("fixed buffer too small")
+    {
+        std::vector<uint8_t> buffer(expected.size() - 1);
+        auto r = cbor::try_encode_cbor_to_buffer(j, jsoncons::span<uint8_t>(buffer.data(), buffer.size()));
+        REQUIRE_FALSE(r);
+        CHECK(r.error() == cbor::cbor_errc::buffer_too_small);
+    }
+
+    SECTION("fixed buffer too small, reflected type")
+    {
+        std::vector<std::string> v(100, "abc");
+        std::vector<uint8_t> buffer(10);
+        auto r = cbor::try_encode_cbor_to_buffer(v, jsoncons::span<uint8_t>(buffer.data(), buffer.size()));
+        REQUIRE_FALSE(r);
+        CHECK(r.error() == cbor::cbor_errc::buffer_too_small);
+    }
+
+    SECTION("encoded size of boundary values")
+    {
+        json values = json::parse(R"(
+[23,24,255,256,65535,65536,4294967295,4294967296,-24,-25,-256,-257,-65536,-65537,
+ -4294967296,-4294967297,18446744073709551615,-9223372036854775808,0.1,1e300,
+ "",{},[],"12345678901234567890123"]
+        )");
+        values.emplace_back(byte_string{1,2,3});
+        values.emplace_back("2025-01-01T00:00:00Z", semantic_tag::datetime);
+        for (const auto& item : values.array_range())
+        {
+            std::vector<uint8_t> buffer;
+            cbor::encode_cbor(item, buffer);
+            CHECK(cbor::encoded_cbor_size(item) == buffer.size());
+        }
+        std::vector<uint8_t> buffer;
+        cbor::encode_cbor(values, buffer);
+        CHECK(cbor::encoded_cbor_size(values) == buffer.size());
+    }
+}
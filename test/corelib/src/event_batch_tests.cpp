@@ -0,0 +1,209 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_reader.hpp>
+#include <jsoncons/event_batch.hpp>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include <catch/catch.hpp>
+
+using namespace jsoncons;
+
+namespace {
+
+    class counting_batch_visitor final : public batch_visitor
+    {
+    public:
+        std::vector<std::size_t> sizes;
+        std::size_t flushes{0};
+        json_decoder<json> decoder;
+    private:
+        void visit_batch(batch_type& batch, std::error_code& ec) final
+        {
+            sizes.push_back(batch.size());
+            batch.replay(decoder, ec);
+        }
+
+        void visit_flush() final
+        {
+            ++flushes;
+        }
+    };
+
+    class line_recording_visitor final : public default_json_visitor
+    {
+    public:
+        std::vector<std::size_t> lines;
+    private:
+        JSONCONS_VISITOR_RETURN_TYPE visit_uint64(uint64_t, semantic_tag, const ser_context& context, std::error_code&) final
+        {
+            lines.push_back(context.line());
+            JSONCONS_VISITOR_RETURN;
+        }
+    };
+
+} // namespace
+
+TEST_CASE("event_batch tests")
+{
+    std::string input = R"({"name":"Jane","ids":[1,-2,3.5,true,null],"nested":{"a":"b"}})";
+
+    SECTION("batches of 3 events")
+    {
+        counting_batch_visitor destination;
+        batching_json_visitor batcher(destination, 3);
+
+        json_string_reader reader(input, batcher);
+        reader.read();
+
+        std::size_t total = 0;
+        for (auto n : destination.sizes)
+        {
+            CHECK(n <= 3); //-V521
+            total += n;
+        }
+        CHECK(total == 17); //-V521
+        CHECK(destination.sizes.size() == 6); //-V521
+        CHECK(destination.flushes == 1); //-V521
+        CHECK(destination.decoder.get_result() == json::parse(input)); //-V521
+    }
+
+    SECTION("batch_to_json_visitor")
+    {
+        json_decoder<json> decoder;
+        batch_to_json_visitor destination(decoder);
+        batching_json_visitor batcher(destination);
+
+        json_string_reader reader(input, batcher);
+        reader.read();
+
+        CHECK(decoder.is_valid()); //-V521
+        CHECK(decoder.get_result() == json::parse(input)); //-V521
+    }
+
+    SECTION("concrete visitor type")
+    {
+        json_decoder<json> decoder;
+        batch_to_json_visitor destination(decoder);
+        batching_json_visitor batcher(destination, 4);
+
+        basic_json_reader<char,string_source<char>,std::allocator<char>,batching_json_visitor> reader(input, batcher);
+        reader.read();
+
+        CHECK(decoder.get_result() == json::parse(input)); //-V521
+    }
+
+    SECTION("byte strings and tags")
+    {
+        std::vector<uint8_t> bytes = {'H','e','l','l','o'};
+
+        event_batch batch;
+        batch.push_back(staj_events::begin_array, semantic_tag::none);
+        batch.push_back(byte_string_view(bytes), semantic_tag::base64);
+        batch.push_back(staj_events::string_value, jsoncons::string_view("2020-01-01"), semantic_tag::datetime);
+        batch.push_back(uint64_t(10), semantic_tag::epoch_second);
+        batch.push_back(staj_events::end_array, semantic_tag::none);
+        REQUIRE(batch.size() == 5); //-V521
+
+        json_decoder<json> decoder;
+        std::error_code ec;
+        batch.replay(decoder, ec);
+        REQUIRE_FALSE(ec);
+
+        json j = decoder.get_result();
+        REQUIRE(j.size() == 3); //-V521
+        CHECK(j[0].as<byte_string>() == byte_string(bytes.data(), bytes.size())); //-V521
+        CHECK(j[0].tag() == semantic_tag::base64); //-V521
+        CHECK(j[1].tag() == semantic_tag::datetime); //-V521
+        CHECK(j[2].tag() == semantic_tag::epoch_second); //-V521
+    }
+
+    SECTION("replay reports the recorded positions")
+    {
+        std::string text = "[1,\n2,\n\n3]";
+        line_recording_visitor destination;
+        batch_to_json_visitor to_json(destination);
+        batching_json_visitor batcher(to_json, 2);
+
+        json_string_reader reader(text, batcher);
+        reader.read();
+
+        CHECK((destination.lines == std::vector<std::size_t>{1,2,4})); //-V521
+    }
+}
+
+TEST_CASE("event_batch_queue tests")
+{
+    std::string input = R"([)";
+    for (int i = 0; i < 1000; ++i)
+    {
+        if (i > 0)
+        {
+            input.push_back(',');
+        }
+        input.append(R"({"id":)" + std::to_string(i) + R"(,"name":"item )" + std::to_string(i) + R"("})");
+    }
+    input.push_back(']');
+
+    SECTION("parse on one thread, decode on another")
+    {
+        event_batch_queue queue(2);
+
+        std::thread producer([&]()
+        {
+            batching_json_visitor batcher(queue, 64);
+            json_string_reader reader(input, batcher);
+            std::error_code ec;
+            reader.read(ec);
+            queue.close();
+        });
+
+        json_decoder<json> decoder;
+        std::error_code ec;
+        queue.replay(decoder, ec);
+        producer.join();
+
+        REQUIRE_FALSE(ec);
+        CHECK(decoder.get_result() == json::parse(input)); //-V521
+    }
+
+    SECTION("consumer closes the queue")
+    {
+        event_batch_queue queue(1);
+        std::error_code producer_ec;
+
+        std::thread producer([&]()
+        {
+            batching_json_visitor batcher(queue, 16);
+            json_string_reader reader(input, batcher);
+            reader.read(producer_ec);
+            queue.close();
+        });
+
+        event_batch batch;
+        REQUIRE(queue.pop(batch)); //-V521
+        CHECK(batch.size() == 16); //-V521
+        queue.close();
+        producer.join();
+
+        CHECK(producer_ec == std::errc::operation_canceled); //-V521
+    }
+
+    SECTION("flush into a closed queue")
+    {
+        event_batch_queue queue(1);
+        queue.close();
+
+        batching_json_visitor batcher(queue, 4096);
+        json_string_reader reader(std::string(R"({"a":1})"), batcher);
+        std::error_code ec;
+        REQUIRE_NOTHROW(reader.read(ec));
+        CHECK(batcher.error() == std::errc::operation_canceled); //-V521
+
+        batcher.begin_array(semantic_tag::none, ser_context(), ec);
+        CHECK(ec == std::errc::operation_canceled); //-V521
+    }
+}
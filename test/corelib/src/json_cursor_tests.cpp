@@ -679,3 +679,218 @@ TEMPLATE_TEST_CASE("json_cursor reset test", "",
         CHECK(cursor.done());
     }
 }
+
+TEST_CASE("json_cursor skip test")
+{
+    std::string data = R"(
+{
+    "skipped" : {"a" : [1, {"b" : "]}"}, "x\"}"], "c" : {}},
+    "comment" : /* ] */ [1,2] // }
+    ,
+    "kept" : [true, null]
+}
+    )";
+
+    SECTION("skip objects and arrays")
+    {
+        auto options = json_options{}.allow_comments(true);
+        json_string_cursor cursor(data, options);
+
+        REQUIRE(staj_events::begin_object == cursor.current().event_type());
+        cursor.next();
+        CHECK(cursor.current().get<std::string>() == "skipped");
+        cursor.next();
+        REQUIRE(staj_events::begin_object == cursor.current().event_type());
+        cursor.skip();
+        CHECK(staj_events::end_object == cursor.current().event_type());
+        cursor.next();
+        CHECK(cursor.current().get<std::string>() == "comment");
+        cursor.next();
+        REQUIRE(staj_events::begin_array == cursor.current().event_type());
+        cursor.skip();
+        CHECK(staj_events::end_array == cursor.current().event_type());
+        cursor.next();
+        CHECK(cursor.current().get<std::string>() == "kept");
+        cursor.next();
+        CHECK(staj_events::begin_array == cursor.current().event_type());
+        cursor.next();
+        CHECK(staj_events::bool_value == cursor.current().event_type());
+        cursor.next();
+        CHECK(staj_events::null_value == cursor.current().event_type());
+        cursor.next();
+        CHECK(staj_events::end_array == cursor.current().event_type());
+        cursor.next();
+        CHECK(staj_events::end_object == cursor.current().event_type());
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("skip root from stream")
+    {
+        std::istringstream is(data);
+        auto options = json_options{}.allow_comments(true);
+        json_stream_cursor cursor(is, options);
+
+        REQUIRE(staj_events::begin_object == cursor.current().event_type());
+        cursor.skip();
+        CHECK(staj_events::end_object == cursor.current().event_type());
+        CHECK(7 == cursor.line());
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("skip scalar is no-op")
+    {
+        json_string_cursor cursor(R"([1,[2]])");
+        cursor.next();
+        REQUIRE(staj_events::uint64_value == cursor.current().event_type());
+        cursor.skip();
+        CHECK(staj_events::uint64_value == cursor.current().event_type());
+        cursor.next();
+        cursor.skip();
+        CHECK(staj_events::end_array == cursor.current().event_type());
+        cursor.next();
+        CHECK(staj_events::end_array == cursor.current().event_type());
+    }
+
+    SECTION("skip unbalanced")
+    {
+        json_string_cursor cursor(R"({"a":[1,2)");
+        cursor.next();
+        cursor.next();
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == json_errc::unexpected_eof);
+    }
+}
+
+TEST_CASE("json_push_cursor test")
+{
+    std::string data = R"({"name":"Jane Doe","values":[1,2.5,true],"skipped":{"a":[1,{"b":"}"}]},"id":123})";
+
+    SECTION("one byte at a time")
+    {
+        json_push_cursor cursor;
+        CHECK(cursor.need_more_input());
+
+        std::vector<staj_events> events;
+        std::vector<std::string> strings;
+        std::size_t pos = 0;
+        std::error_code ec;
+        while (!cursor.done())
+        {
+            cursor.next(ec);
+            REQUIRE_FALSE(ec);
+            if (cursor.need_more_input())
+            {
+                if (pos < data.size())
+                {
+                    cursor.update(data.data() + pos, 1);
+                    ++pos;
+                }
+                else
+                {
+                    cursor.finish();
+                }
+                continue;
+            }
+            if (cursor.done())
+            {
+                break;
+            }
+            events.push_back(cursor.current().event_type());
+            if (cursor.current().event_type() == staj_events::key || cursor.current().event_type() == staj_events::string_value)
+            {
+                strings.push_back(cursor.current().get<std::string>());
+            }
+        }
+        std::vector<staj_events> expected = {staj_events::begin_object, staj_events::key, staj_events::string_value,
+            staj_events::key, staj_events::begin_array, staj_events::uint64_value, staj_events::double_value, staj_events::bool_value, staj_events::end_array,
+            staj_events::key, staj_events::begin_object, staj_events::key, staj_events::begin_array, staj_events::uint64_value,
+            staj_events::begin_object, staj_events::key, staj_events::string_value, staj_events::end_object, staj_events::end_array, staj_events::end_object,
+            staj_events::key, staj_events::uint64_value, staj_events::end_object};
+        CHECK(expected == events);
+        std::vector<std::string> expected_strings = {"name","Jane Doe","values","skipped","a","b","}","id"};
+        CHECK(expected_strings == strings);
+    }
+
+    SECTION("top level number needs finish")
+    {
+        json_push_cursor cursor;
+        cursor.update("12");
+        cursor.next();
+        CHECK(cursor.need_more_input());
+        cursor.update("3");
+        cursor.next();
+        CHECK(cursor.need_more_input());
+        cursor.finish();
+        cursor.next();
+        CHECK_FALSE(cursor.need_more_input());
+        REQUIRE(staj_events::uint64_value == cursor.current().event_type());
+        CHECK(123 == cursor.current().get<int>());
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("skip across updates")
+    {
+        json_push_cursor cursor;
+        cursor.update(data.substr(0, 56));
+        std::error_code ec;
+        cursor.next(ec);
+        while (!(cursor.current().event_type() == staj_events::key && cursor.current().get<std::string>() == "skipped"))
+        {
+            cursor.next(ec);
+            REQUIRE_FALSE(ec);
+            REQUIRE_FALSE(cursor.need_more_input());
+        }
+        cursor.next(ec);
+        REQUIRE(staj_events::begin_object == cursor.current().event_type());
+        cursor.skip(ec);
+        REQUIRE_FALSE(ec);
+        CHECK(cursor.need_more_input());
+        cursor.update(data.substr(56));
+        cursor.skip(ec);
+        REQUIRE_FALSE(ec);
+        CHECK_FALSE(cursor.need_more_input());
+        CHECK(staj_events::end_object == cursor.current().event_type());
+        cursor.next(ec);
+        CHECK(cursor.current().get<std::string>() == "id");
+    }
+
+    SECTION("read_to across updates")
+    {
+        json_push_cursor cursor;
+        cursor.update(data.substr(0, 30));
+        cursor.next();
+        cursor.next();
+        cursor.next();
+        cursor.next();
+        REQUIRE(staj_events::key == cursor.current().event_type());
+        cursor.next();
+        REQUIRE(staj_events::begin_array == cursor.current().event_type());
+
+        json_decoder<json> decoder;
+        cursor.read_to(decoder);
+        CHECK(cursor.need_more_input());
+        cursor.update(data.substr(30));
+        cursor.read_to(decoder);
+        CHECK_FALSE(cursor.need_more_input());
+        CHECK(staj_events::end_array == cursor.current().event_type());
+        CHECK(json::parse("[1,2.5,true]") == decoder.get_result());
+    }
+
+    SECTION("unexpected eof after finish")
+    {
+        json_push_cursor cursor;
+        cursor.update("[1,");
+        cursor.next();
+        cursor.next();
+        cursor.next();
+        CHECK(cursor.need_more_input());
+        cursor.finish();
+        std::error_code ec;
+        cursor.next(ec);
+        CHECK(ec == json_errc::unexpected_eof);
+    }
+}
@@ -352,6 +352,27 @@ TEST_CASE("json_reader json lines")
     }
 }
 
+TEST_CASE("json_reader with a concrete visitor type")
+{
+    std::string data = R"({"a":[1,-2,3.5,"four",true,null],"b":{"c":"d"}})";
+
+    SECTION("encoder")
+    {
+        std::string buffer;
+        compact_json_string_encoder encoder(buffer);
+        basic_json_reader<char,string_source<char>,std::allocator<char>,compact_json_string_encoder> reader(data, encoder);
+        reader.read();
+        CHECK(data == buffer);
+    }
+    SECTION("decoder")
+    {
+        json_decoder<ojson> decoder;
+        basic_json_reader<char,string_source<char>,std::allocator<char>,json_decoder<ojson>> reader(data, decoder);
+        reader.read();
+        CHECK(decoder.get_result() == ojson::parse(data));
+    }
+}
+
 #if defined(JSONCONS_HAS_STATEFUL_ALLOCATOR) && JSONCONS_HAS_STATEFUL_ALLOCATOR == 1
 
 #include <scoped_allocator>
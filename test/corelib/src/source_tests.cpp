@@ -618,3 +618,50 @@ TEST_CASE("binary_iterator_stream source tests")
         CHECK(9 == source.position());
     }
 }
+
+TEST_CASE("bytes_source read_buffer with length tests")
+{
+    std::vector<uint8_t> data = { 0,1,2,3,4,5,6,7,8 };
+    jsoncons::bytes_source source(data);
+
+    auto s = source.read_buffer(4);
+    CHECK(4 == s.size());
+    CHECK(data.data() == s.data());
+    CHECK(4 == source.position());
+
+    s = source.read_buffer(10);
+    CHECK(5 == s.size());
+    CHECK(data.data()+4 == s.data());
+    CHECK(source.eof());
+}
+
+TEST_CASE("source_reader read_view tests")
+{
+    std::vector<uint8_t> data = { 'a','b','c','d','e' };
+
+    SECTION("contiguous source")
+    {
+        CHECK(jsoncons::is_contiguous_source<jsoncons::bytes_source>::value);
+
+        jsoncons::bytes_source source(data);
+        std::string buffer;
+        auto s = jsoncons::source_reader<jsoncons::bytes_source>::read_view(source, buffer, 3);
+        CHECK(3 == s.size());
+        CHECK(reinterpret_cast<const char*>(data.data()) == s.data());
+        CHECK(buffer.empty());
+    }
+
+    SECTION("stream source")
+    {
+        CHECK_FALSE(jsoncons::is_contiguous_source<jsoncons::binary_stream_source>::value);
+
+        std::string input(data.begin(), data.end());
+        std::istringstream is(input);
+        jsoncons::binary_stream_source source(is);
+        std::string buffer = "x";
+        auto s = jsoncons::source_reader<jsoncons::binary_stream_source>::read_view(source, buffer, 10);
+        CHECK(5 == s.size());
+        CHECK(buffer.data() == s.data());
+        CHECK(std::string("abcde") == buffer);
+    }
+}
@@ -0,0 +1,130 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_cursor.hpp>
+#include <jsoncons/staj_generator.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <string>
+#include <vector>
+#include <utility>
+#include <catch/catch.hpp>
+
+#if defined(JSONCONS_HAS_COROUTINES)
+
+using namespace jsoncons;
+
+namespace {
+
+    struct mark
+    {
+        int enrollment_no;
+        std::string name;
+        int score;
+    };
+
+} // namespace
+
+JSONCONS_ALL_MEMBER_NAME_TRAITS(mark, (enrollment_no, "enrollmentNo"), (name, "name"), (score, "score"))
+
+TEST_CASE("staj_generator tests")
+{
+    std::string data = R"([{"enrollmentNo":100,"name":"Tom","score":55},{"enrollmentNo":101,"name":"Catherine","score":95}])";
+
+    SECTION("records from pull cursor")
+    {
+        json_string_cursor cursor(data);
+        std::vector<std::string> names;
+        for (const auto& m : staj_array_generator<mark>(cursor))
+        {
+            names.push_back(m.name);
+        }
+        CHECK(names == std::vector<std::string>{"Tom", "Catherine"});
+    }
+
+    SECTION("records from push cursor")
+    {
+        json_push_cursor cursor;
+        auto gen = staj_array_generator<mark>(cursor);
+
+        std::vector<mark> marks;
+        std::size_t starved = 0;
+        for (std::size_t pos = 0; pos < data.size(); pos += 7)
+        {
+            cursor.update(data.substr(pos, 7));
+            while (gen.next())
+            {
+                marks.push_back(gen.value());
+            }
+            REQUIRE_FALSE(gen.error());
+            if (gen.need_more_input())
+            {
+                ++starved;
+            }
+        }
+        CHECK(gen.done());
+        CHECK(starved > 2);
+        REQUIRE(marks.size() == 2);
+        CHECK(marks[0].enrollment_no == 100);
+        CHECK(marks[1].name == "Catherine");
+        CHECK(marks[1].score == 95);
+    }
+
+    SECTION("events from push cursor")
+    {
+        json_push_cursor cursor;
+        auto gen = staj_event_generator(cursor);
+        CHECK_FALSE(gen.next());
+        CHECK(gen.need_more_input());
+
+        cursor.update(R"([1,"ab)");
+        std::vector<staj_events> events;
+        for (const auto& event : gen)
+        {
+            events.push_back(event.event_type());
+        }
+        CHECK(gen.need_more_input());
+        cursor.update(R"(c",true])");
+        for (const auto& event : gen)
+        {
+            events.push_back(event.event_type());
+        }
+        CHECK(events == std::vector<staj_events>{staj_events::begin_array, staj_events::uint64_value, 
+            staj_events::string_value, staj_events::bool_value, staj_events::end_array});
+        CHECK_FALSE(gen.next());
+        CHECK(gen.done());
+    }
+
+    SECTION("records from cbor push cursor")
+    {
+        std::vector<uint8_t> bytes;
+        cbor::encode_cbor(json::parse(data), bytes);
+
+        cbor::cbor_push_cursor cursor;
+        auto gen = staj_array_generator<mark>(cursor);
+        cursor.update(bytes.data(), bytes.size()/2);
+        CHECK_FALSE(gen.next());
+        CHECK(gen.need_more_input());
+        cursor.update(bytes.data() + bytes.size()/2, bytes.size() - bytes.size()/2);
+        std::vector<std::string> names;
+        while (gen.next())
+        {
+            names.push_back(gen.value().name);
+        }
+        CHECK(names == std::vector<std::string>{"Tom", "Catherine"});
+    }
+
+    SECTION("not an array")
+    {
+        json_string_cursor cursor(R"({"a":1})");
+        auto gen = staj_array_generator<mark>(cursor);
+        CHECK_FALSE(gen.next());
+        CHECK(gen.error() == conv_errc::not_array);
+        CHECK(gen.done());
+    }
+}
+
+#endif // defined(JSONCONS_HAS_COROUTINES)
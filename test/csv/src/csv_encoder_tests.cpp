@@ -890,3 +890,49 @@ Chicago Sun-Times,1.27
     }    
 }
 
+
+TEST_CASE("csv_encoder rows written in fixed column layout")
+{
+    std::string jtext = R"(
+[
+    {"a" : 1, "b" : "x,y", "c" : true},
+    {"b" : "two", "a" : 2.5, "c" : null},
+    {"a" : 3, "c" : false},
+    {"c" : [1,2], "a" : 4, "d" : "ignored"},
+    {"a" : 5, "b" : "five", "c" : "end"}
+]
+    )";
+    auto j = jsoncons::json::parse(jtext);
+
+    SECTION("layout from first row")
+    {
+        std::string expected = R"(a,b,c
+1,"x,y",true
+2.5,two,null
+3,,false
+4,,1;2
+5,five,end
+)";
+        auto options = csv::csv_options{}
+            .subfield_delimiter(';');
+        std::string buf;
+        csv::encode_csv(j, buf, options);
+        CHECK(expected == buf);
+    }
+
+    SECTION("layout from column_names")
+    {
+        std::string expected = R"(c,a
+true,1
+null,2.5
+false,3
+,4
+end,5
+)";
+        auto options = csv::csv_options{}
+            .column_names("c,a");
+        std::string buf;
+        csv::encode_csv(j, buf, options);
+        CHECK(expected == buf);
+    }
+}
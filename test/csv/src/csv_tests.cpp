@@ -1725,3 +1725,156 @@ TEST_CASE("csv_parser edge cases")
         REQUIRE(j[0].empty());
     }
 }
+
+TEST_CASE("csv long fields scanned in runs")
+{
+    std::string long_text(50, 'x');
+    std::string input = "#a comment line that is longer than eight characters\n"
+        "name,description,value\n"
+        "abcdefghijklmnop," + long_text + ",123456789\n"
+        "\"quoted, with \"\"escaped\"\" quotes and more text\",  padded field with spaces  ,7\r\n"
+        "a,\"multi\nline quoted field\",8\n";
+
+    auto options = csv::csv_options{}
+        .assume_header(true)
+        .comment_starter('#')
+        .trim(true);
+
+    json j = csv::decode_csv<json>(input, options);
+    REQUIRE(j.size() == 3);
+    CHECK(j[0]["name"].as<std::string>() == "abcdefghijklmnop");
+    CHECK(j[0]["description"].as<std::string>() == long_text);
+    CHECK(j[0]["value"].as<int64_t>() == 123456789);
+    CHECK(j[1]["name"].as<std::string>() == "quoted, with \"escaped\" quotes and more text");
+    CHECK(j[1]["description"].as<std::string>() == "padded field with spaces");
+    CHECK(j[1]["value"].as<int>() == 7);
+    CHECK(j[2]["description"].as<std::string>() == "multi\nline quoted field");
+
+    SECTION("from a stream")
+    {
+        std::istringstream is(input);
+        json_decoder<json> decoder;
+        csv::csv_stream_reader reader(is, decoder, options);
+        reader.read();
+        CHECK(decoder.get_result() == j);
+    }
+
+    SECTION("wide characters")
+    {
+        std::wstring winput(input.begin(), input.end());
+        auto woptions = csv::wcsv_options{}
+            .assume_header(true)
+            .comment_starter(L'#')
+            .trim(true);
+        wjson wj = csv::decode_csv<wjson>(winput, woptions);
+        REQUIRE(wj.size() == 3);
+        CHECK(wj[1][L"name"].as<std::wstring>() == L"quoted, with \"escaped\" quotes and more text");
+    }
+}
+
+TEST_CASE("csv type_sample_rows")
+{
+    std::string input = R"(id,name,score,flag,code
+1,alpha,1.5,true,10
+2,beta,2.25,false,x
+3,gamma,3,true,007
+-4,null,4.5e1,null,-
+18446744073709551616,5,1e400,TRUE,0
+)";
+
+    auto options = csv::csv_options{}
+        .assume_header(true);
+    json expected = csv::decode_csv<json>(input, options);
+
+    options.type_sample_rows(2);
+    json j = csv::decode_csv<json>(input, options);
+
+    REQUIRE(expected.size() == j.size()); //-V521
+    for (std::size_t i = 0; i < j.size(); ++i)
+    {
+        CHECK(expected[i]["id"] == j[i]["id"]); //-V521
+        CHECK(expected[i]["name"] == j[i]["name"]); //-V521
+        CHECK(expected[i]["flag"] == j[i]["flag"]); //-V521
+        CHECK(expected[i]["code"] == j[i]["code"]); //-V521
+    }
+    CHECK(j[0]["id"].is_uint64()); //-V521
+    CHECK(j[3]["id"].is_int64()); //-V521
+    CHECK(j[4]["id"].tag() == semantic_tag::bigint); //-V521
+    CHECK(j[4]["name"].as<int>() == 5); //-V521
+    CHECK(j[3]["name"].is_null()); //-V521
+
+    // A learned floating point column reports integer fields as doubles
+    CHECK(expected[2]["score"].is_uint64()); //-V521
+    CHECK(j[2]["score"].is_double()); //-V521
+    CHECK(j[2]["score"].as<double>() == 3.0); //-V521
+    CHECK(j[3]["score"].as<double>() == 45.0); //-V521
+    CHECK(expected[4]["score"].as<double>() == j[4]["score"].as<double>()); //-V521
+}
+
+TEST_CASE("csv spill_columns")
+{
+    std::string input = R"(Date,ProductType,1Y,2Y,Tags
+2017-01-09,"Bond, ""senior""",0.0062,7,a;b
+2017-01-08,Bond,,-8,c
+2017-01-07,,0.0063,true,
+)";
+
+    auto options = csv::csv_options{}
+        .assume_header(true)
+        .subfield_delimiter(';')
+        .mapping_kind(csv::csv_mapping_kind::m_columns);
+    ojson expected = csv::decode_csv<ojson>(input, options);
+
+    options.spill_columns(true);
+    ojson j = csv::decode_csv<ojson>(input, options);
+    CHECK(expected == j); //-V521
+    CHECK(3 == j["Date"].size()); //-V521
+    CHECK(j["ProductType"][0].as<std::string>() == "Bond, \"senior\""); //-V521
+    CHECK(j["Tags"][0].size() == 2); //-V521
+
+    SECTION("ignore_empty_values")
+    {
+        options.ignore_empty_values(true);
+        options.spill_columns(false);
+        expected = csv::decode_csv<ojson>(input, options);
+        options.spill_columns(true);
+        j = csv::decode_csv<ojson>(input, options);
+        CHECK(expected == j); //-V521
+        CHECK(2 == j["1Y"].size()); //-V521
+    }
+
+    SECTION("more columns than file handles, values spanning blocks")
+    {
+        std::string data;
+        const std::size_t columns = 1500;
+        for (std::size_t i = 0; i < columns; ++i)
+        {
+            data += (i == 0 ? "c" : ",c") + std::to_string(i);
+        }
+        data += "\n";
+        for (std::size_t row = 0; row < 300; ++row)
+        {
+            for (std::size_t i = 0; i < columns; ++i)
+            {
+                data += (i == 0 ? "" : ",") + std::to_string(row * i);
+            }
+            data += "\n";
+        }
+        data += std::string(10000, 'x');
+        for (std::size_t i = 1; i < columns; ++i)
+        {
+            data += ",v";
+        }
+        data += "\n";
+
+        auto options2 = csv::csv_options{}
+            .assume_header(true)
+            .mapping_kind(csv::csv_mapping_kind::m_columns);
+        ojson expected2 = csv::decode_csv<ojson>(data, options2);
+        options2.spill_columns(true);
+        ojson j2 = csv::decode_csv<ojson>(data, options2);
+        CHECK(expected2 == j2); //-V521
+        CHECK(301 == j2["c0"].size()); //-V521
+        CHECK(j2["c0"][300].as<std::string>().size() == 10000); //-V521
+    }
+}
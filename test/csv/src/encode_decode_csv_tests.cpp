@@ -6,6 +6,7 @@
 #endif
 
 #include <jsoncons_ext/csv/csv.hpp>
+#include <jsoncons_ext/csv/decode_csv_parallel.hpp>
 
 #include <jsoncons/json.hpp>
 #include <jsoncons/json_reader.hpp>
@@ -182,6 +183,241 @@ TEST_CASE("decode_csv non-numeric string into double reports error")
 }
 
 
+TEST_CASE("decode_csv_parallel")
+{
+    std::string input = "name,note,value\n";
+    for (int i = 0; i < 200; ++i)
+    {
+        input += "row" + std::to_string(i) + ",";
+        if (i % 7 == 0)
+        {
+            input += "\"multi\nline, \"\"quoted\"\"\n\"";
+        }
+        else
+        {
+            input += "plain";
+        }
+        input += "," + std::to_string(i) + "\n";
+    }
+
+    SECTION("n_objects")
+    {
+        auto options = csv::csv_options{}
+            .assume_header(true);
+        json expected = csv::decode_csv<json>(input, options);
+        REQUIRE(200 == expected.size()); //-V521
+
+        for (std::size_t num_threads : {1, 2, 3, 8, 64})
+        {
+            json j = csv::decode_csv_parallel<json>(input, options, num_threads);
+            CHECK(expected == j); //-V521
+        }
+        CHECK(expected == csv::decode_csv_parallel<json>(input, options)); //-V521
+    }
+
+    SECTION("n_rows into tuples")
+    {
+        using cpp_type = std::vector<std::tuple<std::string,std::string,int>>;
+        auto options = csv::csv_options{}
+            .mapping_kind(csv::csv_mapping_kind::n_rows);
+        std::string body = input.substr(input.find('\n') + 1);
+        auto expected = csv::decode_csv<cpp_type>(body, options);
+        REQUIRE(200 == expected.size()); //-V521
+
+        auto result = csv::try_decode_csv_parallel<cpp_type>(body, options, 5);
+        REQUIRE(result); //-V521
+        CHECK(expected == *result); //-V521
+    }
+
+    SECTION("error reports line in whole input")
+    {
+        using cpp_type = std::vector<std::tuple<std::string,std::string,int>>;
+        auto options = csv::csv_options{}
+            .mapping_kind(csv::csv_mapping_kind::n_rows);
+        std::string body = input.substr(input.find('\n') + 1);
+        body += "last,plain,x\n";
+
+        auto expected = csv::try_decode_csv<cpp_type>(body, options);
+        REQUIRE(!expected); //-V521
+        auto result = csv::try_decode_csv_parallel<cpp_type>(body, options, 4);
+        REQUIRE(!result); //-V521
+        CHECK(expected.error().code() == result.error().code()); //-V521
+        CHECK(expected.error().line() == result.error().line()); //-V521
+        REQUIRE_THROWS(csv::decode_csv_parallel<cpp_type>(body, options, 4));
+    }
+
+    SECTION("carriage return line endings")
+    {
+        auto options = csv::csv_options{}
+            .assume_header(true);
+        json expected = csv::decode_csv<json>(input, options);
+
+        for (const std::string& ending : {std::string("\r"), std::string("\r\n")})
+        {
+            std::string text;
+            for (char c : input)
+            {
+                if (c == '\n')
+                {
+                    text += ending;
+                }
+                else
+                {
+                    text.push_back(c);
+                }
+            }
+            json serial = csv::decode_csv<json>(text, options);
+            REQUIRE(200 == serial.size()); //-V521
+            for (std::size_t num_threads : {2, 3, 8, 64})
+            {
+                CHECK(serial == csv::decode_csv_parallel<json>(text, options, num_threads)); //-V521
+            }
+        }
+    }
+
+    SECTION("column types sampled once")
+    {
+        std::string text = "id,amount\n";
+        for (int i = 0; i < 200; ++i)
+        {
+            text += std::to_string(i) + "," + (i < 5 ? "1.5" : "2") + "\n";
+        }
+        auto options = csv::csv_options{}
+            .assume_header(true)
+            .type_sample_rows(5);
+        std::string expected = csv::decode_csv<json>(text, options).to_string();
+        REQUIRE(expected.find("2.0") != std::string::npos); //-V521
+
+        for (std::size_t num_threads : {2, 3, 8, 64})
+        {
+            CHECK(expected == csv::decode_csv_parallel<json>(text, options, num_threads).to_string()); //-V521
+        }
+        using cpp_type = std::vector<std::tuple<int,double>>;
+        CHECK(csv::decode_csv<cpp_type>(text, options) == csv::decode_csv_parallel<cpp_type>(text, options, 8)); //-V521
+    }
+
+    SECTION("more than one header line")
+    {
+        std::string text = "a,b\nc,d\n1,2\n3,4\n5,6\n7,8\n";
+        auto options = csv::csv_options{}
+            .assume_header(true)
+            .header_lines(2);
+        json expected = csv::decode_csv<json>(text, options);
+        REQUIRE(5 == expected.size()); //-V521
+
+        for (std::size_t num_threads : {2, 3, 8})
+        {
+            CHECK(expected == csv::decode_csv_parallel<json>(text, options, num_threads)); //-V521
+        }
+        options.type_sample_rows(2);
+        CHECK(csv::decode_csv<json>(text, options) == csv::decode_csv_parallel<json>(text, options, 2)); //-V521
+    }
+}
+
+
+TEST_CASE("decode_csv into csv_table")
+{
+    std::string input = R"(name,qty,price,flag,mixed
+apple,3,1.25,true,1
+pear,,2,false,x
+plum,7,0.5,,2.5
+)";
+
+    SECTION("inferred types")
+    {
+        auto options = csv::csv_options{}
+            .assume_header(true)
+            .mapping_kind(csv::csv_mapping_kind::m_columns);
+        auto table = csv::decode_csv<csv::csv_table>(input, options);
+
+        REQUIRE(3 == table.rows()); //-V521
+        REQUIRE(5 == table.columns().size()); //-V521
+
+        const auto& name = table.at("name");
+        CHECK(csv::csv_column_type::string_t == name.type()); //-V521
+        CHECK((name.strings() == std::vector<std::string>{"apple","pear","plum"})); //-V521
+
+        const auto& qty = table.at("qty");
+        CHECK(csv::csv_column_type::string_t == qty.type()); //-V521
+
+        const auto& price = table.at("price");
+        CHECK(csv::csv_column_type::float_t == price.type()); //-V521
+        CHECK((price.floats() == std::vector<double>{1.25,2.0,0.5})); //-V521
+
+        const auto& mixed = table.at("mixed");
+        CHECK(csv::csv_column_type::string_t == mixed.type()); //-V521
+        CHECK((mixed.strings() == std::vector<std::string>{"1","x","2.5"})); //-V521
+
+        CHECK(table.find("missing") == nullptr); //-V521
+        CHECK_THROWS(table.at("missing"));
+    }
+
+    SECTION("column_types")
+    {
+        auto options = csv::csv_options{}
+            .assume_header(true)
+            .column_types("string,integer,float,boolean,string");
+        auto table = csv::decode_csv<csv::csv_table>(input, options);
+
+        REQUIRE(3 == table.rows()); //-V521
+        const auto& qty = table[1];
+        CHECK(csv::csv_column_type::integer_t == qty.type()); //-V521
+        CHECK((qty.integers() == std::vector<int64_t>{3,0,7})); //-V521
+        CHECK_FALSE(qty.is_null(0)); //-V521
+        CHECK(qty.is_null(1)); //-V521
+
+        const auto& flag = table[3];
+        CHECK(csv::csv_column_type::boolean_t == flag.type()); //-V521
+        CHECK((flag.booleans() == std::vector<bool>{true,false,false})); //-V521
+        CHECK(flag.is_null(2)); //-V521
+    }
+
+    SECTION("no header, from stream")
+    {
+        std::stringstream is("1,2\n3,4,5\n");
+        auto options = csv::csv_options{}
+            .assume_header(false);
+        auto result = csv::try_decode_csv<csv::csv_table>(is, options);
+        REQUIRE(result); //-V521
+        REQUIRE(2 == result->rows()); //-V521
+        REQUIRE(3 == result->columns().size()); //-V521
+        CHECK((result->columns()[0].integers() == std::vector<int64_t>{1,3})); //-V521
+        CHECK(result->columns()[2].is_null(0)); //-V521
+        CHECK(5 == result->columns()[2].integers()[1]); //-V521
+    }
+
+    SECTION("subfields")
+    {
+        auto options = csv::csv_options{}
+            .assume_header(true)
+            .subfield_delimiter(';');
+        auto result = csv::try_decode_csv<csv::csv_table>(std::string("a,b\n1;2,3\n"), options);
+        REQUIRE_FALSE(result); //-V521
+        CHECK(conv_errc::conversion_failed == result.error().code()); //-V521
+    }
+
+    SECTION("integers beyond 2^53")
+    {
+        std::string data = "big,small,huge\n9007199254740993,1,18446744073709551615\n2.5,2,1\n";
+        auto options = csv::csv_options{}
+            .assume_header(true);
+        auto table = csv::decode_csv<csv::csv_table>(data, options);
+
+        const auto& big = table.at("big");
+        CHECK(csv::csv_column_type::string_t == big.type()); //-V521
+        CHECK((big.strings() == std::vector<std::string>{"9007199254740993","2.5"})); //-V521
+
+        const auto& huge = table.at("huge");
+        CHECK(csv::csv_column_type::string_t == huge.type()); //-V521
+        CHECK((huge.strings() == std::vector<std::string>{"18446744073709551615","1"})); //-V521
+
+        auto table2 = csv::decode_csv<csv::csv_table>(std::string("x\n2.5\n9007199254740993\n"), options);
+        CHECK(csv::csv_column_type::string_t == table2[0].type()); //-V521
+        CHECK((table2[0].strings() == std::vector<std::string>{"2.5","9007199254740993"})); //-V521
+    }
+}
+
+
 namespace
 {
 
@@ -0,0 +1,154 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+
+#include <jsoncons_ext/jsonpath/jsonpath.hpp>
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_cursor.hpp>
+
+#include <catch/catch.hpp>
+#include <algorithm>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace jsoncons;
+namespace jsonpath = jsoncons::jsonpath;
+
+namespace {
+
+    const std::string store = R"(
+{
+    "store": {
+        "book": [
+            {"category": "reference", "author": "Nigel Rees", "title": "Sayings of the Century", "price": 8.95},
+            {"category": "fiction", "author": "Evelyn Waugh", "title": "Sword of Honour", "price": 12.99},
+            {"category": "fiction", "author": "Herman Melville", "title": "Moby Dick", "isbn": "0-553-21311-3", "price": 8.99},
+            {"category": "fiction", "author": "J. R. R. Tolkien", "title": "The Lord of the Rings", "isbn": "0-395-19395-8", "price": 22.99}
+        ],
+        "bicycle": {"color": "red", "price": 19.95}
+    }
+}
+    )";
+
+    // Returns [[path, value], ...] in the order reported
+    json stream_select(const std::string& input, const std::string& path)
+    {
+        json result(json_array_arg);
+        json_string_cursor cursor(input);
+        jsonpath::stream_query<json>(cursor, path,
+            [&](const jsonpath::json_location& location, const json& value)
+            {
+                json item(json_array_arg);
+                item.push_back(jsonpath::to_string(location));
+                item.push_back(value);
+                result.push_back(std::move(item));
+            });
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        return result;
+    }
+
+    json dom_select(const std::string& input, const std::string& path)
+    {
+        json result(json_array_arg);
+        auto expr = jsonpath::make_expression<json>(path);
+        expr.select(json::parse(input),
+            [&](const jsonpath::path_node& p, const json& value)
+            {
+                json item(json_array_arg);
+                item.push_back(jsonpath::to_string(p));
+                item.push_back(value);
+                result.push_back(std::move(item));
+            }, jsonpath::result_options::nodups | jsonpath::result_options::sort);
+        return result;
+    }
+
+} // namespace
+
+TEST_CASE("jsonpath streaming_expression matches DOM evaluation")
+{
+    std::vector<std::string> paths = {
+        "$.store.book[1].title",
+        "$.store.book[*].author",
+        "$['store']['bicycle']",
+        "$.store.book[0,2].price",
+        "$.store.book[1:3].title",
+        "$.store.book[::2].title",
+        "$..price",
+        "$..book[2]",
+        "$.store.*",
+        "$..*",
+        "$.store.book[?(@.price < 10)].title",
+        "$..book[?(@.isbn)]",
+        "$..[?(@.color == 'red')]",
+        "$.store.book[?(@.author =~ /.*Tolkien$/)].title",
+        "$.store.book[?(@.title == 'Price in $')]"
+    };
+
+    for (const auto& path : paths)
+    {
+        auto expected = dom_select(store, path);
+        auto actual = stream_select(store, path);
+        // Streaming results come in document order, compare as sets
+        auto by_path = [](const json& a, const json& b) {return a[0].as<std::string>() < b[0].as<std::string>();};
+        std::sort(expected.array_range().begin(), expected.array_range().end(), by_path);
+        std::sort(actual.array_range().begin(), actual.array_range().end(), by_path);
+        CHECK(expected == actual);
+    }
+}
+
+TEST_CASE("jsonpath streaming_expression root and no match")
+{
+    SECTION("root")
+    {
+        auto actual = stream_select(store, "$");
+        REQUIRE(actual.size() == 1);
+        CHECK(actual[0][0].as<std::string>() == "$");
+        CHECK(actual[0][1] == json::parse(store));
+    }
+    SECTION("no match")
+    {
+        CHECK(stream_select(store, "$.store.book[10]").empty());
+        CHECK(stream_select(store, "$.warehouse..price").empty());
+    }
+    SECTION("next value")
+    {
+        std::string input = R"([{"a":1},{"a":2}])";
+        json_string_cursor cursor(input);
+        auto expr = jsonpath::make_streaming_expression<json>("$[*].a");
+        std::vector<int> values;
+        expr.evaluate(cursor, [&](const jsonpath::json_location&, const json& value){values.push_back(value.as<int>());});
+        CHECK(values == std::vector<int>{1,2});
+        CHECK(cursor.current().event_type() == staj_event_type::end_array);
+    }
+}
+
+TEST_CASE("jsonpath streaming_expression errors")
+{
+    std::error_code ec;
+
+    jsonpath::make_streaming_expression<json>("$.book[-1]", ec);
+    CHECK(ec == jsonpath::jsonpath_errc::unsupported_streaming_selector);
+
+    ec.clear();
+    jsonpath::make_streaming_expression<json>("$.book[0:4:0]", ec);
+    CHECK(ec == jsonpath::jsonpath_errc::step_cannot_be_zero);
+
+    ec.clear();
+    jsonpath::make_streaming_expression<json>("store.book", ec);
+    CHECK(ec == jsonpath::jsonpath_errc::expected_root_or_current_node);
+
+    ec.clear();
+    jsonpath::make_streaming_expression<json>("$.book[0", ec);
+    CHECK(ec == jsonpath::jsonpath_errc::unexpected_eof);
+
+    // A filter sees only the current element, not the root
+    ec.clear();
+    jsonpath::make_streaming_expression<json>("$.book[?(@.price < $.limit)]", ec);
+    CHECK(ec == jsonpath::jsonpath_errc::unsupported_streaming_selector);
+
+    CHECK_THROWS_AS(jsonpath::make_streaming_expression<json>("$[length(@)]"), jsonpath::jsonpath_error);
+}
@@ -0,0 +1,188 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#include <jsoncons_ext/jsonschema/jsonschema.hpp>
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_reader.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <catch/catch.hpp>
+
+using jsoncons::json;
+namespace jsonschema = jsoncons::jsonschema;
+
+namespace {
+
+    std::string to_string(const jsonschema::validation_message& msg)
+    {
+        return msg.instance_location().string() + " " + msg.eval_path().string() + " " + msg.message();
+    }
+
+    std::vector<std::string> dom_errors(const jsonschema::json_schema<json>& compiled, const std::string& input)
+    {
+        std::vector<std::string> errors;
+        compiled.validate(json::parse(input), 
+            [&](const jsonschema::validation_message& msg) -> jsonschema::walk_state
+            {
+                errors.push_back(to_string(msg));
+                return jsonschema::walk_state::advance;
+            });
+        std::sort(errors.begin(), errors.end());
+        return errors;
+    }
+
+    std::vector<std::string> streaming_errors(const jsonschema::json_schema<json>& compiled, const std::string& input)
+    {
+        std::vector<std::string> errors;
+        jsonschema::streaming_validator<json> validator(compiled, 
+            [&](const jsonschema::validation_message& msg) -> jsonschema::walk_state
+            {
+                errors.push_back(to_string(msg));
+                return jsonschema::walk_state::advance;
+            });
+        jsoncons::json_string_reader reader(input, validator);
+        reader.read();
+        CHECK(validator.error_count() == errors.size());
+        std::sort(errors.begin(), errors.end());
+        return errors;
+    }
+
+} // namespace
+
+TEST_CASE("jsonschema streaming_validator tests")
+{
+    SECTION("forward keywords")
+    {
+        json schema = json::parse(R"(
+{
+  "$schema": "https://json-schema.org/draft/2020-12/schema",
+  "$defs": {
+    "point": {
+      "type": "object",
+      "properties": {
+        "x": { "type": "number", "minimum": 0 },
+        "y": { "type": "number" }
+      },
+      "additionalProperties": false,
+      "required": [ "x", "y" ]
+    }
+  },
+  "type": "object",
+  "properties": {
+    "name": {"type": "string", "pattern": "^[a-z]+$", "maxLength": 5},
+    "kind": {"enum": ["a", "b"]},
+    "points": {"type": "array", "items": { "$ref": "#/$defs/point" }, "minItems": 3},
+    "pair": {"prefixItems": [{"type": "integer"}, {"type": "string"}], "items": false}
+  },
+  "patternProperties": {
+    "^x-": {"type": "integer"}
+  },
+  "additionalProperties": {"type": "boolean"},
+  "required": ["name", "points"],
+  "maxProperties": 8
+}
+        )");
+        auto compiled = jsonschema::make_json_schema(schema);
+
+        std::vector<std::string> instances = {
+            R"({"name": "abc", "points": [{"x": 1, "y": 2}, {"x": 1, "y": 2}, {"x": 3, "y": 4}]})",
+            R"({"name": "Abcdefg", "kind": "c", "points": [{"x": -1, "y": "2"}, {"x": 1, "z": 2}], "pair": [1, 2, 3]})",
+            R"({"points": [], "x-count": 1.5, "flag": true, "other": 1})",
+            R"([1,2,3])",
+            R"("abc")"
+        };
+        for (const auto& input : instances)
+        {
+            CHECK(streaming_errors(compiled, input) == dom_errors(compiled, input));
+        }
+        CHECK(streaming_errors(compiled, instances[0]).empty());
+    }
+
+    SECTION("buffered keywords")
+    {
+        json schema = json::parse(R"(
+{
+  "$schema": "https://json-schema.org/draft/2020-12/schema",
+  "type": "object",
+  "properties": {
+    "shape": {
+      "oneOf": [
+        {"properties": {"radius": {"type": "number"}}, "required": ["radius"]},
+        {"properties": {"width": {"type": "number"}}, "required": ["width"]}
+      ]
+    },
+    "tags": {"type": "array", "uniqueItems": true},
+    "config": {"properties": {"a": {"type": "integer"}}, "unevaluatedProperties": false}
+  }
+}
+        )");
+        auto compiled = jsonschema::make_json_schema(schema);
+
+        std::vector<std::string> instances = {
+            R"({"shape": {"radius": 1}, "tags": ["a", "b"], "config": {"a": 1}})",
+            R"({"shape": {"radius": 1, "width": 2}, "tags": ["a", "a"], "config": {"a": 1, "b": 2}})",
+            R"({"shape": {}, "tags": [], "config": {"a": "x"}})"
+        };
+        for (const auto& input : instances)
+        {
+            CHECK(streaming_errors(compiled, input) == dom_errors(compiled, input));
+        }
+    }
+
+    SECTION("draft 7 items and additionalItems")
+    {
+        json schema = json::parse(R"(
+{
+  "$schema": "http://json-schema.org/draft-07/schema#",
+  "type": "array",
+  "items": [{"type": "integer"}, {"type": "string"}],
+  "additionalItems": {"type": "boolean"},
+  "maxItems": 3
+}
+        )");
+        auto compiled = jsonschema::make_json_schema(schema);
+
+        std::vector<std::string> instances = {
+            R"([1, "a", true])",
+            R"(["a", 1, 2, false])"
+        };
+        for (const auto& input : instances)
+        {
+            CHECK(streaming_errors(compiled, input) == dom_errors(compiled, input));
+        }
+    }
+
+    SECTION("throwing by default")
+    {
+        json schema = json::parse(R"({"type": "object", "properties": {"a": {"type": "integer"}}})");
+        auto compiled = jsonschema::make_json_schema(schema);
+
+        jsonschema::streaming_validator<json> validator(compiled);
+        jsoncons::json_string_reader reader(R"({"a": "x", "b": [1, 2, 3]})", validator);
+        REQUIRE_THROWS_AS(reader.read(), jsonschema::validation_error);
+    }
+
+    SECTION("abort")
+    {
+        json schema = json::parse(R"({"items": {"type": "integer"}})");
+        auto compiled = jsonschema::make_json_schema(schema);
+
+        std::size_t count = 0;
+        jsonschema::streaming_validator<json> validator(compiled, 
+            [&](const jsonschema::validation_message&) -> jsonschema::walk_state
+            {
+                ++count;
+                return jsonschema::walk_state::abort;
+            });
+        jsoncons::json_string_reader reader(R"(["a", "b", "c"])", validator);
+        reader.read();
+        CHECK(count == 1);
+        CHECK(validator.aborted());
+        CHECK_FALSE(validator.is_valid());
+    }
+}
@@ -6,6 +6,7 @@
 #endif
 
 #include <jsoncons_ext/msgpack/msgpack.hpp>
+#include <jsoncons_ext/msgpack/decode_msgpack_sequence.hpp>
 
 #include <jsoncons/json.hpp>
 
@@ -261,3 +262,50 @@ TEST_CASE("decode msgpack str size tests")
 }
 
 
+
+TEST_CASE("decode msgpack sequence")
+{
+    std::vector<uint8_t> input;
+    std::vector<json> expected;
+    for (int i = 0; i < 100; ++i)
+    {
+        json j;
+        j.try_emplace("id", i);
+        j.try_emplace("name", std::string(static_cast<std::size_t>(i % 7), 'x'));
+        j.try_emplace("values", json::parse("[1,2,3]"));
+        msgpack::encode_msgpack(j, input);
+        expected.push_back(j);
+    }
+
+    SECTION("split")
+    {
+        auto items = msgpack::split_msgpack_sequence(input);
+        REQUIRE(items.size() == expected.size());
+        CHECK(msgpack::decode_msgpack<json>(items[42]) == expected[42]);
+    }
+
+    SECTION("decode in parallel")
+    {
+        for (std::size_t num_threads : {std::size_t(1), std::size_t(3), std::size_t(0)})
+        {
+            auto values = msgpack::decode_msgpack_sequence<json>(input, msgpack::msgpack_decode_options(), num_threads);
+            CHECK(values == expected);
+        }
+    }
+
+    SECTION("decode into a user type")
+    {
+        std::vector<uint8_t> ints;
+        msgpack::encode_msgpack(1, ints);
+        msgpack::encode_msgpack(-20, ints);
+        msgpack::encode_msgpack(300, ints);
+        auto values = msgpack::decode_msgpack_sequence<int>(ints, msgpack::msgpack_decode_options(), 2);
+        CHECK(values == std::vector<int>{1,-20,300});
+    }
+
+    SECTION("truncated item")
+    {
+        std::vector<uint8_t> truncated(input.begin(), input.end() - 1);
+        CHECK_THROWS_AS(msgpack::decode_msgpack_sequence<json>(truncated), jsoncons::ser_error);
+    }
+}
@@ -172,3 +172,69 @@ TEST_CASE("encode_msgpack allocator_set overloads")
 }
 
 #endif
+
+TEST_CASE("encode_msgpack exact size and fixed buffer")
+{
+    json j = json::parse(R"(
+{"name":"Alice","count":42,"big":4294967296,"delta":-500,"ratio":1.5,"active":true,"missing":null,
+ "tags":["a","b",{"c":"x"}],"text":"A somewhat longer string that needs a longer length header"}
+    )");
+
+    std::vector<uint8_t> expected;
+    msgpack::encode_msgpack(j, expected);
+
+    SECTION("encoded size")
+    {
+        CHECK(msgpack::encoded_msgpack_size(j) == expected.size());
+        std::vector<std::string> v = {"a","bc","def"};
+        std::vector<uint8_t> buffer;
+        msgpack::encode_msgpack(v, buffer);
+        CHECK(msgpack::encoded_msgpack_size(v) == buffer.size());
+    }
+
+    SECTION("fixed buffer")
+    {
+        std::vector<uint8_t> buffer(expected.size() + 10);
+        std::size_t length = msgpack::encode_msgpack_to_buffer(j, jsoncons::span<uint8_t>(buffer.data(), buffer.size()));
+        CHECK(length == expected.size());
+        buffer.resize(length);
+        CHECK(buffer == expected);
+    }
+
+    SECTION("fixed buffer too small")
+    {
+        std::vector<uint8_t> buffer(expected.size() - 1);
+        auto r = msgpack::try_encode_msgpack_to_buffer(j, jsoncons::span<uint8_t>(buffer.data(), buffer.size()));
+        REQUIRE_FALSE(r);
+        CHECK(r.error() == msgpack::msgpack_errc::buffer_too_small);
+    }
+
+    SECTION("fixed buffer too small, reflected type")
+    {
+        std::vector<std::string> v(100, "abc");
+        std::vector<uint8_t> buffer(10);
+        auto r = msgpack::try_encode_msgpack_to_buffer(v, jsoncons::span<uint8_t>(buffer.data(), buffer.size()));
+        REQUIRE_FALSE(r);
+        CHECK(r.error() == msgpack::msgpack_errc::buffer_too_small);
+    }
+
+    SECTION("encoded size of boundary values")
+    {
+        json values = json::parse(R"(
+[127,128,255,256,32767,32768,65535,65536,4294967295,4294967296,-32,-33,-128,-129,-32768,-32769,
+ -2147483648,-2147483649,18446744073709551615,0.1,1e300,"",{},[],
+ "1234567890123456789012345678901","12345678901234567890123456789012"]
+        )");
+        values.emplace_back(byte_string{1,2,3});
+        values.emplace_back(1700000000, semantic_tag::epoch_second);
+        for (const auto& item : values.array_range())
+        {
+            std::vector<uint8_t> buffer;
+            msgpack::encode_msgpack(item, buffer);
+            CHECK(msgpack::encoded_msgpack_size(item) == buffer.size());
+        }
+        std::vector<uint8_t> buffer;
+        msgpack::encode_msgpack(values, buffer);
+        CHECK(msgpack::encoded_msgpack_size(values) == buffer.size());
+    }
+}
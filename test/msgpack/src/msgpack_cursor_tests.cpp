@@ -389,3 +389,137 @@ TEMPLATE_TEST_CASE("msgpack_cursor reset test", "",
         CHECK(cursor.done());
     }
 }
+
+TEST_CASE("msgpack_cursor skip test")
+{
+    ojson j = ojson::parse(R"(
+    {
+        "skipped" : {"a" : [1, -2, 3.5, {"b" : "c"}], "d" : null, "e" : [[],{}]},
+        "kept" : [true, "x"]
+    }
+    )");
+    std::vector<uint8_t> data;
+    msgpack::encode_msgpack(j, data);
+
+    msgpack::msgpack_bytes_cursor cursor(data);
+    REQUIRE(staj_events::begin_object == cursor.current().event_type());
+    cursor.next();
+    CHECK(cursor.current().get<std::string>() == "skipped");
+    cursor.next();
+    REQUIRE(staj_events::begin_object == cursor.current().event_type());
+    cursor.skip();
+    CHECK(staj_events::end_object == cursor.current().event_type());
+    cursor.next();
+    CHECK(cursor.current().get<std::string>() == "kept");
+    cursor.next();
+    REQUIRE(staj_events::begin_array == cursor.current().event_type());
+    cursor.skip();
+    CHECK(staj_events::end_array == cursor.current().event_type());
+    cursor.next();
+    CHECK(staj_events::end_object == cursor.current().event_type());
+    cursor.next();
+    CHECK(cursor.done());
+}
+
+TEST_CASE("msgpack_push_cursor test")
+{
+    std::vector<std::vector<uint8_t>> items(3);
+    msgpack::encode_msgpack(ojson::parse(R"({"name":"Jane Doe","values":[1,-2.5,[],"x"],"blob":{}})"), items[0]);
+    msgpack::encode_msgpack(ojson::parse(R"([[1000,70000,5000000000],{"a":null}])"), items[1]);
+    items[2] = {0xd6,0xff,0x00,0x00,0x00,0x01}; // timestamp 32
+
+    std::vector<uint8_t> data;
+    std::vector<std::vector<staj_events>> expected;
+    for (const auto& item : items)
+    {
+        data.insert(data.end(), item.begin(), item.end());
+        msgpack::msgpack_bytes_cursor cursor(item);
+        expected.emplace_back();
+        for (; !cursor.done(); cursor.next())
+        {
+            expected.back().push_back(cursor.current().event_type());
+        }
+    }
+
+    msgpack::msgpack_push_cursor cursor;
+    std::vector<std::vector<staj_events>> actual(1);
+    std::size_t pos = 0;
+    while (actual.size() <= expected.size())
+    {
+        cursor.next();
+        if (cursor.need_more_input())
+        {
+            if (pos == data.size())
+            {
+                break;
+            }
+            std::size_t n = (std::min)(std::size_t(3), data.size() - pos);
+            cursor.update(data.data() + pos, n);
+            pos += n;
+        }
+        else if (cursor.done())
+        {
+            actual.emplace_back();
+            cursor.reset();
+            if (!cursor.need_more_input())
+            {
+                actual.back().push_back(cursor.current().event_type());
+            }
+        }
+        else
+        {
+            actual.back().push_back(cursor.current().event_type());
+        }
+    }
+    actual.pop_back();
+    CHECK(expected == actual);
+    CHECK(data.size() == cursor.column());
+}
+
+TEST_CASE("msgpack_bytes_cursor string views into input")
+{
+    ojson j(json_object_arg);
+    j.try_emplace("name", "hiking");
+    j.try_emplace("data", byte_string{'H','e','l','l','o'});
+    j.try_emplace("long", std::string(300, 'x'));
+
+    std::vector<uint8_t> data;
+    msgpack::encode_msgpack(j, data);
+    const char* first = reinterpret_cast<const char*>(data.data());
+    const char* last = first + data.size();
+
+    std::string input(data.begin(), data.end());
+    std::istringstream is(input);
+    msgpack::msgpack_stream_cursor stream_cursor(is);
+
+    msgpack::msgpack_bytes_cursor cursor(data);
+    std::size_t count = 0;
+    for (; !cursor.done(); cursor.next(), stream_cursor.next())
+    {
+        REQUIRE(cursor.current().event_type() == stream_cursor.current().event_type());
+        switch (cursor.current().event_type())
+        {
+            case staj_events::key:
+            case staj_events::string_value:
+            {
+                auto sv = cursor.current().get<string_view>();
+                CHECK((sv.data() >= first && sv.data() + sv.size() <= last));
+                CHECK(stream_cursor.current().get<string_view>() == sv);
+                ++count;
+                break;
+            }
+            case staj_events::byte_string_value:
+            {
+                auto bytes = cursor.current().get<byte_string_view>();
+                CHECK((reinterpret_cast<const char*>(bytes.data()) >= first));
+                CHECK((reinterpret_cast<const char*>(bytes.data()) + bytes.size() <= last));
+                CHECK(stream_cursor.current().get<byte_string_view>() == bytes);
+                ++count;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    CHECK(6 == count);
+}
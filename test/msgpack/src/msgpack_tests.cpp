@@ -439,3 +439,147 @@ TEST_CASE("msgpack json constructor unsigned __int64 tests")
 #pragma GCC diagnostic pop
 #endif
 
+
+TEST_CASE("msgpack ext registry")
+{
+    msgpack_ext_registry registry;
+    // bigdec strings as ext type 7, payload the decimal text
+    registry.register_encoder(7, semantic_tag::bigdec,
+        [](const byte_string_view& value, std::vector<uint8_t>& payload)
+        {
+            payload.insert(payload.end(), value.begin(), value.end());
+            return true;
+        });
+    // base16 tagged byte strings of length 16 as ext type 5
+    registry.register_encoder(5, semantic_tag::base16,
+        [](const byte_string_view& value, std::vector<uint8_t>& payload)
+        {
+            if (value.size() != 16)
+            {
+                return false;
+            }
+            payload.insert(payload.end(), value.begin(), value.end());
+            return true;
+        });
+    registry.register_decoder(7,
+        [](const byte_string_view& payload, item_event_visitor& visitor, const ser_context& context, std::error_code& ec)
+        {
+            visitor.string_value(jsoncons::string_view(reinterpret_cast<const char*>(payload.data()), payload.size()),
+                semantic_tag::bigdec, context, ec);
+        });
+    // 16 byte UUIDs as ext type 5, reported as hex strings
+    registry.register_decoder(5,
+        [](const byte_string_view& payload, item_event_visitor& visitor, const ser_context& context, std::error_code& ec)
+        {
+            if (payload.size() != 16)
+            {
+                ec = msgpack_errc::unknown_type;
+                return;
+            }
+            std::string s;
+            bytes_to_base16(payload.begin(), payload.end(), s);
+            visitor.string_value(s, semantic_tag::none, context, ec);
+        });
+
+    msgpack_options options;
+    options.ext_registry(registry);
+
+    SECTION("round trip through registered handlers")
+    {
+        json j(json_array_arg);
+        j.emplace_back("123456789012345678901234567890.5", semantic_tag::bigdec);
+        j.emplace_back("plain");
+
+        std::vector<uint8_t> buffer;
+        encode_msgpack(j, buffer, options);
+        CHECK(buffer[1] == msgpack_type::ext8_type);
+        CHECK(static_cast<int8_t>(buffer[3]) == 7);
+
+        json result = decode_msgpack<json>(buffer, options);
+        REQUIRE(result.size() == 2);
+        CHECK(result[0].tag() == semantic_tag::bigdec);
+        CHECK(result[0].as_string() == "123456789012345678901234567890.5");
+        CHECK(result[1].as_string() == "plain");
+
+        // Without the registry the ext value is a tagged byte string
+        json raw = decode_msgpack<json>(buffer);
+        CHECK(raw[0].is_byte_string());
+        CHECK(raw[0].ext_tag() == 7);
+    }
+
+    SECTION("registered decoder for a fixext16")
+    {
+        std::vector<uint8_t> input = {msgpack_type::fixext16_type, 0x05,
+            0x12,0x34,0x56,0x78,0x12,0x34,0x56,0x78,0x12,0x34,0x56,0x78,0x12,0x34,0x56,0x78};
+        json result = decode_msgpack<json>(input, options);
+        CHECK(result.as_string() == "12345678123456781234567812345678");
+    }
+
+    SECTION("byte string through a registered encoder")
+    {
+        std::vector<uint8_t> uuid = {0x12,0x34,0x56,0x78,0x12,0x34,0x56,0x78,0x12,0x34,0x56,0x78,0x12,0x34,0x56,0x78};
+        json j(json_array_arg);
+        j.emplace_back(byte_string_arg, uuid, semantic_tag::base16);
+        j.emplace_back(byte_string_arg, std::vector<uint8_t>{1,2,3}, semantic_tag::base16);
+
+        std::vector<uint8_t> buffer;
+        encode_msgpack(j, buffer, options);
+        CHECK(buffer[1] == msgpack_type::fixext16_type);
+        CHECK(static_cast<int8_t>(buffer[2]) == 5);
+
+        json result = decode_msgpack<json>(buffer, options);
+        REQUIRE(result.size() == 2);
+        CHECK(result[0].as_string() == "12345678123456781234567812345678");
+        CHECK(result[1].is_byte_string());
+    }
+
+    SECTION("cursor reports the decoded value")
+    {
+        json j(json_array_arg);
+        j.emplace_back("1.5", semantic_tag::bigdec);
+        j.emplace_back(true);
+        std::vector<uint8_t> buffer;
+        encode_msgpack(j, buffer, options);
+
+        msgpack_bytes_cursor cursor(buffer, options);
+        CHECK(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::string_value);
+        CHECK(cursor.current().tag() == semantic_tag::bigdec);
+        CHECK(cursor.current().get<std::string>() == "1.5");
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::bool_value);
+    }
+
+    SECTION("decoder reporting more than one value")
+    {
+        msgpack_ext_registry pairs;
+        pairs.register_decoder(9,
+            [](const byte_string_view& payload, item_event_visitor& visitor, const ser_context& context, std::error_code& ec)
+            {
+                visitor.begin_array(2, semantic_tag::none, context, ec);
+                visitor.uint64_value(payload[0], semantic_tag::none, context, ec);
+                visitor.uint64_value(payload[1], semantic_tag::none, context, ec);
+                visitor.end_array(context, ec);
+            });
+        msgpack_options pair_options;
+        pair_options.ext_registry(pairs);
+
+        std::vector<uint8_t> input = {msgpack_type::fixext2_type, 0x09, 0x01, 0x02};
+        auto r = try_decode_msgpack<json>(input, pair_options);
+        REQUIRE_FALSE(r);
+        CHECK(r.error().code() == msgpack_errc::invalid_ext_value);
+
+        std::error_code ec;
+        msgpack_bytes_cursor cursor(input, pair_options, ec);
+        CHECK(ec == msgpack_errc::invalid_ext_value);
+    }
+
+    SECTION("timestamps are still decoded")
+    {
+        std::vector<uint8_t> input = {msgpack_type::fixext4_type, 0xff, 0x00,0x00,0x00,0x05};
+        json result = decode_msgpack<json>(input, options);
+        CHECK(result.tag() == semantic_tag::epoch_second);
+        CHECK(result.as<int>() == 5);
+    }
+}
@@ -0,0 +1,104 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons_ext/msgpack/msgpack.hpp>
+#include <jsoncons/json.hpp>
+
+#include <string>
+#include <vector>
+#include <catch/catch.hpp>
+
+using namespace jsoncons;
+
+TEST_CASE("msgpack_view tests")
+{
+    json j = json::parse(R"(
+{"name":"Alice","count":42,"big":4294967296,"delta":-500,"ratio":1.5,"active":true,"missing":null,
+ "tags":["a","b",{"c":"x"}],"route":{"region":"eu","shard":7}}
+    )");
+    j.try_emplace("data", json(byte_string_arg, std::vector<uint8_t>{1,2,3}));
+
+    std::vector<uint8_t> buffer;
+    msgpack::encode_msgpack(j, buffer);
+
+    msgpack::msgpack_view view(buffer.data(), buffer.size());
+
+    SECTION("find and typed accessors")
+    {
+        CHECK(view.is_object());
+        CHECK(view.size() == j.size());
+        CHECK(view["name"].as_string_view() == "Alice");
+        CHECK(view["count"].as_uint64() == 42);
+        CHECK(view["big"].as_int64() == 4294967296);
+        CHECK(view["delta"].as_int64() == -500);
+        CHECK(view["ratio"].as_double() == 1.5);
+        CHECK(view["active"].as_bool());
+        CHECK(view["missing"].is_null());
+        CHECK(view["data"].as_byte_string_view() == byte_string_view(std::vector<uint8_t>{1,2,3}));
+        CHECK(view["tags"].at(std::size_t(2))["c"].as_string_view() == "x");
+        CHECK(view["route"]["shard"].as_int64() == 7);
+
+        CHECK(view.contains("route"));
+        CHECK_FALSE(view.contains("nothere"));
+        CHECK_THROWS_AS(view["nothere"], key_not_found);
+        CHECK_THROWS(view["name"].as_int64());
+        CHECK_THROWS(view["tags"].at(std::size_t(3)));
+    }
+
+    SECTION("iteration")
+    {
+        auto it = j.object_range().begin();
+        for (const auto& member : view.object_range())
+        {
+            REQUIRE((it != j.object_range().end()));
+            CHECK(member.key().as_string_view() == it->key());
+            ++it;
+        }
+        CHECK((it == j.object_range().end()));
+
+        std::size_t count = 0;
+        for (const auto& item : view["tags"].array_range())
+        {
+            (void)item;
+            ++count;
+        }
+        CHECK(count == 3);
+    }
+
+    SECTION("truncated input")
+    {
+        // Only the bytes a read needs are scanned
+        msgpack::msgpack_view truncated(buffer.data(), buffer.size() - 1);
+        CHECK(truncated["name"].as_string_view() == "Alice");
+        CHECK_THROWS_AS(truncated["tags"], ser_error);
+        CHECK_THROWS_AS(truncated.bytes(), ser_error);
+    }
+
+    SECTION("index")
+    {
+        auto index = view.index();
+        CHECK(index.size() == j.size());
+        CHECK(index["name"].as_string_view() == "Alice");
+        CHECK(index["route"]["region"].as_string_view() == "eu");
+        CHECK(index.contains("route"));
+        CHECK_FALSE(index.contains("nothere"));
+        CHECK_THROWS_AS(index["nothere"], key_not_found);
+
+        auto tags = view["tags"].index();
+        CHECK(tags.size() == 3);
+        CHECK(tags.at(std::size_t(1)).as_string_view() == "b");
+        CHECK_THROWS(tags.at(std::size_t(3)));
+        CHECK_THROWS(view["name"].index());
+    }
+}
+
+TEST_CASE("msgpack_view ext")
+{
+    // fixext4 with type -1 (timestamp 32)
+    std::vector<uint8_t> input = {0xd6,0xff,0x00,0x00,0x00,0x01};
+
+    msgpack::msgpack_view view(input.data(), input.size());
+    CHECK(view.is_ext());
+    CHECK(view.ext_type() == -1);
+    CHECK(view.as_byte_string_view().size() == 4);
+}
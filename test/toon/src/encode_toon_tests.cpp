@@ -2,7 +2,10 @@
 // Distributed under Boost license
 
 #include <jsoncons/json.hpp>
+#include <jsoncons/json_cursor.hpp>
+#include <jsoncons/reflect/json_conv_traits.hpp>
 #include <jsoncons_ext/toon/encode_toon.hpp>
+#include <jsoncons_ext/toon/toon_encoder.hpp>
 #include <catch/catch.hpp>
 #include <sstream>
 #include <vector>
@@ -12,6 +15,30 @@
 
 using namespace jsoncons;
 
+namespace {
+namespace ns {
+
+    struct hike
+    {
+        int id;
+        std::string name;
+        double distance_km;
+        bool was_sunny;
+    };
+
+    struct trip
+    {
+        std::string season;
+        std::vector<std::string> friends;
+        std::vector<hike> hikes;
+    };
+
+} // namespace ns
+} // namespace
+
+JSONCONS_ALL_MEMBER_NAME_TRAITS(ns::hike, (id, "id"), (name, "name"), (distance_km, "distanceKm"), (was_sunny, "wasSunny"))
+JSONCONS_ALL_MEMBER_TRAITS(ns::trip, season, friends, hikes)
+
 TEST_CASE("toon::detail::exponential_to_decimal_notation")
 {
     SECTION("10.0e-1")
@@ -282,3 +309,59 @@ hikes[3]{id,name,distanceKm,elevationGain,companion,wasSunny}:
     }
 }
 
+TEST_CASE("toon_encoder tests")
+{
+    SECTION("from a json cursor")
+    {
+        std::string str = R"(
+{
+  "id": 7,
+  "tags": ["a", "b c", "d,e"],
+  "rows": [{"x": 1, "y": "one"}, {"y": "two", "x": 2}],
+  "mixed": [1, {"k": [1, 2], "v": {"w": null}}, [true, false], []],
+  "nested": {"empty": {}, "values": [[1, 2], [[3], {"z": 1.5e-7}]]}
+}
+        )";
+
+        std::string expected;
+        toon::encode_toon(ojson::parse(str), expected);
+
+        json_string_cursor cursor(str);
+        std::string buffer;
+        toon::toon_string_encoder encoder(buffer);
+        cursor.read_to(encoder);
+        CHECK(expected == buffer);
+    }
+    SECTION("tabular form decided in one pass")
+    {
+        std::string str = R"([{"a": 1, "b": 2}, {"b": 3, "a": 4}, {"a": 5, "c": 6}])";
+
+        std::string buffer;
+        toon::toon_string_encoder encoder(buffer);
+        json_string_cursor cursor(str);
+        cursor.read_to(encoder);
+
+        std::string expected = R"([3]:
+  - a: 1
+    b: 2
+  - b: 3
+    a: 4
+  - a: 5
+    c: 6)";
+        CHECK(expected == buffer);
+    }
+    SECTION("reflected types")
+    {
+        ns::trip trip{"spring_2025", {"ana", "luis"}, {{1, "Blue Lake Trail", 7.5, true}, {2, "Ridge Overlook", 9.2, false}}};
+
+        std::string buffer;
+        toon::encode_toon(trip, buffer);
+
+        std::string expected = R"(season: spring_2025
+friends[2]: ana,luis
+hikes[2]{id,name,distanceKm,wasSunny}:
+  1,Blue Lake Trail,7.5,true
+  2,Ridge Overlook,9.2,false)";
+        CHECK(expected == buffer);
+    }
+}
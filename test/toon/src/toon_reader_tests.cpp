@@ -3,11 +3,14 @@
 
 #include <jsoncons/json.hpp>
 #include <jsoncons_ext/toon/toon_reader.hpp>
+#include <jsoncons_ext/toon/toon_cursor.hpp>
+#include <jsoncons_ext/toon/decode_toon.hpp>
 #include <jsoncons/json_decoder.hpp>
 #include <catch/catch.hpp>
 #include <vector>
 #include <utility>
 #include <iostream> 
+#include <sstream>
 
 namespace toon = jsoncons::toon;
 
@@ -623,3 +626,78 @@ TEST_CASE("toon_reader errors")
         CHECK(expected == result.error().message());
     }
 }
+
+TEST_CASE("toon_reader streaming")
+{
+    std::string data = R"(context:
+  task: Our favorite hikes together
+  location: Boulder
+friends[3]: ana,luis,sam
+hikes[3]{id,name,distanceKm}:
+  1,Blue Lake Trail,7.5
+  2,Ridge Overlook,9.2
+  3,Wildflower Loop,5.1
+items[2]:
+  - name: a
+    tags[2]: x,y
+  - "b c"
+)";
+
+    auto expected = toon::decode_toon<jsoncons::ojson>(data);
+
+    SECTION("lines split across buffers")
+    {
+        for (std::size_t buffer_size = 1; buffer_size < 20; ++buffer_size)
+        {
+            std::istringstream is(data);
+            jsoncons::json_decoder<jsoncons::ojson> decoder;
+            toon::toon_stream_reader reader(jsoncons::stream_source<char>(is, buffer_size), decoder);
+            auto result = reader.try_read();
+            REQUIRE(result); //-V521
+            CHECK(expected == decoder.get_result()); //-V521
+        }
+    }
+
+    SECTION("cursor")
+    {
+        toon::toon_string_cursor cursor(data);
+        jsoncons::json_decoder<jsoncons::ojson> decoder;
+        std::size_t count = 0;
+        for (; !cursor.done(); cursor.next())
+        {
+            std::error_code ec;
+            cursor.current().send_json_event(decoder, cursor.context(), ec);
+            REQUIRE_FALSE(ec); //-V521
+            ++count;
+        }
+        CHECK(expected == decoder.get_result()); //-V521
+        CHECK(count == 55); //-V521
+    }
+
+    SECTION("cursor read_to")
+    {
+        std::istringstream is(data);
+        toon::toon_stream_cursor cursor(is);
+        REQUIRE(cursor.current().event_type() == jsoncons::staj_events::begin_object); //-V521
+        cursor.next();
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == jsoncons::staj_events::begin_object); //-V521
+        jsoncons::json_decoder<jsoncons::ojson> decoder;
+        cursor.read_to(decoder);
+        CHECK(expected["context"] == decoder.get_result()); //-V521
+        cursor.next();
+        CHECK(cursor.current().get<std::string>() == "friends"); //-V521
+    }
+
+    SECTION("error line")
+    {
+        std::string bad = "a[2]:\n  - 1\n  - 2\n  - 3\nb: 1\n";
+        std::istringstream is(bad);
+        jsoncons::json_decoder<jsoncons::ojson> decoder;
+        toon::toon_stream_reader reader(is, decoder, toon::toon_options{}.strict(true));
+        auto result = reader.try_read();
+        REQUIRE_FALSE(result); //-V521
+        CHECK(result.error().code() == toon::toon_errc::list_array_length_mismatch); //-V521
+        CHECK(result.error().line() == 5); //-V521
+    }
+}
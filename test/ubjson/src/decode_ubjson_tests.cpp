@@ -184,4 +184,22 @@ TEST_CASE("decode indefinite length ubjson arrays and maps")
     }
 }
 
-
+TEST_CASE("decode ubjson strongly typed numeric arrays")
+{
+    check_decode_ubjson({'[','$','i','#','U',0x03,0x01,0xff,0x7f},json::parse("[1,-1,127]"));
+    check_decode_ubjson({'[','$','U','#','U',0x02,0x00,0xff},json::parse("[0,255]"));
+    check_decode_ubjson({'[','$','l','#','U',0x02,0x00,0x01,0x00,0x00,0xff,0xff,0xff,0xff},json::parse("[65536,-1]"));
+    check_decode_ubjson({'[','$','d','#','U',0x01,0x3f,0xc0,0x00,0x00},json::parse("[1.5]"));
+    check_decode_ubjson({'[','$','D','#','U',0x00},json::parse("[]"));
+    check_decode_ubjson({'{','#','U',0x01,'U',0x01,'a','[','$','I','#','U',0x02,0x00,0x01,0x01,0x00},json::parse("{\"a\":[1,256]}"));
+
+    SECTION("truncated")
+    {
+        std::vector<uint8_t> v = {'[','$','L','#','U',0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00};
+        std::error_code ec;
+        json_decoder<json> decoder;
+        ubjson::basic_ubjson_parser<bytes_source> parser(v);
+        parser.parse(decoder, ec);
+        CHECK(ec == ubjson::ubjson_errc::unexpected_eof);
+    }
+}
@@ -174,6 +174,54 @@ TEST_CASE("encode indefinite length ubjson arrays and maps")
     }
 }
 
+TEST_CASE("encode ubjson typed arrays")
+{
+    SECTION("int16")
+    {
+        std::vector<int16_t> x = {1,-2,300};
+        std::vector<uint8_t> v;
+        ubjson::encode_ubjson(x, v);
+        check_encode_ubjson({'[','$','I','#','U',0x03,0x00,0x01,0xff,0xfe,0x01,0x2c}, v);
+
+        auto y = ubjson::decode_ubjson<std::vector<int16_t>>(v);
+        CHECK(y == x);
+    }
+    SECTION("uint16 widened to int32")
+    {
+        std::vector<uint16_t> x = {1,65535};
+        std::vector<uint8_t> v;
+        ubjson::encode_ubjson(x, v);
+        check_encode_ubjson({'[','$','l','#','U',0x02,0x00,0x00,0x00,0x01,0x00,0x00,0xff,0xff}, v);
+
+        auto y = ubjson::decode_ubjson<std::vector<uint16_t>>(v);
+        CHECK(y == x);
+    }
+    SECTION("double")
+    {
+        std::vector<double> x = {1.5,-0.25};
+        std::vector<uint8_t> v;
+        ubjson::encode_ubjson(x, v);
+        check_encode_ubjson({'[','$','D','#','U',0x02,
+                             0x3f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,
+                             0xbf,0xd0,0x00,0x00,0x00,0x00,0x00,0x00}, v);
+
+        auto y = ubjson::decode_ubjson<std::vector<double>>(v);
+        CHECK(y == x);
+    }
+    SECTION("uint64 in int64 range")
+    {
+        std::vector<uint64_t> x = {1,256};
+        std::vector<uint8_t> v;
+        ubjson::encode_ubjson(x, v);
+        check_encode_ubjson({'[','$','L','#','U',0x02,
+                             0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+                             0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00}, v);
+
+        auto y = ubjson::decode_ubjson<std::vector<uint64_t>>(v);
+        CHECK(y == x);
+    }
+}
+
 namespace { namespace ns {
 
     struct Person
@@ -248,3 +296,69 @@ TEST_CASE("encode_ubjson allocator_set overloads")
 }
 
 #endif
+
+TEST_CASE("encode_ubjson exact size and fixed buffer")
+{
+    json j = json::parse(R"(
+{"name":"Alice","count":42,"big":4294967296,"delta":-500,"ratio":1.5,"active":true,"missing":null,
+ "tags":["a","b",{"c":"x"}],"text":"A somewhat longer string that needs a longer length header"}
+    )");
+
+    std::vector<uint8_t> expected;
+    ubjson::encode_ubjson(j, expected);
+
+    SECTION("encoded size")
+    {
+        CHECK(ubjson::encoded_ubjson_size(j) == expected.size());
+        std::vector<std::string> v = {"a","bc","def"};
+        std::vector<uint8_t> buffer;
+        ubjson::encode_ubjson(v, buffer);
+        CHECK(ubjson::encoded_ubjson_size(v) == buffer.size());
+    }
+
+    SECTION("fixed buffer")
+    {
+        std::vector<uint8_t> buffer(expected.size() + 10);
+        std::size_t length = ubjson::encode_ubjson_to_buffer(j, jsoncons::span<uint8_t>(buffer.data(), buffer.size()));
+        CHECK(length == expected.size());
+        buffer.resize(length);
+        CHECK(buffer == expected);
+    }
+
+    SECTION("fixed buffer too small")
+    {
+        std::vector<uint8_t> buffer(expected.size() - 1);
+        auto r = ubjson::try_encode_ubjson_to_buffer(j, jsoncons::span<uint8_t>(buffer.data(), buffer.size()));
+        REQUIRE_FALSE(r);
+        CHECK(r.error() == ubjson::ubjson_errc::buffer_too_small);
+    }
+
+    SECTION("fixed buffer too small, reflected type")
+    {
+        std::vector<std::string> v(100, "abc");
+        std::vector<uint8_t> buffer(10);
+        auto r = ubjson::try_encode_ubjson_to_buffer(v, jsoncons::span<uint8_t>(buffer.data(), buffer.size()));
+        REQUIRE_FALSE(r);
+        CHECK(r.error() == ubjson::ubjson_errc::buffer_too_small);
+    }
+
+    SECTION("encoded size of boundary values")
+    {
+        json values = json::parse(R"(
+[127,128,255,256,32767,32768,65535,65536,4294967295,4294967296,-32,-33,-128,-129,-32768,-32769,
+ -2147483648,-2147483649,18446744073709551615,0.1,1e300,"",{},[],
+ "1234567890123456789012345678901","12345678901234567890123456789012"]
+        )");
+        values.emplace_back(byte_string{1,2,3});
+        values.emplace_back(byte_string_arg, std::vector<uint8_t>{1,2,3}, semantic_tag::base64);
+        for (const auto& item : values.array_range())
+        {
+            std::vector<uint8_t> buffer;
+            ubjson::encode_ubjson(item, buffer);
+            CHECK(ubjson::encoded_ubjson_size(item) == buffer.size());
+        }
+        std::vector<uint8_t> buffer;
+        ubjson::encode_ubjson(values, buffer);
+        CHECK(ubjson::encoded_ubjson_size(values) == buffer.size());
+    }
+}
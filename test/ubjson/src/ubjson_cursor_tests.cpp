@@ -417,3 +417,56 @@ TEMPLATE_TEST_CASE("ubjson_cursor reset test", "",
         CHECK(cursor.done());
     }
 }
+
+TEST_CASE("ubjson_cursor skip test")
+{
+    ojson j = ojson::parse(R"(
+    {
+        "skipped" : {"a" : [1, -2, 3.5, {"b" : "c"}], "d" : null, "e" : [[],{}]},
+        "kept" : [true, "x"]
+    }
+    )");
+    std::vector<uint8_t> data;
+    ubjson::encode_ubjson(j, data);
+
+    ubjson::ubjson_bytes_cursor cursor(data);
+    REQUIRE(staj_events::begin_object == cursor.current().event_type());
+    cursor.next();
+    CHECK(cursor.current().get<std::string>() == "skipped");
+    cursor.next();
+    REQUIRE(staj_events::begin_object == cursor.current().event_type());
+    cursor.skip();
+    CHECK(staj_events::end_object == cursor.current().event_type());
+    cursor.next();
+    CHECK(cursor.current().get<std::string>() == "kept");
+    cursor.next();
+    REQUIRE(staj_events::begin_array == cursor.current().event_type());
+    cursor.skip();
+    CHECK(staj_events::end_array == cursor.current().event_type());
+    cursor.next();
+    CHECK(staj_events::end_object == cursor.current().event_type());
+    cursor.next();
+    CHECK(cursor.done());
+}
+
+TEST_CASE("ubjson_cursor skip strongly typed array test")
+{
+    // {"a" : [$i#3 1 2 3], "b" : true}
+    std::vector<uint8_t> data = {'{','#','U',2,'U',1,'a','[','$','i','#','U',3,1,2,3,'U',1,'b','T'};
+
+    ubjson::ubjson_bytes_cursor cursor(data);
+    REQUIRE(staj_events::begin_object == cursor.current().event_type());
+    cursor.next();
+    cursor.next();
+    REQUIRE(staj_events::begin_array == cursor.current().event_type());
+    cursor.skip();
+    CHECK(staj_events::end_array == cursor.current().event_type());
+    cursor.next();
+    CHECK(cursor.current().get<std::string>() == "b");
+    cursor.next();
+    CHECK(cursor.current().get<bool>());
+    cursor.next();
+    CHECK(staj_events::end_object == cursor.current().event_type());
+    cursor.next();
+    CHECK(cursor.done());
+}